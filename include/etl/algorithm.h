@@ -82,6 +82,18 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  ETL_CONSTEXPR14 void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  ETL_CONSTEXPR14 void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void merge_sort(TIterator first, TIterator last, TCompare compare);
 }
 
 //*****************************************************************************
@@ -99,7 +111,7 @@ namespace etl
     struct swap_impl<false>
     {
       template <typename TIterator1, typename TIterator2>
-      static void do_swap(TIterator1 a, TIterator2 b)
+      static ETL_CONSTEXPR14 void do_swap(TIterator1 a, TIterator2 b)
       {
         typename etl::iterator_traits<TIterator1>::value_type tmp = *a;
         *a = *b;
@@ -112,7 +124,7 @@ namespace etl
     struct swap_impl<true>
     {
       template <typename TIterator1, typename TIterator2>
-      static void do_swap(TIterator1 a, TIterator2 b)
+      static ETL_CONSTEXPR14 void do_swap(TIterator1 a, TIterator2 b)
       {
         using ETL_OR_STD::swap; // Allow ADL
         swap(*a, *b);
@@ -2016,6 +2028,25 @@ namespace etl
   }
 
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*********************************
+    // Random access iterators use introsort.
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::true_type /*is_random_access*/)
+    {
+      etl::intro_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Other iterators use shell sort.
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::false_type /*is_random_access*/)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
   /// Uses user defined comparison.
@@ -2024,7 +2055,7 @@ namespace etl
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
   }
 
   //***************************************************************************
@@ -2034,7 +2065,7 @@ namespace etl
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
@@ -2046,7 +2077,7 @@ namespace etl
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    etl::merge_sort(first, last, compare);
   }
 
   //***************************************************************************
@@ -2057,7 +2088,7 @@ namespace etl
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -3073,6 +3104,640 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  namespace private_algorithm
+  {
+    //*********************************
+    // Partitions below this size are insertion sorted.
+    static ETL_CONSTANT size_t Intro_Sort_Insertion_Threshold = 24U;
+
+    // Partitions above this size use the pseudo median of nine as the pivot.
+    static ETL_CONSTANT size_t Intro_Sort_Ninther_Threshold = 128U;
+
+    // The maximum number of elements moved by an optimistic insertion sort.
+    static ETL_CONSTANT size_t Intro_Sort_Partial_Insertion_Limit = 8U;
+
+    // Partitions below this size are insertion sorted by merge sort.
+    static ETL_CONSTANT size_t Merge_Sort_Insertion_Threshold = 16U;
+
+    //*********************************
+    // Sorts three elements.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+
+      if (compare(*c, *b))
+      {
+        etl::iter_swap(b, c);
+
+        if (compare(*b, *a))
+        {
+          etl::iter_swap(a, b);
+        }
+      }
+    }
+
+    //*********************************
+    // Insertion sort for random access iterators.
+    // Elements are shifted rather than rotated.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void straight_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        if (compare(*itr, *(itr - 1)))
+        {
+          value_t   value(ETL_MOVE(*itr));
+          TIterator hole = itr;
+
+          do
+          {
+            *hole = ETL_MOVE(*(hole - 1));
+            --hole;
+          } while ((hole != first) && compare(value, *(hole - 1)));
+
+          *hole = ETL_MOVE(value);
+        }
+      }
+    }
+
+    //*********************************
+    // Insertion sort that gives up if too many elements have to be moved.
+    // Returns true if the range was sorted.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    bool partial_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      difference_t moves = 0;
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        if (compare(*itr, *(itr - 1)))
+        {
+          value_t   value(ETL_MOVE(*itr));
+          TIterator hole = itr;
+
+          do
+          {
+            *hole = ETL_MOVE(*(hole - 1));
+            --hole;
+          } while ((hole != first) && compare(value, *(hole - 1)));
+
+          *hole = ETL_MOVE(value);
+
+          moves += (itr - hole);
+
+          if (moves > difference_t(Intro_Sort_Partial_Insertion_Limit))
+          {
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    //*********************************
+    // Heap sort for the introsort fallback.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void sift_down(TIterator first, typename etl::iterator_traits<TIterator>::difference_type root, typename etl::iterator_traits<TIterator>::difference_type length, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t child = (2 * root) + 1;
+
+      while (child < length)
+      {
+        if (((child + 1) < length) && compare(*(first + child), *(first + child + 1)))
+        {
+          ++child;
+        }
+
+        if (!compare(*(first + root), *(first + child)))
+        {
+          return;
+        }
+
+        etl::iter_swap(first + root, first + child);
+        root  = child;
+        child = (2 * root) + 1;
+      }
+    }
+
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void intro_sort_heap_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      for (difference_t root = (length / 2) - 1; root >= 0; --root)
+      {
+        sift_down(first, root, length, compare);
+      }
+
+      for (difference_t end = length - 1; end > 0; --end)
+      {
+        etl::iter_swap(first, first + end);
+        sift_down(first, difference_t(0), end, compare);
+      }
+    }
+
+    //*********************************
+    // Partitions around the pivot at 'first'.
+    // Elements equal to the pivot go to the right.
+    // Returns the final position of the pivot, and whether the range was already partitioned.
+    // Relies on there being an element not less than the pivot in the range.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator, bool> partition_right(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot(ETL_MOVE(*first));
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      // Find the first element not less than the pivot.
+      while (compare(*++left, pivot))
+      {
+      }
+
+      // Find the last element less than the pivot.
+      if ((left - 1) == first)
+      {
+        while ((left < right) && !compare(*--right, pivot))
+        {
+        }
+      }
+      else
+      {
+        // Guarded by the element before 'left'.
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (left >= right);
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(*++left, pivot))
+        {
+        }
+
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = left - 1;
+      *first          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return ETL_OR_STD::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*********************************
+    // Partitions around the pivot at 'first'.
+    // Elements equal to the pivot go to the left.
+    // Used when the pivot is equal to the element before the range, as no
+    // element in the range can then be less than the pivot.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    TIterator partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot(ETL_MOVE(*first));
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      while (compare(pivot, *--right))
+      {
+      }
+
+      if ((right + 1) == last)
+      {
+        while ((left < right) && !compare(pivot, *++left))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(pivot, *--right))
+        {
+        }
+
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      *first = ETL_MOVE(*right);
+      *right = ETL_MOVE(pivot);
+
+      return right;
+    }
+
+    //*********************************
+    // Swaps elements to break up patterns that caused an unbalanced partition.
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    void break_patterns(TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      if (length >= difference_t(Intro_Sort_Insertion_Threshold))
+      {
+        const difference_t quarter = length / 4;
+
+        etl::iter_swap(first,    first + quarter);
+        etl::iter_swap(last - 1, last - quarter);
+
+        if (length > difference_t(Intro_Sort_Ninther_Threshold))
+        {
+          etl::iter_swap(first + 1, first + (quarter + 1));
+          etl::iter_swap(first + 2, first + (quarter + 2));
+          etl::iter_swap(last - 2,  last - (quarter + 1));
+          etl::iter_swap(last - 3,  last - (quarter + 2));
+        }
+      }
+    }
+
+    //*********************************
+    // The pattern defeating introsort loop.
+    // Recurses on the smaller partition, so the stack depth is O(log n).
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void intro_sort_loop(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      while (true)
+      {
+        const difference_t length = last - first;
+
+        if (length < difference_t(Intro_Sort_Insertion_Threshold))
+        {
+          straight_insertion_sort(first, last, compare);
+          return;
+        }
+
+        // Choose the pivot and move it to 'first'.
+        const difference_t half = length / 2;
+
+        if (length > difference_t(Intro_Sort_Ninther_Threshold))
+        {
+          sort3(first,            first + half,       last - 1, compare);
+          sort3(first + 1,        first + (half - 1), last - 2, compare);
+          sort3(first + 2,        first + (half + 1), last - 3, compare);
+          sort3(first + (half - 1), first + half,     first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          sort3(first + half, first, last - 1, compare);
+        }
+
+        // If the pivot equals the element before this range, then all of the
+        // equal elements can be put to the left and skipped.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        ETL_OR_STD::pair<TIterator, bool> result = partition_right(first, last, compare);
+
+        TIterator  pivot_position      = result.first;
+        const bool already_partitioned = result.second;
+
+        const difference_t left_length  = pivot_position - first;
+        const difference_t right_length = last - (pivot_position + 1);
+
+        if ((left_length < (length / 8)) || (right_length < (length / 8)))
+        {
+          // Too many unbalanced partitions. Fall back to heap sort.
+          if (--bad_allowed == 0)
+          {
+            intro_sort_heap_sort(first, last, compare);
+            return;
+          }
+
+          break_patterns(first, pivot_position);
+          break_patterns(pivot_position + 1, last);
+        }
+        else if (already_partitioned)
+        {
+          // The range may be nearly sorted.
+          if (partial_insertion_sort(first, pivot_position, compare) &&
+              partial_insertion_sort(pivot_position + 1, last, compare))
+          {
+            return;
+          }
+        }
+
+        if (left_length < right_length)
+        {
+          intro_sort_loop(first, pivot_position, compare, bad_allowed, leftmost);
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          intro_sort_loop(pivot_position + 1, last, compare, bad_allowed, false);
+          last = pivot_position;
+        }
+      }
+    }
+
+    //*********************************
+    // Merges two consecutive sorted ranges without a buffer.
+    template <typename TIterator, typename TDistance, typename TCompare>
+    ETL_CONSTEXPR14
+    void merge_in_place(TIterator first, TIterator middle, TIterator last, TDistance length1, TDistance length2, TCompare compare)
+    {
+      while ((length1 != 0) && (length2 != 0))
+      {
+        if ((length1 + length2) == 2)
+        {
+          if (compare(*middle, *first))
+          {
+            etl::iter_swap(first, middle);
+          }
+
+          return;
+        }
+
+        TIterator first_cut  = first;
+        TIterator second_cut = middle;
+        TDistance length11   = 0;
+        TDistance length22   = 0;
+
+        if (length1 > length2)
+        {
+          length11 = length1 / 2;
+          etl::advance(first_cut, length11);
+          second_cut = etl::lower_bound(middle, last, *first_cut, compare);
+          length22   = static_cast<TDistance>(etl::distance(middle, second_cut));
+        }
+        else
+        {
+          length22 = length2 / 2;
+          etl::advance(second_cut, length22);
+          first_cut = etl::upper_bound(first, middle, *second_cut, compare);
+          length11  = static_cast<TDistance>(etl::distance(first, first_cut));
+        }
+
+        TIterator new_middle = first_cut;
+
+        if ((first_cut != middle) && (middle != second_cut))
+        {
+          new_middle = etl::rotate(first_cut, middle, second_cut);
+        }
+        else if (first_cut == middle)
+        {
+          new_middle = second_cut;
+        }
+
+        // Recurse on the smaller part.
+        if ((length11 + length22) < ((length1 - length11) + (length2 - length22)))
+        {
+          merge_in_place(first, first_cut, new_middle, length11, length22, compare);
+          first   = new_middle;
+          middle  = second_cut;
+          length1 = length1 - length11;
+          length2 = length2 - length22;
+        }
+        else
+        {
+          merge_in_place(new_middle, second_cut, last, length1 - length11, length2 - length22, compare);
+          last    = new_middle;
+          middle  = first_cut;
+          length1 = length11;
+          length2 = length22;
+        }
+      }
+    }
+
+    //*********************************
+    // Merges two consecutive sorted ranges.
+    // The first range is moved to the buffer if it fits, otherwise the ranges are merged in place.
+    template <typename TIterator, typename TDistance, typename TBufferIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void merge_adaptive(TIterator first, TIterator middle, TIterator last, TDistance length1, TDistance length2, TBufferIterator buffer, TDistance buffer_length, TCompare compare)
+    {
+      if (length1 > buffer_length)
+      {
+        merge_in_place(first, middle, last, length1, length2, compare);
+        return;
+      }
+
+      TBufferIterator buffer_end = buffer;
+
+      for (TIterator itr = first; itr != middle; ++itr)
+      {
+        *buffer_end = ETL_MOVE(*itr);
+        ++buffer_end;
+      }
+
+      TIterator output = first;
+
+      // Take from the buffer first for equal elements, to keep the sort stable.
+      while ((buffer != buffer_end) && (middle != last))
+      {
+        if (compare(*middle, *buffer))
+        {
+          *output = ETL_MOVE(*middle);
+          ++middle;
+        }
+        else
+        {
+          *output = ETL_MOVE(*buffer);
+          ++buffer;
+        }
+
+        ++output;
+      }
+
+      while (buffer != buffer_end)
+      {
+        *output = ETL_MOVE(*buffer);
+        ++buffer;
+        ++output;
+      }
+    }
+
+    //*********************************
+    // Recursive merge sort.
+    template <typename TIterator, typename TDistance, typename TBufferIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void merge_sort(TIterator first, TIterator last, TDistance length, TBufferIterator buffer, TDistance buffer_length, TCompare compare)
+    {
+      if (length <= TDistance(Merge_Sort_Insertion_Threshold))
+      {
+        etl::insertion_sort(first, last, compare);
+        return;
+      }
+
+      const TDistance length1 = length / 2;
+      const TDistance length2 = length - length1;
+
+      TIterator middle = first;
+      etl::advance(middle, length1);
+
+      merge_sort(first, middle, length1, buffer, buffer_length, compare);
+      merge_sort(middle, last,  length2, buffer, buffer_length, compare);
+
+      // Already in order?
+      TIterator before_middle = first;
+      etl::advance(before_middle, length1 - 1);
+
+      if (compare(*middle, *before_middle))
+      {
+        merge_adaptive(first, middle, last, length1, length2, buffer, buffer_length, compare);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a pattern defeating introsort.
+  /// O(N log N), not stable, and uses no additional memory.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = last - first;
+
+    if (length < 2)
+    {
+      return;
+    }
+
+    // The number of unbalanced partitions allowed before falling back to heap sort.
+    int bad_allowed = 0;
+
+    while (length > 0)
+    {
+      ++bad_allowed;
+      length /= 2;
+    }
+
+    private_algorithm::intro_sort_loop(first, last, compare, bad_allowed, true);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a pattern defeating introsort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable. Merges in place, so O(N log^2 N), but uses no additional memory.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    private_algorithm::merge_sort(first, last, etl::distance(first, last), static_cast<typename etl::iterator_traits<TIterator>::value_type*>(ETL_NULLPTR), difference_t(0), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable. Merges in place, so O(N log^2 N), but uses no additional memory.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14
+  void merge_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort, with a user supplied buffer.
+  /// Stable. O(N log N) if the buffer can hold at least half of the elements.
+  /// Merges that do not fit in the buffer are done in place.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    const difference_t buffer_length = static_cast<difference_t>(etl::distance(buffer_first, buffer_last));
+
+    private_algorithm::merge_sort(first, last, etl::distance(first, last), buffer_first, buffer_length, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort, with a user supplied buffer.
+  /// Stable. O(N log N) if the buffer can hold at least half of the elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  ETL_CONSTEXPR14
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
@@ -119,6 +119,7 @@ namespace etl
 
     //*************************************************************************
     /// Decode from Base64
+    /// Whole blocks of characters are decoded directly to the output.
     //*************************************************************************
     template <typename TInputIterator>
     ETL_CONSTEXPR14
@@ -126,11 +127,23 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
+      while (input_length != 0)
       {
-        if (!decode(*input_begin++))
+        if ((input_length >= 4U) && (input_buffer_length == 0U) && !padding_received && ((output_buffer_max_size - output_buffer_length) >= 3U))
         {
-          return false;
+          if (!decode_blocks(input_begin, input_length))
+          {
+            return false;
+          }
+        }
+        else
+        {
+          if (!decode(*input_begin++))
+          {
+            return false;
+          }
+
+          --input_length;
         }
       }
 
@@ -342,6 +355,22 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Translates a character into its sextet value.
+    // Returns 64 if the character is not in the character set. The decoder
+    // table covers all of the character sets, so the result is checked
+    // against the encoder table.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    uint32_t get_sextet(T character) const
+    {
+      const uint32_t c      = static_cast<unsigned char>(character);
+      const uint32_t sextet = static_cast<unsigned char>(decoder_table()[c]);
+
+      return (static_cast<unsigned char>(encoder_table[sextet & 0x3F]) == c) ? sextet : 64U;
+    }
+
     //*************************************************************************
     // Translates a sextet into an index 
     //*************************************************************************
@@ -349,12 +378,11 @@ namespace etl
     ETL_CONSTEXPR14
     uint32_t get_index_from_sextet(T sextet)
     {
-      const char* encoder_table_end = encoder_table + 64;
-      const char* p_sextet = etl::find(encoder_table, encoder_table_end, static_cast<char>(sextet));
+      const uint32_t index = get_sextet(sextet);
 
-      if (p_sextet != encoder_table_end)
+      if (index < 64U)
       {
-        return static_cast<uint32_t>(etl::distance(encoder_table, p_sextet));
+        return index;
       }
       else
       {
@@ -363,6 +391,63 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Decode as many whole blocks as the input and output buffer allow, when
+    /// the input buffer is empty. Valid blocks are written straight to the
+    /// output. A block containing anything else, padding or invalid characters,
+    /// is passed through decode() one character at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    bool decode_blocks(TInputIterator& input_begin, size_t& input_length)
+    {
+      typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+      const size_t n_blocks = etl::min(input_length / 4U, (output_buffer_max_size - output_buffer_length) / 3U);
+
+      // Use a local copy, so that the stores cannot alias the members.
+      unsigned char* p_output = p_output_buffer + output_buffer_length;
+
+      for (size_t i = 0U; i < n_blocks; ++i)
+      {
+        const value_type c0 = *input_begin++;
+        const value_type c1 = *input_begin++;
+        const value_type c2 = *input_begin++;
+        const value_type c3 = *input_begin++;
+
+        input_length -= 4U;
+
+        const uint32_t s0 = get_sextet(c0);
+        const uint32_t s1 = get_sextet(c1);
+        const uint32_t s2 = get_sextet(c2);
+        const uint32_t s3 = get_sextet(c3);
+
+        if (((s0 | s1 | s2 | s3) & 0x40U) != 0U)
+        {
+          output_buffer_length = static_cast<size_t>(p_output - p_output_buffer);
+
+          return decode(c0) && decode(c1) && decode(c2) && decode(c3);
+        }
+
+        const uint32_t sextets = (s0 << 18) | (s1 << 12) | (s2 << 6) | s3;
+
+        p_output[0] = static_cast<unsigned char>(sextets >> 16);
+        p_output[1] = static_cast<unsigned char>(sextets >> 8);
+        p_output[2] = static_cast<unsigned char>(sextets >> 0);
+        p_output += 3;
+      }
+
+      output_buffer_length = static_cast<size_t>(p_output - p_output_buffer);
+
+      if (callback.is_valid() && output_buffer_is_full())
+      {
+        callback(span());
+        reset_output_buffer();
+      }
+
+      return !error();
+    }
+
     //*************************************************************************
     /// Gets the padding character
     //*************************************************************************
@@ -97,6 +97,7 @@ namespace etl
 
     //*************************************************************************
     /// Encode to Base64
+    /// Whole blocks of octets are encoded directly to the output.
     //*************************************************************************
     template <typename TInputIterator>
     ETL_CONSTEXPR14
@@ -104,11 +105,20 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
+      while (input_length != 0)
       {
-        if (!encode(*input_begin++))
+        if ((input_length >= 3U) && (input_buffer_length == 0U) && ((output_buffer_max_size - output_buffer_length) >= 4U))
         {
-          return false;
+          input_length -= encode_blocks(input_begin, input_length);
+        }
+        else
+        {
+          if (!encode(*input_begin++))
+          {
+            return false;
+          }
+
+          --input_length;
         }
       }
 
@@ -417,6 +427,44 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Encode as many whole blocks as the input and output buffer allow, when
+    /// the input buffer is empty. Returns the number of octets consumed.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    size_t encode_blocks(TInputIterator& input_begin, size_t input_length)
+    {
+      const size_t n_blocks = etl::min(input_length / 3U, (output_buffer_max_size - output_buffer_length) / 4U);
+
+      // Use local copies, so that the stores cannot alias the members.
+      const char* table    = encoder_table;
+      char*       p_output = p_output_buffer + output_buffer_length;
+
+      for (size_t i = 0U; i < n_blocks; ++i)
+      {
+        uint32_t octets = static_cast<uint8_t>(*input_begin++);
+        octets = (octets << 8) | static_cast<uint8_t>(*input_begin++);
+        octets = (octets << 8) | static_cast<uint8_t>(*input_begin++);
+
+        p_output[0] = table[(octets >> 18) & 0x3F];
+        p_output[1] = table[(octets >> 12) & 0x3F];
+        p_output[2] = table[(octets >>  6) & 0x3F];
+        p_output[3] = table[(octets >>  0) & 0x3F];
+        p_output += 4;
+      }
+
+      output_buffer_length += n_blocks * 4U;
+
+      if (callback.is_valid() && output_buffer_is_full())
+      {
+        callback(span());
+        reset_output_buffer();
+      }
+
+      return n_blocks * 3U;
+    }
+
     //*************************************************************************
     // Push to the output buffer.
     //*************************************************************************
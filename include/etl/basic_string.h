@@ -47,6 +47,7 @@ SOFTWARE.
 #include "exception.h"
 #include "binary.h"
 #include "flags.h"
+#include "private/string_search.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -1379,16 +1380,7 @@ namespace etl
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_sequence(pos, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1405,16 +1397,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_sequence(pos, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1432,16 +1415,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_sequence(pos, s, n);
     }
 
     //*********************************************************************
@@ -1451,16 +1425,14 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const_pointer p = etl::private_string_search::memchr_char_finder::find(p_buffer + position, p_buffer + size(), c);
+
+      return (p != (p_buffer + size())) ? static_cast<size_type>(p - p_buffer) : npos;
     }
 
     //*********************************************************************
@@ -1480,18 +1452,7 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), str.rbegin(), str.rend());
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - str.size() - etl::distance(rbegin(), iposition);
-      }
+      return rfind_sequence(position, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1513,21 +1474,7 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - len - etl::distance(rbegin(), iposition);
-      }
+      return rfind_sequence(position, s, len);
     }
 
     //*********************************************************************
@@ -1547,21 +1494,7 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - length_ - etl::distance(rbegin(), iposition);
-      }
+      return rfind_sequence(position, s, length_);
     }
 
     //*********************************************************************
@@ -1576,18 +1509,9 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
-
-      const_reverse_iterator i = etl::find(rbegin() + position, rend(), c);
+      const_pointer p = etl::private_string_search::rfind_char(p_buffer, p_buffer + position, c);
 
-      if (i != rend())
-      {
-        return size() - etl::distance(rbegin(), i) - 1;
-      }
-      else
-      {
-        return npos;
-      }
+      return (p != (p_buffer + position)) ? static_cast<size_type>(p - p_buffer) : npos;
     }
 
     //*********************************************************************
@@ -1912,16 +1836,20 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
+      if (n == 1U)
+      {
+        return find_first_of(s[0], position);
+      }
+
       if (position < size())
       {
+        const etl::private_string_search::character_set<T> set(s, s + n);
+
         for (size_type i = position; i < size(); ++i)
         {
-          for (size_type j = 0; j < n; ++j)
+          if (set.contains(p_buffer[i]))
           {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
+            return i;
           }
         }
       }
@@ -1936,18 +1864,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1978,6 +1895,11 @@ namespace etl
     //*********************************************************************
     size_type find_last_of(const_pointer s, size_type position, size_type n) const
     {
+      if (n == 1U)
+      {
+        return find_last_of(s[0], position);
+      }
+
       if (empty())
       {
         return npos;
@@ -1985,16 +1907,15 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
+      const etl::private_string_search::character_set<T> set(s, s + n);
+
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        for (size_type j = 0; j < n; ++j)
+        if (set.contains(p_buffer[position]))
         {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
+          return position;
         }
 
         ++it;
@@ -2018,20 +1939,9 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
+      const_pointer p = etl::private_string_search::rfind_char(p_buffer, p_buffer + position + 1, c);
 
-      return npos;
+      return (p != (p_buffer + position + 1)) ? static_cast<size_type>(p - p_buffer) : npos;
     }
 
     //*********************************************************************
@@ -2064,19 +1974,11 @@ namespace etl
     {
       if (position < size())
       {
+        const etl::private_string_search::character_set<T> set(s, s + n);
+
         for (size_type i = position; i < size(); ++i)
         {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
+          if (!set.contains(p_buffer[i]))
           {
             return i;
           }
@@ -2142,21 +2044,13 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
+      const etl::private_string_search::character_set<T> set(s, s + n);
+
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
       {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
+        if (!set.contains(p_buffer[position]))
         {
           return position;
         }
@@ -2356,6 +2250,45 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Find a sequence of characters, starting at 'position'.
+    //*************************************************************************
+    size_type find_sequence(size_type position, const_pointer s, size_type length_) const
+    {
+      if (position > size())
+      {
+        return npos;
+      }
+
+      const_pointer p_end = p_buffer + size();
+      const_pointer p     = etl::private_string_search::search<etl::private_string_search::memchr_char_finder>(p_buffer + position, p_end, s, s + length_);
+
+      return (p != p_end) ? static_cast<size_type>(p - p_buffer) : npos;
+    }
+
+    //*************************************************************************
+    /// Find the last sequence of characters that ends before 'position'.
+    //*************************************************************************
+    size_type rfind_sequence(size_type position, const_pointer s, size_type length_) const
+    {
+      if (length_ > size())
+      {
+        return npos;
+      }
+
+      position = etl::min(position, size());
+
+      if (length_ == 0U)
+      {
+        return position;
+      }
+
+      const_pointer p_end = p_buffer + position;
+      const_pointer p     = etl::private_string_search::rsearch(p_buffer, p_end, s, s + length_);
+
+      return (p != p_end) ? static_cast<size_type>(p - p_buffer) : npos;
+    }
+
     //*************************************************************************
     /// Clear the unused trailing portion of the string.
     //*************************************************************************
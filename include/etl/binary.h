@@ -317,8 +317,10 @@ namespace etl
 
     ETL_ASSERT((NBITS <= etl::integral_limits<TReturn>::bits), ETL_ERROR(binary_out_of_range));
 
+    typedef typename etl::make_unsigned<TValue>::type unsigned_v_t;
+
     TReturn mask = TReturn(1) << (NBITS - 1);
-    value = value & TValue((TValue(1) << NBITS) - 1);
+    value = TValue(unsigned_v_t(value) & unsigned_v_t((unsigned_v_t(1) << NBITS) - 1U));
 
     return TReturn((value ^ mask) - mask);
   }
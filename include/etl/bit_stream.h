@@ -43,11 +43,200 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 #include "private/minmax_push.h"
 
 namespace etl
 {
+  namespace private_bit_stream
+  {
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_type;
+#else
+    typedef uint32_t word_type;
+#endif
+
+    //*************************************************************************
+    /// The most bits transferred as one word.
+    /// Leaves room for the bits already used in the current char.
+    //*************************************************************************
+    static ETL_CONSTANT uint_least8_t Max_Word_Bits = static_cast<uint_least8_t>((CHAR_BIT * sizeof(word_type)) - CHAR_BIT);
+
+    //*************************************************************************
+    /// Loads a word from the buffer, first char most significant.
+    //*************************************************************************
+    inline word_type load_word(const unsigned char* p)
+    {
+#if CHAR_BIT == 8
+      word_type word;
+      memcpy(&word, p, sizeof(word_type));
+
+      return etl::ntoh(word);
+#else
+      word_type word = 0U;
+
+      for (size_t i = 0U; i < sizeof(word_type); ++i)
+      {
+        word = (word << CHAR_BIT) | p[i];
+      }
+
+      return word;
+#endif
+    }
+
+    //*************************************************************************
+    /// Stores a word to the buffer, first char most significant.
+    //*************************************************************************
+    inline void store_word(unsigned char* p, word_type word)
+    {
+#if CHAR_BIT == 8
+      word = etl::hton(word);
+      memcpy(p, &word, sizeof(word_type));
+#else
+      for (size_t i = sizeof(word_type); i != 0U; --i)
+      {
+        p[i - 1U] = static_cast<unsigned char>(word);
+        word >>= CHAR_BIT;
+      }
+#endif
+    }
+
+    //*************************************************************************
+    /// Writes the low 'nbits' bits of 'bits', most significant first, at the
+    /// current position. 'nbits' must not be more than Max_Word_Bits.
+    /// Unused bits in the last char written are cleared.
+    /// If there is a whole word of buffer left the bits are merged into a
+    /// single load and store, leaving the chars that follow unchanged,
+    /// otherwise the chars are written one at a time.
+    //*************************************************************************
+    inline void write_bits(unsigned char* pdata, size_t length_chars, size_t& char_index, unsigned char& bits_available_in_char, word_type bits, uint_least8_t nbits)
+    {
+      static ETL_CONSTANT unsigned int Word_Bits = CHAR_BIT * sizeof(word_type);
+
+      const unsigned int used  = CHAR_BIT - bits_available_in_char;
+      unsigned int       total = used + nbits;
+
+      unsigned char* p = pdata + char_index;
+
+      bits &= (word_type(1U) << nbits) - 1U;
+
+      if ((length_chars - char_index) >= sizeof(word_type))
+      {
+        // Replace the bits from the current position to the end of the last char written.
+        const unsigned int end  = ((total + CHAR_BIT - 1U) / CHAR_BIT) * CHAR_BIT;
+        const word_type    mask = ((word_type(1U) << (end - used)) - 1U) << (Word_Bits - end);
+
+        store_word(p, (load_word(p) & ~mask) | (bits << (Word_Bits - total)));
+      }
+      else
+      {
+        word_type word = (used == 0U) ? 0U : static_cast<word_type>(*p >> bits_available_in_char);
+        word = (word << nbits) | bits;
+
+        unsigned int remaining = total;
+
+        while (remaining >= CHAR_BIT)
+        {
+          remaining -= CHAR_BIT;
+          *p++ = static_cast<unsigned char>(word >> remaining);
+        }
+
+        if (remaining != 0U)
+        {
+          *p = static_cast<unsigned char>(word << (CHAR_BIT - remaining));
+        }
+      }
+
+      char_index            += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+    }
+
+    //*************************************************************************
+    /// Reads 'nbits' bits from the current position, most significant first.
+    /// 'nbits' must not be more than Max_Word_Bits.
+    /// If there is a whole word of buffer left it is read with a single load,
+    /// otherwise the chars are read one at a time.
+    //*************************************************************************
+    inline word_type read_bits(const unsigned char* pdata, size_t length_chars, size_t& char_index, unsigned char& bits_available_in_char, uint_least8_t nbits)
+    {
+      static ETL_CONSTANT unsigned int Word_Bits = CHAR_BIT * sizeof(word_type);
+
+      const unsigned int used  = CHAR_BIT - bits_available_in_char;
+      const unsigned int total = used + nbits;
+
+      const unsigned char* p = pdata + char_index;
+
+      word_type word;
+
+      if ((length_chars - char_index) >= sizeof(word_type))
+      {
+        word = load_word(p) >> (Word_Bits - total);
+      }
+      else
+      {
+        const unsigned int chars = (total + CHAR_BIT - 1U) / CHAR_BIT;
+
+        word = 0U;
+
+        for (unsigned int i = 0U; i < chars; ++i)
+        {
+          word = (word << CHAR_BIT) | p[i];
+        }
+
+        word >>= (chars * CHAR_BIT) - total;
+      }
+
+      char_index            += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+
+      return word & ((word_type(1U) << nbits) - 1U);
+    }
+
+    //*************************************************************************
+    /// Writes a value of any width, most significant bits first.
+    /// A zero width value writes nothing.
+    //*************************************************************************
+    inline void write_value(unsigned char* pdata, size_t length_chars, size_t& char_index, unsigned char& bits_available_in_char, word_type value, uint_least8_t nbits)
+    {
+      if (nbits == 0U)
+      {
+        return;
+      }
+
+      if (nbits > Max_Word_Bits)
+      {
+        write_bits(pdata, length_chars, char_index, bits_available_in_char, value >> Max_Word_Bits, static_cast<uint_least8_t>(nbits - Max_Word_Bits));
+        nbits = Max_Word_Bits;
+      }
+
+      write_bits(pdata, length_chars, char_index, bits_available_in_char, value, nbits);
+    }
+
+    //*************************************************************************
+    /// Reads a value of any width, most significant bits first.
+    /// A zero width value reads nothing and is zero.
+    //*************************************************************************
+    inline word_type read_value(const unsigned char* pdata, size_t length_chars, size_t& char_index, unsigned char& bits_available_in_char, uint_least8_t nbits)
+    {
+      word_type value = 0U;
+
+      if (nbits == 0U)
+      {
+        return value;
+      }
+
+      if (nbits > Max_Word_Bits)
+      {
+        value  = read_bits(pdata, length_chars, char_index, bits_available_in_char, static_cast<uint_least8_t>(nbits - Max_Word_Bits));
+        value <<= Max_Word_Bits;
+        nbits  = Max_Word_Bits;
+      }
+
+      return value | read_bits(pdata, length_chars, char_index, bits_available_in_char, nbits);
+    }
+  }
+
   //***************************************************************************
   /// Encodes and decodes bitstreams.
   /// Data must be stored in the stream in network order.
@@ -230,19 +419,9 @@ namespace etl
         // Do we have enough bits?
         if (bits_available >= nbits)
         {
-          value = 0;
-
           // Get the bits from the stream.
-          while (nbits != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-            
-            typedef typename etl::make_unsigned<T>::type chunk_t;           
-            chunk_t chunk = get_chunk(mask_width);
-
-            nbits -= mask_width;
-            value |= static_cast<T>(chunk << nbits);
-          }
+          value = static_cast<T>(private_bit_stream::read_value(pdata, length_chars, char_index, bits_available_in_char, nbits));
+          bits_available -= nbits;
 
           success = true;
         }
@@ -346,19 +525,8 @@ namespace etl
         if (bits_available >= nbits)
         {
           // Send the bits to the stream.
-          while (nbits != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-            nbits -= mask_width;
-            uint32_t mask = ((1U << mask_width) - 1U) << nbits;
-            //uint32_t mask = ((uint32_t(1U) << mask_width) - 1U) << nbits;
-
-            // Move chunk to lowest char bits.
-            // Chunks are never larger than one char.
-            uint32_t chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
-
-            put_chunk(static_cast<unsigned char>(chunk), mask_width);
-          }
+          private_bit_stream::write_value(pdata, length_chars, char_index, bits_available_in_char, value, nbits);
+          bits_available -= nbits;
 
           success = true;
         }
@@ -381,18 +549,8 @@ namespace etl
         if (bits_available >= nbits)
         {
           // Send the bits to the stream.
-          while (nbits != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-            nbits -= mask_width;
-            uint64_t mask = ((uint64_t(1U) << mask_width) - 1U) << nbits;
-
-            // Move chunk to lowest char bits.
-            // Chunks are never larger than one char.
-            uint64_t chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
-
-            put_chunk(static_cast<unsigned char>(chunk), mask_width);
-          }
+          private_bit_stream::write_value(pdata, length_chars, char_index, bits_available_in_char, value, nbits);
+          bits_available -= nbits;
 
           success = true;
         }
@@ -402,48 +560,6 @@ namespace etl
     }
 #endif
 
-    //***************************************************************************
-    /// Put a data chunk to the stream
-    //***************************************************************************
-    void put_chunk(unsigned char chunk, unsigned char nbits)
-    {
-      // Clear if new byte.
-      if (bits_available_in_char == 8U)
-      {
-        pdata[char_index] = 0U;
-      }
-
-      pdata[char_index] |= chunk;
-      step(nbits);
-    }
-
-    //***************************************************************************
-    /// Get a data chunk from the stream
-    //***************************************************************************
-    unsigned char get_chunk(unsigned char nbits)
-    {
-      unsigned char value = pdata[char_index];
-
-      value >>= (bits_available_in_char - nbits);
-
-      unsigned char mask;
-
-      if (nbits == CHAR_BIT)
-      {
-        mask = etl::integral_limits<unsigned char>::max;
-      }
-      else
-      {
-        mask = (1U << nbits) - 1;
-      }
-
-      value &= mask;
-
-      step(nbits);
-
-      return value;
-    }
-
     //***************************************************************************
     /// Get a bool from the stream
     //***************************************************************************
@@ -676,6 +792,39 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Writes a span of integral values, each using nbits.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, typename etl::remove_cv<T>::type>::value, void>::type
+      write_unchecked(const etl::span<T, Extent>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<typename etl::remove_cv<T>::type>::type unsigned_t;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        write_data<unsigned_t>(static_cast<unsigned_t>(values[i]), nbits);
+      }
+    }
+
+    //***************************************************************************
+    /// Writes a span of integral values, each using nbits.
+    /// Returns <b>false</b>, and writes nothing, if there is not enough space for all of them.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, typename etl::remove_cv<T>::type>::value, bool>::type
+      write(const etl::span<T, Extent>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      bool success = ((values.size() * etl::min(nbits, uint_least8_t(CHAR_BIT * sizeof(T)))) <= available_bits());
+
+      if (success)
+      {
+        write_unchecked(values, nbits);
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Skip n bits, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -888,24 +1037,17 @@ namespace etl
       // Make sure that we are not writing more bits than should be available.
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
-      if (stream_endianness == etl::endian::little)
-      {
-        value = etl::reverse_bits(value);
-        value = value >> ((CHAR_BIT * sizeof(T)) - nbits);
-      }
-
-      // Send the bits to the stream.
-      while (nbits != 0)
+      if (nbits != 0U)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-        nbits -= mask_width;
-        T mask = ((T(1U) << mask_width) - 1U) << nbits;
-
-        // Move chunk to lowest char bits.
-        // Chunks are never larger than one char.
-        T chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
+        if (stream_endianness == etl::endian::little)
+        {
+          value = etl::reverse_bits(value);
+          value = value >> ((CHAR_BIT * sizeof(T)) - nbits);
+        }
 
-        write_chunk(static_cast<char>(chunk), mask_width);
+        // Send the bits to the stream, a word at a time.
+        private_bit_stream::write_value(reinterpret_cast<unsigned char*>(pdata), length_chars, char_index, bits_available_in_char, value, nbits);
+        bits_available -= nbits;
       }
 
       if (callback.is_valid())
@@ -914,21 +1056,6 @@ namespace etl
       }
     }
 
-    //***************************************************************************
-    /// Write a data chunk to the stream
-    //***************************************************************************
-    void write_chunk(char chunk, unsigned char nbits)
-    {
-      // Clear if new byte.
-      if (bits_available_in_char == CHAR_BIT)
-      {
-        pdata[char_index] = 0U;
-      }
-
-      pdata[char_index] |= chunk;
-      step(nbits);
-    }
-
     //***************************************************************************
     /// Flush full bytes to the callback, if valid.
     /// Resets the stream to empty or the last unfilled byte.
@@ -1170,6 +1297,39 @@ namespace etl
       return result;
     }
 
+    //***************************************************************************
+    /// Reads a span of integral values, each using nbits.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, void>::type
+      read_unchecked(const etl::span<T, Extent>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = static_cast<T>(read_value<unsigned_t>(nbits, etl::is_signed<T>::value));
+      }
+    }
+
+    //***************************************************************************
+    /// Reads a span of integral values, each using nbits.
+    /// Returns <b>false</b>, and reads nothing, if there are not enough bits for all of them.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, bool>::type
+      read(const etl::span<T, Extent>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      bool success = ((values.size() * etl::min(nbits, uint_least8_t(CHAR_BIT * sizeof(T)))) <= bits_available);
+
+      if (success)
+      {
+        read_unchecked(values, nbits);
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Returns the number of bytes in the stream buffer.
     //***************************************************************************
@@ -1264,57 +1424,26 @@ namespace etl
       // Make sure that we are not reading more bits than should be available.
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
-      T value = 0;
-      uint_least8_t bits = nbits;
-
-      // Get the bits from the stream.
-      while (nbits != 0)
+      if (nbits == 0U)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-
-        T chunk = get_chunk(mask_width);
-
-        nbits -= mask_width;
-        value |= static_cast<T>(chunk << nbits);
+        return T(0);
       }
 
+      // Get the bits from the stream, a word at a time.
+      T value = static_cast<T>(private_bit_stream::read_value(reinterpret_cast<const unsigned char*>(pdata), length_chars, char_index, bits_available_in_char, nbits));
+      bits_available -= nbits;
+
       if (stream_endianness == etl::endian::little)
       {
-        value = value << ((CHAR_BIT * sizeof(T)) - bits);
+        value = value << ((CHAR_BIT * sizeof(T)) - nbits);
         value = etl::reverse_bits(value);
       }
 
-      if (is_signed && (bits != (CHAR_BIT * sizeof(T))))
-      {
-        value = etl::sign_extend<T, T>(value, bits);
-      }
-
-      return value;
-    }
-
-    //***************************************************************************
-    /// Get a data chunk from the stream
-    //***************************************************************************
-    unsigned char get_chunk(unsigned char nbits)
-    {
-      unsigned char value = pdata[char_index];
-      value >>= (bits_available_in_char - nbits);
-
-      unsigned char mask;
-
-      if (nbits == CHAR_BIT)
-      {
-        mask = etl::integral_limits<unsigned char>::max;
-      }
-      else
+      if (is_signed && (nbits != (CHAR_BIT * sizeof(T))))
       {
-        mask = (1U << nbits) - 1;
+        value = etl::sign_extend<T, T>(value, nbits);
       }
 
-      value &= mask;
-
-      step(nbits);
-
       return value;
     }
 
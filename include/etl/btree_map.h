@@ -0,0 +1,682 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "initializer_list.h"
+#include "nth_type.h"
+#include "private/btree_base.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map based on a B+tree with the capacity defined at compile time.
+/// Values are held in order in leaf nodes of several cache lines, so lookups
+/// touch fewer cache lines than a binary tree and in order traversal is a
+/// linear walk along the leaves.
+/// Unlike etl::map, inserting or erasing an element may move other elements
+/// between nodes. Insertion and erasure invalidate all iterators, pointers and
+/// references to elements of the container.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_exception : public etl::exception
+  {
+  public:
+
+    btree_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_full : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:full", ETL_BTREE_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_out_of_bounds : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:bounds", ETL_BTREE_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for btree_maps of a given type.
+  /// Can be used as a reference type for all btree_maps containing a specific type.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map : public etl::private_btree::ibtree<TKey,
+                                                       ETL_OR_STD::pair<const TKey, TMapped>,
+                                                       TKeyCompare,
+                                                       etl::private_btree::key_is_first<TKey, ETL_OR_STD::pair<const TKey, TMapped> >,
+                                                       ETL_OR_STD::pair<const TKey, TMapped> >
+  {
+  private:
+
+    typedef etl::private_btree::ibtree<TKey,
+                                       ETL_OR_STD::pair<const TKey, TMapped>,
+                                       TKeyCompare,
+                                       etl::private_btree::key_is_first<TKey, ETL_OR_STD::pair<const TKey, TMapped> >,
+                                       ETL_OR_STD::pair<const TKey, TMapped> > base_t;
+
+  public:
+
+    typedef TKey                                 key_type;
+    typedef TMapped                              mapped_type;
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKeyCompare                          key_compare;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&                         rvalue_reference;
+#endif
+    typedef value_type*                          pointer;
+    typedef const value_type*                    const_pointer;
+    typedef size_t                               size_type;
+
+    typedef const key_type&                      const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&                           rvalue_key_reference;
+#endif
+    typedef mapped_type&                         mapped_reference;
+    typedef const mapped_type&                   const_mapped_reference;
+
+    typedef typename base_t::iterator               iterator;
+    typedef typename base_t::const_iterator         const_iterator;
+    typedef typename base_t::reverse_iterator       reverse_iterator;
+    typedef typename base_t::const_reverse_iterator const_reverse_iterator;
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator ()(const_reference lhs, const_reference rhs) const
+      {
+        return key_compare()(lhs.first, rhs.first);
+      }
+    };
+
+    //*************************************************************************
+    /// Returns a reference to the value at the key.
+    /// Inserts a default constructed value if the key does not exist.
+    //*************************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        ETL_ASSERT(!this->full(), ETL_ERROR(btree_map_full));
+
+        ::new (this->make_slot(key)) value_type(key, mapped_type());
+        i_element = this->last_slot();
+      }
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Returns a reference to the value at the key.
+    /// Inserts a default constructed value if the key does not exist.
+    //*************************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        ETL_ASSERT(!this->full(), ETL_ERROR(btree_map_full));
+
+        ::new (this->make_slot(key)) value_type(etl::move(key), mapped_type());
+        i_element = this->last_slot();
+      }
+
+      return i_element->second;
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns a reference to the value at the key.
+    /// Emits a btree_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at the key.
+    /// Emits a btree_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*************************************************************************
+    /// Assigns values to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      iterator i_element = this->find(value.first);
+
+      if (i_element != this->end())
+      {
+        return ETL_OR_STD::make_pair(i_element, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(btree_map_full), ETL_OR_STD::make_pair(this->end(), false));
+
+      ::new (this->make_slot(value.first)) value_type(value);
+
+      return ETL_OR_STD::make_pair(this->last_slot(), true);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      iterator i_element = this->find(value.first);
+
+      if (i_element != this->end())
+      {
+        return ETL_OR_STD::make_pair(i_element, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(btree_map_full), ETL_OR_STD::make_pair(this->end(), false));
+
+      ::new (this->make_slot(value.first)) value_type(etl::move(value));
+
+      return ETL_OR_STD::make_pair(this->last_slot(), true);
+    }
+#endif
+
+    //*************************************************************************
+    /// Inserts a value to the map.
+    /// The position hint is ignored.
+    ///\param value The value to insert.
+    ///\return An iterator to the element.
+    //*************************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value to the map.
+    /// The position hint is ignored.
+    ///\param value The value to insert.
+    ///\return An iterator to the element.
+    //*************************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    template <typename ... TArgs>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, TArgs&& ... args)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element != this->end())
+      {
+        return ETL_OR_STD::make_pair(i_element, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(btree_map_full), ETL_OR_STD::make_pair(this->end(), false));
+
+      ::new (this->make_slot(key)) value_type(key, mapped_type(etl::forward<TArgs>(args)...));
+
+      return ETL_OR_STD::make_pair(this->last_slot(), true);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const mapped_type& value)
+    {
+      return insert(value_type(key, value));
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the value comparison functor.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator =(const ibtree_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_map& operator =(ibtree_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    typedef typename base_t::leaf_node  leaf_node;
+    typedef typename base_t::inner_node inner_node;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(leaf_node* p_leaves_, size_t n_leaves_, inner_node* p_inners_, size_t n_inners_, size_t max_size_)
+      : base_t(p_leaves_, n_leaves_, p_inners_, n_inners_, max_size_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another map into this one.
+    //*************************************************************************
+    void move_container(ibtree_map&& rhs)
+    {
+      this->clear();
+
+      iterator from = rhs.begin();
+
+      while (from != rhs.end())
+      {
+        insert(etl::move(*from));
+        ++from;
+      }
+
+      rhs.clear();
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A B+tree map with the capacity defined at compile time.
+  ///\ingroup btree_map
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam MAX_SIZE_   The maximum number of elements.
+  ///\tparam TKeyCompare The key comparison functor.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TMapped, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TMapped, TKeyCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator =(const btree_map& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator =(btree_map&& rhs)
+    {
+      base_t::operator =(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    static ETL_CONSTANT size_t Leaf_Nodes  = base_t::template node_count<MAX_SIZE_>::leaves;
+    static ETL_CONSTANT size_t Inner_Nodes = base_t::template node_count<MAX_SIZE_>::inners;
+
+    typename base_t::leaf_node  leaves[Leaf_Nodes];  ///< The leaf node storage.
+    typename base_t::inner_node inners[Inner_Nodes]; ///< The inner node storage.
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TMapped, MAX_SIZE_, TKeyCompare>::MAX_SIZE;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TMapped, MAX_SIZE_, TKeyCompare>::Leaf_Nodes;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TMapped, MAX_SIZE_, TKeyCompare>::Inner_Nodes;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  btree_map(TPairs...) -> btree_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                    typename etl::nth_type_t<0, TPairs...>::second_type,
+                                    sizeof...(TPairs)>;
+#endif
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first map is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //***************************************************************************
+  /// Greater than operator.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //***************************************************************************
+  /// Less than or equal operator.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //***************************************************************************
+  /// Greater than or equal operator.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,536 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "initializer_list.h"
+#include "nth_type.h"
+#include "private/btree_base.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set based on a B+tree with the capacity defined at compile time.
+/// Keys are held in order in leaf nodes of several cache lines, so lookups
+/// touch fewer cache lines than a binary tree and in order traversal is a
+/// linear walk along the leaves.
+/// Unlike etl::set, inserting or erasing an element may move other elements
+/// between nodes. Insertion and erasure invalidate all iterators, pointers and
+/// references to elements of the container.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_exception : public etl::exception
+  {
+  public:
+
+    btree_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_full : public etl::btree_set_exception
+  {
+  public:
+
+    btree_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_set_exception(ETL_ERROR_TEXT("btree_set:full", ETL_BTREE_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for btree_sets of a given type.
+  /// Can be used as a reference type for all btree_sets containing a specific type.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_set : public etl::private_btree::ibtree<TKey, TKey, TKeyCompare, etl::private_btree::key_is_value<TKey>, const TKey>
+  {
+  private:
+
+    typedef etl::private_btree::ibtree<TKey, TKey, TKeyCompare, etl::private_btree::key_is_value<TKey>, const TKey> base_t;
+
+  public:
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename base_t::iterator               iterator;
+    typedef typename base_t::const_iterator         const_iterator;
+    typedef typename base_t::reverse_iterator       reverse_iterator;
+    typedef typename base_t::const_reverse_iterator const_reverse_iterator;
+
+    //*************************************************************************
+    /// Assigns values to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      iterator i_element = this->find(value);
+
+      if (i_element != this->end())
+      {
+        return ETL_OR_STD::make_pair(i_element, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(btree_set_full), ETL_OR_STD::make_pair(this->end(), false));
+
+      ::new (this->make_slot(value)) value_type(value);
+
+      return ETL_OR_STD::make_pair(this->last_slot(), true);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      iterator i_element = this->find(value);
+
+      if (i_element != this->end())
+      {
+        return ETL_OR_STD::make_pair(i_element, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(btree_set_full), ETL_OR_STD::make_pair(this->end(), false));
+
+      ::new (this->make_slot(value)) value_type(etl::move(value));
+
+      return ETL_OR_STD::make_pair(this->last_slot(), true);
+    }
+#endif
+
+    //*************************************************************************
+    /// Inserts a value to the set.
+    /// The position hint is ignored.
+    ///\param value The value to insert.
+    ///\return An iterator to the element.
+    //*************************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value to the set.
+    /// The position hint is ignored.
+    ///\param value The value to insert.
+    ///\return An iterator to the element.
+    //*************************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    template <typename ... TArgs>
+    ETL_OR_STD::pair<iterator, bool> emplace(TArgs&& ... args)
+    {
+      return insert(value_type(etl::forward<TArgs>(args)...));
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\return A pair of an iterator to the element and a flag that is true if the value was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const_reference value)
+    {
+      return insert(value);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the value comparison functor.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return this->compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_set& operator =(const ibtree_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_set& operator =(ibtree_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    typedef typename base_t::leaf_node  leaf_node;
+    typedef typename base_t::inner_node inner_node;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_set(leaf_node* p_leaves_, size_t n_leaves_, inner_node* p_inners_, size_t n_inners_, size_t max_size_)
+      : base_t(p_leaves_, n_leaves_, p_inners_, n_inners_, max_size_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another set into this one.
+    //*************************************************************************
+    void move_container(ibtree_set&& rhs)
+    {
+      this->clear();
+
+      iterator from = rhs.begin();
+
+      while (from != rhs.end())
+      {
+        insert(etl::move(const_cast<value_type&>(*from)));
+        ++from;
+      }
+
+      rhs.clear();
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_set()
+    {
+    }
+#else
+  protected:
+    ~ibtree_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A B+tree set with the capacity defined at compile time.
+  ///\ingroup btree_set
+  ///\tparam TKey        The key type.
+  ///\tparam MAX_SIZE_   The maximum number of elements.
+  ///\tparam TKeyCompare The key comparison functor.
+  //***************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TKeyCompare = etl::less<TKey> >
+  class btree_set : public etl::ibtree_set<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree_set<TKey, TKeyCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_set()
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_set(btree_set&& other)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaves, Leaf_Nodes, inners, Inner_Nodes, MAX_SIZE)
+    {
+      this->initialise();
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator =(const btree_set& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_set& operator =(btree_set&& rhs)
+    {
+      base_t::operator =(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    static ETL_CONSTANT size_t Leaf_Nodes  = base_t::template node_count<MAX_SIZE_>::leaves;
+    static ETL_CONSTANT size_t Inner_Nodes = base_t::template node_count<MAX_SIZE_>::inners;
+
+    typename base_t::leaf_node  leaves[Leaf_Nodes];  ///< The leaf node storage.
+    typename base_t::inner_node inners[Inner_Nodes]; ///< The inner node storage.
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TKeyCompare>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TKeyCompare>::Leaf_Nodes;
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TKeyCompare>::Inner_Nodes;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  btree_set(T...) -> btree_set<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator <(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //***************************************************************************
+  /// Greater than operator.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator >(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //***************************************************************************
+  /// Less than or equal operator.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator <=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //***************************************************************************
+  /// Greater than or equal operator.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator >=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
@@ -45,12 +45,106 @@ SOFTWARE.
 #include "delegate.h"
 #include "exception.h"
 #include "error_handler.h"
+#include "binary.h"
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 namespace etl
 {
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// Copies 'n' values of 'Size' bytes, reversing the bytes of each.
+    //*************************************************************************
+    template <size_t Size>
+    struct reversed_copy
+    {
+      static void copy(const char* source, char* destination, size_t n)
+      {
+        while (n-- != 0U)
+        {
+          etl::reverse_copy(source, source + Size, destination);
+          source      += Size;
+          destination += Size;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Copies 'n' values the size of TWord, reversing the bytes of each.
+    /// A simple loop of word sized byte swaps, which the compiler can vectorise.
+    //*************************************************************************
+    template <typename TWord>
+    struct reversed_word_copy
+    {
+      static void copy(const char* source, char* destination, size_t n)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          TWord word;
+          memcpy(&word, source + (i * sizeof(TWord)), sizeof(TWord));
+          word = etl::reverse_bytes(word);
+          memcpy(destination + (i * sizeof(TWord)), &word, sizeof(TWord));
+        }
+      }
+    };
+
+#if CHAR_BIT == 8
+    template <>
+    struct reversed_copy<2U> : public reversed_word_copy<uint16_t>
+    {
+    };
+
+    template <>
+    struct reversed_copy<4U> : public reversed_word_copy<uint32_t>
+    {
+    };
+
+  #if ETL_USING_64BIT_TYPES
+    template <>
+    struct reversed_copy<8U> : public reversed_word_copy<uint64_t>
+    {
+    };
+  #endif
+#endif
+
+    //*************************************************************************
+    /// Copies a value of 'Size' bytes, reversing the bytes if the stream and
+    /// platform endianness differ.
+    //*************************************************************************
+    template <size_t Size>
+    void copy_value(const char* source, char* destination, etl::endian stream_endianness)
+    {
+      if (stream_endianness == etl::endianness::value())
+      {
+        memcpy(destination, source, Size);
+      }
+      else
+      {
+        reversed_copy<Size>::copy(source, destination, 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies 'n' values of 'Size' bytes, reversing the bytes of each if the
+    /// stream and platform endianness differ.
+    //*************************************************************************
+    template <size_t Size>
+    void copy_values(const char* source, char* destination, size_t n, etl::endian stream_endianness)
+    {
+      if (stream_endianness == etl::endianness::value())
+      {
+        memcpy(destination, source, n * Size);
+      }
+      else
+      {
+        reversed_copy<Size>::copy(source, destination, n);
+      }
+    }
+  }
+
   //***************************************************************************
   /// Encodes a byte stream.
   //***************************************************************************
@@ -181,13 +275,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      to_bytes(range.data(), range.size());
     }
 
     //***************************************************************************
@@ -214,11 +302,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
-      {
-        to_bytes(*start);
-        ++start;
-      }
+      to_bytes(start, length);
     }
 
     //***************************************************************************
@@ -238,6 +322,64 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Write a range of T to the stream as one batch.
+    /// The callback is called once for the whole range, not once per value.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
+      write_batch_unchecked(const etl::span<T>& range)
+    {
+      to_bytes_batch(range.data(), range.size());
+    }
+
+    //***************************************************************************
+    /// Write a range of T to the stream as one batch.
+    /// The callback is called once for the whole range, not once per value.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, bool>::type
+      write_batch(const etl::span<T>& range)
+    {
+      bool success = (available<T>() >= range.size());
+
+      if (success)
+      {
+        write_batch_unchecked(range);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Write a range of T to the stream as one batch.
+    /// The callback is called once for the whole range, not once per value.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
+      write_batch_unchecked(const T* start, size_t length)
+    {
+      to_bytes_batch(start, length);
+    }
+
+    //***************************************************************************
+    /// Write a range of T to the stream as one batch.
+    /// The callback is called once for the whole range, not once per value.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, bool>::type
+      write_batch(const T* start, size_t length)
+    {
+      bool success = (available<T>() >= length);
+
+      if (success)
+      {
+        write_batch_unchecked(start, length);
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Skip n items of T, if the total space is available.
     /// Returns <b>true</b> if the skip was possible.
@@ -451,34 +593,51 @@ namespace etl
     typename etl::enable_if<sizeof(T) != 1U, void>::type
       to_bytes(const T value)
     {
-      const char* pv = reinterpret_cast<const char*>(&value);
-      copy_value(pv, pcurrent, sizeof(T));
+      private_byte_stream::copy_value<sizeof(T)>(reinterpret_cast<const char*>(&value), pcurrent, stream_endianness);
       step(sizeof(T));
     }
 
     //*********************************
-    void step(size_t n)
-    {
-      callback.call_if(etl::span<char>(pcurrent, pcurrent + n));
-
-      pcurrent += n;
-    }
-
+    /// Writes a range of values in one copy.
+    /// The callback is called once for each value.
     //*********************************
-    void copy_value(const char* source, char* destination, size_t length) const
+    template <typename T>
+    void to_bytes(const T* start, size_t length)
     {
-      const etl::endian platform_endianness = etl::endianness::value();
+      private_byte_stream::copy_values<sizeof(T)>(reinterpret_cast<const char*>(start), pcurrent, length, stream_endianness);
 
-      if (stream_endianness == platform_endianness)
+      if (callback.is_valid())
       {
-        etl::copy(source, source + length, destination);
+        while (length-- != 0U)
+        {
+          step(sizeof(T));
+        }
       }
       else
       {
-        etl::reverse_copy(source, source + length, destination);
+        pcurrent += length * sizeof(T);
       }
     }
 
+    //*********************************
+    /// Writes a range of values in one copy.
+    /// The callback is called once for the whole range.
+    //*********************************
+    template <typename T>
+    void to_bytes_batch(const T* start, size_t length)
+    {
+      private_byte_stream::copy_values<sizeof(T)>(reinterpret_cast<const char*>(start), pcurrent, length, stream_endianness);
+      step(length * sizeof(T));
+    }
+
+    //*********************************
+    void step(size_t n)
+    {
+      callback.call_if(etl::span<char>(pcurrent, pcurrent + n));
+
+      pcurrent += n;
+    }
+
     char* const       pdata;             ///< The start of the byte stream buffer.
     char*             pcurrent;          ///< The current position in the byte stream buffer.
     const size_t      stream_length;     ///< The length of the byte stream buffer.
@@ -635,12 +794,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes(range.data(), range.size());
 
       return etl::span<const T>(range.begin(), range.end());
     }
@@ -668,12 +822,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(T* start,  size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes(start, length);
 
       return etl::span<const T>(start, length);
     }
@@ -831,26 +980,20 @@ namespace etl
     {
       T value;
 
-      char* pv = reinterpret_cast<char*>(&value);
-      copy_value(pcurrent, pv, sizeof(T));
+      private_byte_stream::copy_value<sizeof(T)>(pcurrent, reinterpret_cast<char*>(&value), stream_endianness);
       pcurrent += sizeof(T);
 
       return value;
     }
 
     //*********************************
-    void copy_value(const char* source, char* destination, size_t length) const
+    /// Reads a range of values as one batch.
+    //*********************************
+    template <typename T>
+    void from_bytes(T* start, size_t length)
     {
-      const etl::endian platform_endianness = etl::endianness::value();
-
-      if (stream_endianness == platform_endianness)
-      {
-        etl::copy(source, source + length, destination);
-      }
-      else
-      {
-        etl::reverse_copy(source, source + length, destination);
-      }
+      private_byte_stream::copy_values<sizeof(T)>(pcurrent, reinterpret_cast<char*>(start), length, stream_endianness);
+      pcurrent += length * sizeof(T);
     }
 
     const char* const pdata;             ///< The start of the byte stream buffer.
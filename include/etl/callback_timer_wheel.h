@@ -0,0 +1,587 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "function.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "placement_new.h"
+#include "delegate.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for callback timer wheel.
+  /// A callback timer for large numbers of timers.
+  /// The active timers are held in a hashed timing wheel, so start and stop are O(1),
+  /// and unregistered timers in a free list, so register and unregister are O(1).
+  /// Each tick visits one wheel slot.
+  //***************************************************************************
+  template <typename TSemaphore>
+  class icallback_timer_wheel
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+    typedef etl::timer::wheel_id::type id_type;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(void     (*p_callback_)(),
+                           uint32_t period_,
+                           bool     repeating_)
+    {
+      id_type id = free_timers.allocate();
+
+      if (id != etl::timer::wheel_id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, p_callback_, period_, repeating_);
+        ++number_of_registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(etl::ifunction<void>& callback_,
+                           uint32_t              period_,
+                           bool                  repeating_)
+    {
+      id_type id = free_timers.allocate();
+
+      if (id != etl::timer::wheel_id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, callback_, period_, repeating_);
+        ++number_of_registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(callback_type callback_,
+                           uint32_t      period_,
+                           bool          repeating_)
+    {
+      id_type id = free_timers.allocate();
+
+      if (id != etl::timer::wheel_id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, callback_, period_, repeating_);
+        ++number_of_registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(id_type id_)
+    {
+      bool result = false;
+
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ++process_semaphore;
+            active_timers.remove(timer.id);
+            --process_semaphore;
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data();
+          free_timers.release(id_);
+          --number_of_registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ++process_semaphore;
+      active_timers.clear();
+      --process_semaphore;
+
+      initialise();
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (process_semaphore == 0U)
+        {
+          active_timers.collect();
+
+          do
+          {
+            id_type id = active_timers.pop_due();
+
+            while (id != etl::timer::wheel_id::NO_TIMER)
+            {
+              timer_data& timer = timer_array[id];
+
+              if (timer.repeating)
+              {
+                // Reinsert the timer.
+                active_timers.insert(id, timer.period);
+              }
+
+              if (timer.cbk_type == timer_data::C_CALLBACK)
+              {
+                // Call the C callback.
+                reinterpret_cast<void(*)()>(timer.p_callback)();
+              }
+              else if (timer.cbk_type == timer_data::IFUNCTION)
+              {
+                // Call the function wrapper callback.
+                (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+              }
+              else if (timer.callback.is_valid())
+              {
+                // Call the delegate callback.
+                timer.callback();
+              }
+
+              id = active_timers.pop_due();
+            }
+          } while (active_timers.advance(count));
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(id_type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::Inactive)
+          {
+            ++process_semaphore;
+            if (timer.is_active())
+            {
+              active_timers.remove(timer.id);
+            }
+
+            active_timers.insert(timer.id, immediate_ ? 0U : timer.period);
+            --process_semaphore;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(id_type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ++process_semaphore;
+            active_timers.remove(timer.id);
+            --process_semaphore;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(id_type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(id_type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Check if there is an active timer.
+    //*******************************************
+    bool has_active_timer() const
+    {
+      ++process_semaphore;
+      bool result = !active_timers.empty();
+      --process_semaphore;
+
+      return result;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event.
+    /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+    /// This searches the wheel, so is not O(1).
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      ++process_semaphore;
+      uint32_t delta = active_timers.time_to_next();
+      --process_semaphore;
+
+      return delta;
+    }
+
+    //*******************************************
+    /// Checks if a timer is currently active.
+    /// Returns <b>true</b> if the timer is active, otherwise <b>false</b>.
+    //*******************************************
+    bool is_active(id_type id_) const
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        ++process_semaphore;
+        const timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          result = timer.is_active();
+        }
+        --process_semaphore;
+      }
+
+      return result;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    struct timer_data
+    {
+      enum callback_type_id
+      {
+        C_CALLBACK,
+        IFUNCTION,
+        DELEGATE
+      };
+
+      //*******************************************
+      timer_data()
+        : callback()
+        , p_callback(ETL_NULLPTR)
+        , period(0U)
+        , expiry(0U)
+        , id(etl::timer::wheel_id::NO_TIMER)
+        , slot(etl::timer::wheel_id::NO_TIMER)
+        , previous(etl::timer::wheel_id::NO_TIMER)
+        , next(etl::timer::wheel_id::NO_TIMER)
+        , repeating(true)
+        , cbk_type(DELEGATE)
+      {
+      }
+
+      //*******************************************
+      /// C function callback
+      //*******************************************
+      timer_data(id_type  id_,
+                 void     (*p_callback_)(),
+                 uint32_t period_,
+                 bool     repeating_)
+        : callback()
+        , p_callback(reinterpret_cast<void*>(p_callback_))
+        , period(period_)
+        , expiry(0U)
+        , id(id_)
+        , slot(etl::timer::wheel_id::NO_TIMER)
+        , previous(etl::timer::wheel_id::NO_TIMER)
+        , next(etl::timer::wheel_id::NO_TIMER)
+        , repeating(repeating_)
+        , cbk_type(C_CALLBACK)
+      {
+      }
+
+      //*******************************************
+      /// ETL function callback
+      //*******************************************
+      timer_data(id_type               id_,
+                 etl::ifunction<void>& callback_,
+                 uint32_t              period_,
+                 bool                  repeating_)
+        : callback()
+        , p_callback(reinterpret_cast<void*>(&callback_))
+        , period(period_)
+        , expiry(0U)
+        , id(id_)
+        , slot(etl::timer::wheel_id::NO_TIMER)
+        , previous(etl::timer::wheel_id::NO_TIMER)
+        , next(etl::timer::wheel_id::NO_TIMER)
+        , repeating(repeating_)
+        , cbk_type(IFUNCTION)
+      {
+      }
+
+      //*******************************************
+      /// ETL delegate callback
+      //*******************************************
+      timer_data(id_type       id_,
+                 callback_type callback_,
+                 uint32_t      period_,
+                 bool          repeating_)
+        : callback(callback_)
+        , p_callback(ETL_NULLPTR)
+        , period(period_)
+        , expiry(0U)
+        , id(id_)
+        , slot(etl::timer::wheel_id::NO_TIMER)
+        , previous(etl::timer::wheel_id::NO_TIMER)
+        , next(etl::timer::wheel_id::NO_TIMER)
+        , repeating(repeating_)
+        , cbk_type(DELEGATE)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return slot != etl::timer::wheel_id::NO_TIMER;
+      }
+
+      callback_type    callback;
+      void*            p_callback;
+      uint32_t         period;
+      uint32_t         expiry;
+      id_type          id;
+      id_type          slot;
+      id_type          previous;
+      id_type          next;
+      bool             repeating;
+      callback_type_id cbk_type;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator =(const timer_data& other) ETL_DELETE;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(timer_data* const timer_array_,
+                          id_type* const    slot_array_,
+                          const id_type     MAX_TIMERS_,
+                          const id_type     WHEEL_SIZE_)
+      : timer_array(timer_array_)
+      , active_timers(timer_array_, slot_array_, WHEEL_SIZE_)
+      , free_timers(timer_array_)
+      , enabled(false)
+      , process_semaphore(0U)
+      , number_of_registered_timers(0U)
+      , MAX_TIMERS(MAX_TIMERS_)
+      , WHEEL_SIZE(WHEEL_SIZE_)
+    {
+    }
+
+    //*******************************************
+    /// Resets the timers, wheel and free list.
+    /// Called from the derived constructor, once the arrays have been constructed.
+    //*******************************************
+    void initialise()
+    {
+      for (id_type i = 0U; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) timer_data();
+      }
+
+      active_timers.clear();
+      free_timers.initialise(MAX_TIMERS);
+      number_of_registered_timers = 0U;
+    }
+
+  private:
+
+    //*******************************************
+    /// Check that the timer id is valid.
+    //*******************************************
+    bool is_valid_timer_id(id_type id_) const
+    {
+      return (id_ < MAX_TIMERS);
+    }
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The wheel of active timers.
+    private_timer_wheel::wheel<timer_data> active_timers;
+
+    // The list of unregistered timers.
+    private_timer_wheel::free_list<timer_data> free_timers;
+
+    bool enabled;
+    mutable TSemaphore process_semaphore;
+    id_type number_of_registered_timers;
+
+  public:
+
+    const id_type MAX_TIMERS;
+    const id_type WHEEL_SIZE;
+  };
+
+  //***************************************************************************
+  /// The callback timer wheel.
+  ///\tparam MAX_TIMERS_ The maximum number of timers.
+  ///\tparam WHEEL_SIZE_ The number of wheel slots. Must be a power of 2.
+  ///                    Timers with periods longer than this take more than one turn of the wheel.
+  ///\tparam TSemaphore  The type used to lock the timers during updates.
+  //***************************************************************************
+  template <uint_least16_t MAX_TIMERS_, uint_least16_t WHEEL_SIZE_, typename TSemaphore>
+  class callback_timer_wheel : public etl::icallback_timer_wheel<TSemaphore>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 65534U, "No more than 65534 timers are allowed");
+    ETL_STATIC_ASSERT((WHEEL_SIZE_ != 0U) && ((WHEEL_SIZE_ & (WHEEL_SIZE_ - 1U)) == 0U), "Wheel size must be a power of 2");
+    ETL_STATIC_ASSERT(WHEEL_SIZE_ <= 32768U, "No more than 32768 wheel slots are allowed");
+
+    typedef etl::icallback_timer_wheel<TSemaphore> base_t;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : base_t(timer_array, slot_array, MAX_TIMERS_, WHEEL_SIZE_)
+    {
+      base_t::initialise();
+    }
+
+  private:
+
+    typename base_t::timer_data timer_array[MAX_TIMERS_];
+    typename base_t::id_type    slot_array[WHEEL_SIZE_ + 1U];
+  };
+}
+
+#endif
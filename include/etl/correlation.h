@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "private/statistics_accumulate.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -147,12 +148,24 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first1, TIterator last1, TIterator first2)
     {
-      while (first1 != last1)
-      {
-        add(*first1, *first2);
-        ++first1;
-        ++first2;
-      }
+      counter += private_statistics::accumulate<TInput>(first1, last1, first2, sum1, sum2, sum_of_squares1, sum_of_squares2, inner_product);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add the values added to another correlation.
+    /// Allows partial results, calculated on separate threads or blocks of
+    /// data, to be combined.
+    //*********************************
+    void merge(const correlation& other)
+    {
+      inner_product   += other.inner_product;
+      sum_of_squares1 += other.sum_of_squares1;
+      sum_of_squares2 += other.sum_of_squares2;
+      sum1            += other.sum1;
+      sum2            += other.sum2;
+      counter         += other.counter;
+      recalculate = true;
     }
 
     //*********************************
@@ -70,9 +70,12 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc16_dnp_t<256U> crc16_dnp_t256;
-  typedef etl::crc16_dnp_t<16U>  crc16_dnp_t16;
-  typedef etl::crc16_dnp_t<4U>   crc16_dnp_t4;
-  typedef crc16_dnp_t256         crc16_dnp;
+  typedef etl::crc16_dnp_t<4096U> crc16_dnp_t4096;
+  typedef etl::crc16_dnp_t<2048U> crc16_dnp_t2048;
+  typedef etl::crc16_dnp_t<1024U> crc16_dnp_t1024;
+  typedef etl::crc16_dnp_t<256U>  crc16_dnp_t256;
+  typedef etl::crc16_dnp_t<16U>   crc16_dnp_t16;
+  typedef etl::crc16_dnp_t<4U>    crc16_dnp_t4;
+  typedef crc16_dnp_t256          crc16_dnp;
 }
 #endif
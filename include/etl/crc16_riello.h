@@ -70,9 +70,12 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc16_riello_t<256U> crc16_riello_t256;
-  typedef etl::crc16_riello_t<16U>  crc16_riello_t16;
-  typedef etl::crc16_riello_t<4U>   crc16_riello_t4;
-  typedef crc16_riello_t256         crc16_riello;
+  typedef etl::crc16_riello_t<4096U> crc16_riello_t4096;
+  typedef etl::crc16_riello_t<2048U> crc16_riello_t2048;
+  typedef etl::crc16_riello_t<1024U> crc16_riello_t1024;
+  typedef etl::crc16_riello_t<256U>  crc16_riello_t256;
+  typedef etl::crc16_riello_t<16U>   crc16_riello_t16;
+  typedef etl::crc16_riello_t<4U>    crc16_riello_t4;
+  typedef crc16_riello_t256          crc16_riello;
 }
 #endif
@@ -70,9 +70,12 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc16_t10dif_t<256U> crc16_t10dif_t256;
-  typedef etl::crc16_t10dif_t<16U>  crc16_t10dif_t16;
-  typedef etl::crc16_t10dif_t<4U>   crc16_t10dif_t4;
-  typedef crc16_t10dif_t256         crc16_t10dif;
+  typedef etl::crc16_t10dif_t<4096U> crc16_t10dif_t4096;
+  typedef etl::crc16_t10dif_t<2048U> crc16_t10dif_t2048;
+  typedef etl::crc16_t10dif_t<1024U> crc16_t10dif_t1024;
+  typedef etl::crc16_t10dif_t<256U>  crc16_t10dif_t256;
+  typedef etl::crc16_t10dif_t<16U>   crc16_t10dif_t16;
+  typedef etl::crc16_t10dif_t<4U>    crc16_t10dif_t4;
+  typedef crc16_t10dif_t256          crc16_t10dif;
 }
 #endif
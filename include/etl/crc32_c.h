@@ -70,9 +70,12 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc32_c_t<256U> crc32_c_t256;
-  typedef etl::crc32_c_t<16U>  crc32_c_t16;
-  typedef etl::crc32_c_t<4U>   crc32_c_t4;
-  typedef crc32_c_t256         crc32_c;
+  typedef etl::crc32_c_t<4096U> crc32_c_t4096;
+  typedef etl::crc32_c_t<2048U> crc32_c_t2048;
+  typedef etl::crc32_c_t<1024U> crc32_c_t1024;
+  typedef etl::crc32_c_t<256U>  crc32_c_t256;
+  typedef etl::crc32_c_t<16U>   crc32_c_t16;
+  typedef etl::crc32_c_t<4U>    crc32_c_t4;
+  typedef crc32_c_t256          crc32_c;
 }
 #endif
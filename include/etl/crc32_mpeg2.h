@@ -70,9 +70,12 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc32_mpeg2_t<256U> crc32_mpeg2_t256;
-  typedef etl::crc32_mpeg2_t<16U>  crc32_mpeg2_t16;
-  typedef etl::crc32_mpeg2_t<4U>   crc32_mpeg2_t4;
-  typedef crc32_mpeg2_t256         crc32_mpeg2;
+  typedef etl::crc32_mpeg2_t<4096U> crc32_mpeg2_t4096;
+  typedef etl::crc32_mpeg2_t<2048U> crc32_mpeg2_t2048;
+  typedef etl::crc32_mpeg2_t<1024U> crc32_mpeg2_t1024;
+  typedef etl::crc32_mpeg2_t<256U>  crc32_mpeg2_t256;
+  typedef etl::crc32_mpeg2_t<16U>   crc32_mpeg2_t16;
+  typedef etl::crc32_mpeg2_t<4U>    crc32_mpeg2_t4;
+  typedef crc32_mpeg2_t256          crc32_mpeg2;
 }
 #endif
@@ -70,9 +70,12 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc32_q_t<256U> crc32_q_t256;
-  typedef etl::crc32_q_t<16U>  crc32_q_t16;
-  typedef etl::crc32_q_t<4U>   crc32_q_t4;
-  typedef crc32_q_t256         crc32_q;
+  typedef etl::crc32_q_t<4096U> crc32_q_t4096;
+  typedef etl::crc32_q_t<2048U> crc32_q_t2048;
+  typedef etl::crc32_q_t<1024U> crc32_q_t1024;
+  typedef etl::crc32_q_t<256U>  crc32_q_t256;
+  typedef etl::crc32_q_t<16U>   crc32_q_t16;
+  typedef etl::crc32_q_t<4U>    crc32_q_t4;
+  typedef crc32_q_t256          crc32_q;
 }
 #endif
@@ -103,5 +103,8 @@ SOFTWARE.
 #define ETL_EXPECTED_FILE_ID "70"
 #define ETL_ALIGNMENT_FILE_ID "71"
 #define ETL_BASE64_FILE_ID "72"
+#define ETL_UNORDERED_FLAT_MAP_FILE_ID "73"
+#define ETL_BTREE_MAP_FILE_ID "74"
+#define ETL_BTREE_SET_FILE_ID "75"
 
 #endif
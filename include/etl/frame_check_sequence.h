@@ -183,7 +183,7 @@ namespace etl
       return add_insert_iterator(*this);
     }
 
-  private:
+  protected:
 
     value_type  frame_check;
     policy_type policy;
@@ -78,6 +78,7 @@ cog.outl("//********************************************************************
 #include "placement_new.h"
 #include "successor.h"
 #include "type_traits.h"
+#include "private/message_router_dispatch_table.h"
 
 #include <stdint.h>
 
@@ -160,6 +161,15 @@ namespace etl
       return accepts(msg.get_message_id());
     }
 
+    //********************************************
+    /// Returns true if the ids accepted by the router may change after it is
+    /// subscribed, such as for a message bus or broker.
+    //********************************************
+    virtual bool has_dynamic_accepts() const
+    {
+      return false;
+    }
+
     //********************************************
     etl::message_router_id_t get_message_router_id() const
     {
@@ -459,7 +469,23 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      bool was_handled;
+
+      if constexpr (Use_Dispatch_Table)
+      {
+        const message_handler_t handler = dispatch_table.find(msg.get_message_id());
+
+        was_handled = (handler != ETL_NULLPTR);
+
+        if (was_handled)
+        {
+          handler(*this, msg);
+        }
+      }
+      else
+      {
+        was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      }
 
       if (!was_handled)
       {
@@ -499,7 +525,28 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if constexpr (Use_Dispatch_Table)
+      {
+        if (dispatch_table.find(id) != ETL_NULLPTR)
+        {
+          return true;
+        }
+        else
+        {
+          if (has_successor())
+          {
+            return get_successor().accepts(id);
+          }
+          else
+          {
+            return false;
+          }
+        }
+      }
+      else
+      {
+        return (accepts_type<TMessageTypes>(id) || ...);
+      }
     }
 
     //********************************************
@@ -522,6 +569,28 @@ namespace etl
 
   private:
 
+    //********************************************
+    // The message id to handler table.
+    //********************************************
+    typedef void (*message_handler_t)(message_router&, const etl::imessage&);
+
+    template <typename TMessage>
+    static void handle_message_type(message_router& router, const etl::imessage& msg)
+    {
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
+    }
+
+    typedef etl::private_message_router::dispatch_table<message_handler_t, TMessageTypes::ID...> dispatch_table_t;
+
+    static constexpr message_handler_t handlers[sizeof...(TMessageTypes) + 1U] = { &handle_message_type<TMessageTypes>..., ETL_NULLPTR };
+    static constexpr dispatch_table_t  dispatch_table = dispatch_table_t(handlers);
+
+#if defined(ETL_MESSAGE_ROUTER_DISABLE_DISPATCH_TABLE)
+    static constexpr bool Use_Dispatch_Table = false;
+#else
+    static constexpr bool Use_Dispatch_Table = dispatch_table_t::Is_Valid;
+#endif
+
     //********************************************
     template <typename TMessage>
     bool receive_message_type(const etl::imessage& msg)
@@ -39,11 +39,38 @@ SOFTWARE.
 #include "static_assert.h"
 #include "type_traits.h"
 #include "integral_limits.h"
+#include "iterator.h"
 
 namespace etl
 {
   namespace private_histogram
   {
+    //***************************************************************************
+    /// The rank of the quantile q of total items, from 1 to total.
+    //***************************************************************************
+    inline size_t quantile_rank(double q, size_t total)
+    {
+      if (q <= 0.0)
+      {
+        return 1U;
+      }
+
+      if (q >= 1.0)
+      {
+        return total;
+      }
+
+      const double rank   = q * double(total);
+      size_t       target = size_t(rank);
+
+      if (double(target) < rank)
+      {
+        ++target;
+      }
+
+      return (target == 0U) ? 1U : target;
+    }
+
     //***************************************************************************
     /// Base for histograms.
     //***************************************************************************
@@ -124,11 +151,135 @@ namespace etl
 
     protected:
 
+      //*********************************
+      /// Adds the keys in a range, where the index of a key is key - offset.
+      //*********************************
+      template <typename TKey, typename TIterator, typename TOffset>
+      void add_range(TIterator first, TIterator last, TOffset offset)
+      {
+        add_range<TKey>(first, last, offset, etl::integral_constant<bool, Interleave && etl::is_random_access_iterator<TIterator>::value>());
+      }
+
+      //*********************************
+      /// Adds the counts of another histogram.
+      //*********************************
+      void add_counts(const histogram_common& other)
+      {
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          accumulator[i] = TCount(accumulator[i] + other.accumulator[i]);
+        }
+      }
+
+      //*********************************
+      /// Returns the index of the smallest bin at which the running count
+      /// reaches the fraction q of the total.
+      //*********************************
+      size_t quantile_index(double q) const
+      {
+        size_t total = 0U;
+
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          total += size_t(accumulator[i]);
+        }
+
+        const size_t target = private_histogram::quantile_rank(q, total);
+
+        total = 0U;
+
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          total += size_t(accumulator[i]);
+
+          if (total >= target)
+          {
+            return i;
+          }
+        }
+
+        return 0U;
+      }
+
       etl::array<TCount, Max_Size> accumulator;
+
+    private:
+
+      // A range is counted in interleaved sub-histograms, so that a run of the
+      // same key does not wait on the increment before it. The extra
+      // sub-histograms are on the stack, so only small histograms do this.
+      static ETL_CONSTANT size_t Lanes      = 4U;
+      static ETL_CONSTANT bool   Interleave = ((Max_Size * sizeof(TCount)) <= 256U);
+
+      //*********************************
+      /// Adds the keys in a range, one at a time.
+      //*********************************
+      template <typename TKey, typename TIterator, typename TOffset>
+      void add_range(TIterator first, TIterator last, TOffset offset, etl::false_type)
+      {
+        while (first != last)
+        {
+          ++accumulator[TKey(*first) - offset];
+          ++first;
+        }
+      }
+
+      //*********************************
+      /// Adds the keys in a random access range, interleaved.
+      //*********************************
+      template <typename TKey, typename TIterator, typename TOffset>
+      void add_range(TIterator first, TIterator last, TOffset offset, etl::true_type)
+      {
+        const size_t n = size_t(last - first);
+
+        // Too short to repay clearing and folding the sub-histograms.
+        if (n < Max_Size)
+        {
+          add_range<TKey>(first, last, offset, etl::false_type());
+          return;
+        }
+
+        TCount sub[Lanes - 1U][Max_Size];
+
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          sub[0][i] = TCount(0);
+          sub[1][i] = TCount(0);
+          sub[2][i] = TCount(0);
+        }
+
+        TCount* const p_main = accumulator.data();
+
+        size_t i = 0U;
+
+        for (; (i + Lanes) <= n; i += Lanes)
+        {
+          ++p_main[TKey(first[i]) - offset];
+          ++sub[0][TKey(first[i + 1U]) - offset];
+          ++sub[1][TKey(first[i + 2U]) - offset];
+          ++sub[2][TKey(first[i + 3U]) - offset];
+        }
+
+        for (; i < n; ++i)
+        {
+          ++p_main[TKey(first[i]) - offset];
+        }
+
+        for (size_t j = 0U; j < Max_Size; ++j)
+        {
+          accumulator[j] = TCount(accumulator[j] + sub[0][j] + sub[1][j] + sub[2][j]);
+        }
+      }
     };
 
     template <typename TCount, size_t Max_Size_>   
     ETL_CONSTANT size_t histogram_common<TCount, Max_Size_>::Max_Size;
+
+    template <typename TCount, size_t Max_Size_>
+    ETL_CONSTANT size_t histogram_common<TCount, Max_Size_>::Lanes;
+
+    template <typename TCount, size_t Max_Size_>
+    ETL_CONSTANT bool histogram_common<TCount, Max_Size_>::Interleave;
   }
 
   //***************************************************************************
@@ -220,11 +371,26 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first);
-        ++first;
-      }
+      this->template add_range<key_type>(first, last, Start_Index);
+    }
+
+    //*********************************
+    /// Adds the counts of another histogram, such as one filled on another
+    /// thread.
+    //*********************************
+    void merge(const histogram& other)
+    {
+      this->add_counts(other);
+    }
+
+    //*********************************
+    /// Adds the counts of another histogram.
+    //*********************************
+    histogram& operator +=(const histogram& rhs)
+    {
+      merge(rhs);
+
+      return *this;
     }
 
     //*********************************
@@ -251,6 +417,24 @@ namespace etl
     {
       return this->accumulator[key - Start_Index];
     }
+
+    //*********************************
+    /// Returns the smallest key at which the count of keys less than or equal
+    /// to it reaches the fraction q, from 0 to 1, of the total.
+    /// Returns the first key if the histogram is empty.
+    //*********************************
+    key_type quantile(double q) const
+    {
+      return key_type(int32_t(this->quantile_index(q)) + Start_Index);
+    }
+
+    //*********************************
+    /// Returns the key at percentile p, from 0 to 100.
+    //*********************************
+    key_type percentile(double p) const
+    {
+      return quantile(p / 100.0);
+    }
   };
 
   //***************************************************************************
@@ -294,6 +478,7 @@ namespace etl
     /// Copy constructor
     //*********************************
     histogram(const histogram& other)
+      : start_index(other.start_index)
     {
       this->accumulator = other.accumulator;
     }
@@ -303,6 +488,7 @@ namespace etl
     /// Move constructor
     //*********************************
     histogram(histogram&& other)
+      : start_index(other.start_index)
     {
       this->accumulator = etl::move(other.accumulator);
     }
@@ -314,6 +500,7 @@ namespace etl
     histogram& operator =(const histogram& rhs)
     {
       this->accumulator = rhs.accumulator;
+      start_index       = rhs.start_index;
 
       return *this;
     }
@@ -325,6 +512,7 @@ namespace etl
     histogram& operator =(histogram&& rhs)
     {
       this->accumulator = etl::move(rhs.accumulator);
+      start_index       = rhs.start_index;
 
       return *this;
     }
@@ -344,11 +532,26 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first);
-        ++first;
-      }
+      this->template add_range<key_type>(first, last, start_index);
+    }
+
+    //*********************************
+    /// Adds the counts of another histogram, such as one filled on another
+    /// thread. The histograms must have the same start index.
+    //*********************************
+    void merge(const histogram& other)
+    {
+      this->add_counts(other);
+    }
+
+    //*********************************
+    /// Adds the counts of another histogram.
+    //*********************************
+    histogram& operator +=(const histogram& rhs)
+    {
+      merge(rhs);
+
+      return *this;
     }
 
     //*********************************
@@ -376,6 +579,24 @@ namespace etl
       return this->accumulator[key - start_index];
     }
 
+    //*********************************
+    /// Returns the smallest key at which the count of keys less than or equal
+    /// to it reaches the fraction q, from 0 to 1, of the total.
+    /// Returns the first key if the histogram is empty.
+    //*********************************
+    key_type quantile(double q) const
+    {
+      return key_type(start_index + key_type(this->quantile_index(q)));
+    }
+
+    //*********************************
+    /// Returns the key at percentile p, from 0 to 100.
+    //*********************************
+    key_type percentile(double p) const
+    {
+      return quantile(p / 100.0);
+    }
+
   private:
 
     key_type start_index;
@@ -481,7 +702,7 @@ namespace etl
     //*********************************
     const_iterator end() const
     {
-      return accumulator.begin();
+      return accumulator.end();
     }
 
     //*********************************
@@ -489,7 +710,7 @@ namespace etl
     //*********************************
     const_iterator cend() const
     {
-      return accumulator.cbegin();
+      return accumulator.cend();
     }
 
     //*********************************
@@ -506,13 +727,58 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
+      if (first == last)
+      {
+        return;
+      }
+
+      // The elements of the map do not move, so a run of the same key is
+      // counted without looking it up again.
+      key_type    key     = *first;
+      count_type* p_count = &accumulator[key];
+
+      ++*p_count;
+      ++first;
+
       while (first != last)
       {
-        add(*first);
+        if (!(*first == key))
+        {
+          key     = *first;
+          p_count = &accumulator[key];
+        }
+
+        ++*p_count;
         ++first;
       }
     }
 
+    //*********************************
+    /// Adds the counts of another histogram, such as one filled on another
+    /// thread.
+    //*********************************
+    void merge(const sparse_histogram& other)
+    {
+      const_iterator itr = other.accumulator.begin();
+
+      while (itr != other.accumulator.end())
+      {
+        count_type& count = accumulator[itr->first];
+        count = count_type(count + itr->second);
+        ++itr;
+      }
+    }
+
+    //*********************************
+    /// Adds the counts of another histogram.
+    //*********************************
+    sparse_histogram& operator +=(const sparse_histogram& rhs)
+    {
+      merge(rhs);
+
+      return *this;
+    }
+
     //*********************************
     /// operator ()
     //*********************************
@@ -591,6 +857,42 @@ namespace etl
       return sum;
     }
 
+    //*********************************
+    /// Returns the smallest key at which the count of keys less than or equal
+    /// to it reaches the fraction q, from 0 to 1, of the total.
+    /// Returns a default constructed key if the histogram is empty.
+    //*********************************
+    key_type quantile(double q) const
+    {
+      const size_t target = private_histogram::quantile_rank(q, count());
+
+      size_t total = 0U;
+
+      const_iterator itr = accumulator.begin();
+
+      while (itr != accumulator.end())
+      {
+        total += size_t(itr->second);
+
+        if (total >= target)
+        {
+          return itr->first;
+        }
+
+        ++itr;
+      }
+
+      return key_type();
+    }
+
+    //*********************************
+    /// Returns the key at percentile p, from 0 to 100.
+    //*********************************
+    key_type percentile(double p) const
+    {
+      return quantile(p / 100.0);
+    }
+
   private:
 
     etl::flat_map<key_type, count_type, Max_Size> accumulator;
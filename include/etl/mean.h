@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "private/statistics_accumulate.h"
 
 //#include <math.h>
 #include <stdint.h>
@@ -118,11 +119,20 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first);
-        ++first;
-      }
+      counter += private_statistics::accumulate<TInput, private_statistics::value_term>(first, last, sum);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add the values added to another mean.
+    /// Allows partial results, calculated on separate threads or blocks of
+    /// data, to be combined.
+    //*********************************
+    void merge(const mean& other)
+    {
+      sum += other.sum;
+      counter += other.counter;
+      recalculate = true;
     }
 
     //*********************************
@@ -342,6 +342,14 @@ namespace etl
       return true;
     }
 
+    //********************************************
+    /// The accepted ids change with the subscriptions.
+    //********************************************
+    virtual bool has_dynamic_accepts() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
     //********************************************
     bool empty() const
     {
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "binary.h"
 
 #include <stdint.h>
 
@@ -71,6 +72,12 @@ namespace etl
 
   //***************************************************************************
   /// Interface for message bus
+  /// The bus may hold an index of the subscribed routers for each message id.
+  /// The index is built when routers subscribe or unsubscribe, so that a broadcast
+  /// only visits the routers that accept the message.
+  /// Routers whose accepted ids may change, such as message buses and brokers,
+  /// are not indexed, and are always asked if they accept the message.
+  /// If the ids accepted by any other subscribed router change, call rebuild_index().
   //***************************************************************************
   class imessage_bus : public etl::imessage_router
   {
@@ -104,6 +111,7 @@ namespace etl
                                                              compare_router_id());
 
           router_list.insert(irouter, &router);
+          rebuild_index();
         }
       }
 
@@ -127,6 +135,7 @@ namespace etl
                                                                                                     compare_router_id());
 
         router_list.erase(range.first, range.second);
+        rebuild_index();
       }
     }
 
@@ -140,6 +149,7 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        rebuild_index();
       }
     }
 
@@ -165,19 +175,26 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
-
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
+          if (is_indexed(message.get_message_id()))
           {
-            etl::imessage_router& router = **irouter;
+            broadcast_indexed(message.get_message_id(), message);
+          }
+          else
+          {
+            router_list_t::iterator irouter = router_list.begin();
 
-            if (router.accepts(message.get_message_id()))
+            // Broadcast to everyone.
+            while (irouter != router_list.end())
             {
-              router.receive(message);
-            }
+              etl::imessage_router& router = **irouter;
 
-            ++irouter;
+              if (router.accepts(message.get_message_id()))
+              {
+                router.receive(message);
+              }
+
+              ++irouter;
+            }
           }
 
           break;
@@ -244,19 +261,26 @@ namespace etl
         // Broadcast to all routers.
       case etl::imessage_router::ALL_MESSAGE_ROUTERS:
       {
-        router_list_t::iterator irouter = router_list.begin();
-
-        // Broadcast to everyone.
-        while (irouter != router_list.end())
+        if (is_indexed(shared_msg.get_message().get_message_id()))
         {
-          etl::imessage_router& router = **irouter;
+          broadcast_indexed(shared_msg.get_message().get_message_id(), shared_msg);
+        }
+        else
+        {
+          router_list_t::iterator irouter = router_list.begin();
 
-          if (router.accepts(shared_msg.get_message().get_message_id()))
+          // Broadcast to everyone.
+          while (irouter != router_list.end())
           {
-            router.receive(shared_msg);
-          }
+            etl::imessage_router& router = **irouter;
 
-          ++irouter;
+            if (router.accepts(shared_msg.get_message().get_message_id()))
+            {
+              router.receive(shared_msg);
+            }
+
+            ++irouter;
+          }
         }
 
         break;
@@ -320,18 +344,51 @@ namespace etl
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
       // Check the list of subscribed routers.
-      router_list_t::iterator irouter = router_list.begin();
-
-      while (irouter != router_list.end())
+      if (is_indexed(id))
       {
-        etl::imessage_router& router = **irouter;
+        const uint32_t* p_row     = p_index + (size_t(id) * index_words_per_id);
+        const uint32_t* p_dynamic = get_dynamic_row();
 
-        if (router.accepts(id))
+        for (size_t i = 0U; i < index_words_per_id; ++i)
         {
-          return true;
+          if (p_row[i] != 0U)
+          {
+            return true;
+          }
         }
 
-        ++irouter;
+        // Only check the routers that are not indexed.
+        for (size_t i = 0U; i < index_words_per_id; ++i)
+        {
+          uint32_t bits = p_dynamic[i];
+
+          while (bits != 0U)
+          {
+            const size_t position = (i * 32U) + etl::count_trailing_zeros(bits);
+            bits &= (bits - 1U);
+
+            if (router_list[position]->accepts(id))
+            {
+              return true;
+            }
+          }
+        }
+      }
+      else
+      {
+        router_list_t::iterator irouter = router_list.begin();
+
+        while (irouter != router_list.end())
+        {
+          etl::imessage_router& router = **irouter;
+
+          if (router.accepts(id))
+          {
+            return true;
+          }
+
+          ++irouter;
+        }
       }
 
       // Check any successor.
@@ -356,6 +413,45 @@ namespace etl
     void clear()
     {
       router_list.clear();
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Rebuilds the message id index from the subscribed routers.
+    /// Called automatically on subscribe and unsubscribe.
+    /// Call if the ids accepted by a subscribed router have changed.
+    //*******************************************
+    void rebuild_index()
+    {
+      if ((p_index != ETL_NULLPTR) && (number_of_indexed_ids != 0U))
+      {
+        uint32_t* p_dynamic = get_dynamic_row();
+
+        etl::fill_n(p_index, (number_of_indexed_ids + 1U) * index_words_per_id, 0U);
+
+        for (size_t position = 0U; position < router_list.size(); ++position)
+        {
+          const etl::imessage_router& router = *router_list[position];
+          const size_t word = position / 32U;
+          const uint32_t bit = uint32_t(1UL << (position % 32U));
+
+          if (router.has_dynamic_accepts())
+          {
+            // Routers whose accepted ids may change are asked at broadcast.
+            p_dynamic[word] |= bit;
+          }
+          else
+          {
+            for (size_t id = 0U; id < number_of_indexed_ids; ++id)
+            {
+              if (router.accepts(etl::message_id_t(id)))
+              {
+                p_index[(id * index_words_per_id) + word] |= bit;
+              }
+            }
+          }
+        }
+      }
     }
 
     //********************************************
@@ -376,6 +472,14 @@ namespace etl
       return true;
     }
 
+    //********************************************
+    /// The accepted ids change with the subscriptions.
+    //********************************************
+    bool has_dynamic_accepts() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
   protected:
 
     //*******************************************
@@ -383,7 +487,10 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(ETL_NULLPTR),
+        number_of_indexed_ids(0U),
+        index_words_per_id(0U)
     {
     }
 
@@ -392,7 +499,40 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& router_list_, etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
-      router_list(router_list_)
+      router_list(router_list_),
+      p_index(ETL_NULLPTR),
+      number_of_indexed_ids(0U),
+      index_words_per_id(0U)
+    {
+    }
+
+    //*******************************************
+    /// Constructor with a message id index.
+    /// The index has index_words_per_id_ words for each of the ids below number_of_indexed_ids_,
+    /// followed by index_words_per_id_ words marking the routers that are not indexed.
+    /// The index must be zeroed.
+    //*******************************************
+    imessage_bus(router_list_t& list, uint32_t* p_index_, size_t number_of_indexed_ids_, size_t index_words_per_id_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        router_list(list),
+        p_index(p_index_),
+        number_of_indexed_ids(number_of_indexed_ids_),
+        index_words_per_id(index_words_per_id_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor with a message id index.
+    /// The index has index_words_per_id_ words for each of the ids below number_of_indexed_ids_,
+    /// followed by index_words_per_id_ words marking the routers that are not indexed.
+    /// The index must be zeroed.
+    //*******************************************
+    imessage_bus(router_list_t& list, uint32_t* p_index_, size_t number_of_indexed_ids_, size_t index_words_per_id_, etl::imessage_router& successor_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
+        router_list(list),
+        p_index(p_index_),
+        number_of_indexed_ids(number_of_indexed_ids_),
+        index_words_per_id(index_words_per_id_)
     {
     }
 
@@ -414,13 +554,69 @@ namespace etl
       }
     };
 
+    //*******************************************
+    /// Is there an index entry for the message id?
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return (p_index != ETL_NULLPTR) && (size_t(id) < number_of_indexed_ids);
+    }
+
+    //*******************************************
+    /// Returns the index row that marks the routers that are not indexed.
+    //*******************************************
+    uint32_t* get_dynamic_row() const
+    {
+      return p_index + (number_of_indexed_ids * index_words_per_id);
+    }
+
+    //*******************************************
+    /// Broadcasts, in subscription order, to the indexed routers that accept
+    /// the id and to the routers that are not indexed, if they accept it.
+    //*******************************************
+    template <typename TMessage>
+    void broadcast_indexed(etl::message_id_t id, const TMessage& message)
+    {
+      const uint32_t* p_row     = p_index + (size_t(id) * index_words_per_id);
+      const uint32_t* p_dynamic = get_dynamic_row();
+
+      for (size_t i = 0U; i < index_words_per_id; ++i)
+      {
+        uint32_t bits = p_row[i] | p_dynamic[i];
+
+        while (bits != 0U)
+        {
+          const size_t   position = (i * 32U) + etl::count_trailing_zeros(bits);
+          const uint32_t bit      = uint32_t(1UL << (position % 32U));
+          bits &= (bits - 1U);
+
+          etl::imessage_router& router = *router_list[position];
+
+          if (((p_dynamic[i] & bit) == 0U) || router.accepts(id))
+          {
+            router.receive(message);
+          }
+        }
+      }
+    }
+
     router_list_t& router_list;
+
+    // A bit for each indexed router position, for each indexed message id,
+    // then a bit for each router position that is not indexed.
+    uint32_t* const p_index;
+    const size_t    number_of_indexed_ids;
+    const size_t    index_words_per_id;
   };
 
   //***************************************************************************
   /// The message bus
+  ///\tparam MAX_ROUTERS_             The maximum number of subscribed routers.
+  ///\tparam MAX_INDEXED_MESSAGE_IDS_ Message ids below this are broadcast through the message id index.
+  ///                                 The index uses (MAX_INDEXED_MESSAGE_IDS_ + 1) * ((MAX_ROUTERS_ + 31) / 32) words.
+  ///                                 Zero, the default, disables the index.
   //***************************************************************************
-  template <uint_least8_t MAX_ROUTERS_>
+  template <uint_least8_t MAX_ROUTERS_, size_t MAX_INDEXED_MESSAGE_IDS_ = 0U>
   class message_bus : public etl::imessage_bus
   {
   public:
@@ -429,7 +625,8 @@ namespace etl
     /// Constructor.
     //*******************************************
     message_bus()
-      : imessage_bus(router_list)
+      : imessage_bus(router_list, index, MAX_INDEXED_MESSAGE_IDS_, Index_Words_Per_Id),
+        index()
     {
     }
 
@@ -437,14 +634,23 @@ namespace etl
     /// Constructor.
     //*******************************************
     message_bus(etl::imessage_router& successor_)
-      : imessage_bus(router_list, successor_)
+      : imessage_bus(router_list, index, MAX_INDEXED_MESSAGE_IDS_, Index_Words_Per_Id, successor_),
+        index()
     {
     }
 
   private:
 
+    static ETL_CONSTANT size_t Index_Words_Per_Id = (MAX_ROUTERS_ + 31U) / 32U;
+
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+
+    // A single word keeps the array valid when there is no index.
+    uint32_t index[(MAX_INDEXED_MESSAGE_IDS_ == 0U) ? 1U : ((MAX_INDEXED_MESSAGE_IDS_ + 1U) * Index_Words_Per_Id)];
   };
+
+  template <uint_least8_t MAX_ROUTERS_, size_t MAX_INDEXED_MESSAGE_IDS_>
+  ETL_CONSTANT size_t message_bus<MAX_ROUTERS_, MAX_INDEXED_MESSAGE_IDS_>::Index_Words_Per_Id;
 }
 
 #endif
@@ -263,6 +263,29 @@ SOFTWARE.
   #define ETL_HAS_MUTABLE_ARRAY_VIEW 0
 #endif
 
+//*************************************
+// The size of a cache line, in bytes.
+// Used to keep data that is written by different cores on separate cache lines.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
+//*************************************
+// Option to place the queue_spsc_atomic indexes on separate cache lines.
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION)
+  #define ETL_HAS_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION 1
+#else
+  #define ETL_HAS_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION 0
+#endif
+
+//*************************************
+// Option to place the queue_mpmc_atomic positions on separate cache lines.
+#if defined(ETL_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION)
+  #define ETL_HAS_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION 1
+#else
+  #define ETL_HAS_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION 0
+#endif
+
 //*************************************
 // Indicate if etl::imassage is to be non-virtual.
 #if defined(ETL_MESSAGES_ARE_NOT_VIRTUAL)
@@ -411,6 +434,27 @@ SOFTWARE.
   #endif
 #endif
 
+//*************************************
+// Determine if the ETL may use x86 SIMD intrinsics.
+// Opt-in with ETL_USE_X86_SIMD. The compiler must also be targeting the instruction set extension.
+#if defined(ETL_USE_X86_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_USING_SSE2 1
+#else
+  #define ETL_USING_SSE2 0
+#endif
+
+#if defined(ETL_USE_X86_SIMD) && defined(__SSE4_2__)
+  #define ETL_USING_SSE42 1
+#else
+  #define ETL_USING_SSE42 0
+#endif
+
+#if defined(ETL_USE_X86_SIMD) && defined(__AVX2__)
+  #define ETL_USING_AVX2 1
+#else
+  #define ETL_USING_AVX2 0
+#endif
+
 //*************************************
 // Determine if the ETL should support atomics.
 #if defined(ETL_NO_ATOMICS) || \
@@ -470,6 +514,7 @@ namespace etl
     // General
     static ETL_CONSTANT long cplusplus                        = __cplusplus;
     static ETL_CONSTANT int  language_standard                = ETL_LANGUAGE_STANDARD;
+    static ETL_CONSTANT int  cache_line_size                  = ETL_CACHE_LINE_SIZE;
 
     // Using...
     static ETL_CONSTANT bool using_stl                        = (ETL_USING_STL == 1);
@@ -492,6 +537,9 @@ namespace etl
     static ETL_CONSTANT bool using_generic_compiler           = (ETL_USING_GENERIC_COMPILER == 1);
     static ETL_CONSTANT bool using_legacy_bitset              = (ETL_USING_LEGACY_BITSET == 1);
     static ETL_CONSTANT bool using_exceptions                 = (ETL_USING_EXCEPTIONS == 1);
+    static ETL_CONSTANT bool using_sse2                       = (ETL_USING_SSE2 == 1);
+    static ETL_CONSTANT bool using_sse42                      = (ETL_USING_SSE42 == 1);
+    static ETL_CONSTANT bool using_avx2                       = (ETL_USING_AVX2 == 1);
     
     // Has...
     static ETL_CONSTANT bool has_initializer_list             = (ETL_HAS_INITIALIZER_LIST == 1);
@@ -512,6 +560,8 @@ namespace etl
     static ETL_CONSTANT bool has_mutable_array_view           = (ETL_HAS_MUTABLE_ARRAY_VIEW == 1);
     static ETL_CONSTANT bool has_ideque_repair                = (ETL_HAS_IDEQUE_REPAIR == 1);
     static ETL_CONSTANT bool has_virtual_messages             = (ETL_HAS_VIRTUAL_MESSAGES == 1);
+    static ETL_CONSTANT bool has_queue_spsc_atomic_cache_line_isolation = (ETL_HAS_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION == 1);
+    static ETL_CONSTANT bool has_queue_mpmc_atomic_cache_line_isolation = (ETL_HAS_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION == 1);
 
     // Is...
     static ETL_CONSTANT bool is_debug_build                   = (ETL_IS_DEBUG_BUILD == 1);
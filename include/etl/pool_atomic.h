@@ -0,0 +1,1174 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_ATOMIC_INCLUDED
+#define ETL_POOL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "alignment.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ETL_POOL_ATOMIC_CPP03_CODE 0
+
+//*****************************************************************************
+///\defgroup pool_atomic pool_atomic
+/// A fixed capacity pool that may be shared between threads without a lock.
+///\ingroup pool
+//*****************************************************************************
+
+#if ETL_HAS_ATOMIC && ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  template <size_t VSize>
+  class pool_atomic_cache;
+
+  //***************************************************************************
+  /// The base class for the lock free pools.
+  /// Free items are held on a lock free stack. The head of the stack is a
+  /// 64 bit word holding a link to the top item and a tag that changes on
+  /// every update, so that a stale head is never accepted (the ABA problem).
+  /// Items that have never been allocated are handed out in buffer order.
+  ///\ingroup pool_atomic
+  //***************************************************************************
+  class ipool_atomic
+  {
+  public:
+
+    template <size_t VSize>
+    friend class pool_atomic_cache;
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// Returns a null pointer if there are no free items, without asserting.
+    /// Checking full() before allocate() is a race when the pool is shared.
+    //*************************************************************************
+    template <typename T>
+    T* try_allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(try_allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_ATOMIC_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      release_item((char*)p);
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    /// Not thread safe. No other thread may be using the pool or a cache of it.
+    //*************************************************************************
+    void release_all()
+    {
+      free_head.store(0U, etl::memory_order_relaxed);
+      items_initialised.store(0U, etl::memory_order_relaxed);
+      items_allocated.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      return is_item_in_pool((const char*)p);
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Free items held by a pool_atomic_cache count as allocated.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ipool_atomic(char* p_buffer_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_),
+        free_head(0U),
+        items_initialised(0U),
+        items_allocated(0U),
+        Item_Size(item_size_),
+        Max_Size(max_size_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      char* p_value = try_allocate_item();
+
+      ETL_ASSERT(p_value != ETL_NULLPTR, ETL_ERROR(pool_no_allocation));
+
+      return p_value;
+    }
+
+    //*************************************************************************
+    /// Allocate an item from the pool, or return a null pointer if there are none.
+    //*************************************************************************
+    char* try_allocate_item()
+    {
+      char* p_value = pop_item();
+
+      if (p_value != ETL_NULLPTR)
+      {
+        items_allocated.fetch_add(1U, etl::memory_order_relaxed);
+      }
+
+      return p_value;
+    }
+
+    //*************************************************************************
+    /// Release an item back to the pool.
+    //*************************************************************************
+    void release_item(char* p_value)
+    {
+      // Does it belong to us?
+      ETL_ASSERT_OR_RETURN(is_item_in_pool(p_value), ETL_ERROR(pool_object_not_in_pool));
+
+      if (remove_allocated(1U))
+      {
+        push_items(p_value, p_value);
+      }
+      else
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(pool_no_allocation));
+      }
+    }
+
+    //*************************************************************************
+    /// Takes an item off the free stack or, failing that, an item that has
+    /// never been used. Returns a null pointer if there are none.
+    //*************************************************************************
+    char* pop_item()
+    {
+      uint64_t head = free_head.load(etl::memory_order_acquire);
+
+      while (get_link(head) != 0U)
+      {
+        char* p_item = get_item(get_link(head));
+
+        // The item may be taken by another thread before the exchange, in which
+        // case 'next' is meaningless, but the changed tag makes the exchange fail.
+        const uint32_t next = get_next(p_item);
+
+        if (free_head.compare_exchange_weak(head, make_head(head, next), etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          return p_item;
+        }
+      }
+
+      uint32_t n = items_initialised.load(etl::memory_order_relaxed);
+
+      while (n < Max_Size)
+      {
+        if (items_initialised.compare_exchange_weak(n, n + 1U, etl::memory_order_relaxed, etl::memory_order_relaxed))
+        {
+          return p_buffer + (n * Item_Size);
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Pushes a chain of items, already linked from first to last, on to the
+    /// free stack with a single exchange.
+    //*************************************************************************
+    void push_items(char* p_first, char* p_last)
+    {
+      const uint32_t first_link = get_link(p_first);
+
+      uint64_t head = free_head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        set_next(p_last, get_link(head));
+      } while (!free_head.compare_exchange_weak(head, make_head(head, first_link), etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Reduces the allocated count by n, if at least n are allocated.
+    //*************************************************************************
+    bool remove_allocated(uint32_t n)
+    {
+      uint32_t allocated = items_allocated.load(etl::memory_order_relaxed);
+
+      while (allocated >= n)
+      {
+        if (items_allocated.compare_exchange_weak(allocated, allocated - n, etl::memory_order_relaxed, etl::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if ETL_IS_DEBUG_BUILD
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % Item_Size) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    //*************************************************************************
+    /// Links are the offset of the item in the buffer plus one, so that zero
+    /// may mean 'none'. The low 32 bits of the head are the link to the top
+    /// item and the high 32 bits are the tag.
+    //*************************************************************************
+    uint32_t get_link(const char* p_item) const
+    {
+      return uint32_t(p_item - p_buffer) + 1U;
+    }
+
+    char* get_item(uint32_t link) const
+    {
+      return p_buffer + (link - 1U);
+    }
+
+    static uint32_t get_link(uint64_t head)
+    {
+      return uint32_t(head);
+    }
+
+    static uint64_t make_head(uint64_t old_head, uint32_t link)
+    {
+      return (((old_head >> 32U) + 1U) << 32U) | link;
+    }
+
+    static uint32_t get_next(const char* p_item)
+    {
+      return *reinterpret_cast<const volatile uint32_t*>(p_item);
+    }
+
+    static void set_next(char* p_item, uint32_t link)
+    {
+      *reinterpret_cast<uint32_t*>(p_item) = link;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_atomic(const ipool_atomic&);
+    ipool_atomic& operator =(const ipool_atomic&);
+
+    char* p_buffer;
+
+    etl::atomic<uint64_t> free_head;         ///< The tag and link of the top free item.
+    etl::atomic<uint32_t> items_initialised; ///< The number of items that have been used.
+    etl::atomic<uint32_t> items_allocated;   ///< The number of items allocated.
+
+    const uint32_t Item_Size; ///< The size of allocated items.
+    const uint32_t Max_Size;  ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_atomic()
+    {
+    }
+#else
+  protected:
+    ~ipool_atomic()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated lock free pool implementation that uses a fixed size pool.
+  ///\ingroup pool_atomic
+  //*************************************************************************
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  class generic_pool_atomic : public etl::ipool_atomic
+  {
+  public:
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = VAlignment;
+    static ETL_CONSTANT size_t TYPE_SIZE = VTypeSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_pool_atomic()
+      : etl::ipool_atomic(reinterpret_cast<char*>(&buffer[0]), Element_Size, VSize)
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::allocate<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// Returns a null pointer if there are no free items, without asserting.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* try_allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::try_allocate<U>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_ATOMIC_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      p_object->~U();
+      ipool_atomic::release(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      uint32_t next;             ///< Link to the next free element.
+      char     value[VTypeSize]; ///< Storage for value type.
+      typename etl::type_with_alignment<VAlignment>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
+
+    static ETL_CONSTANT uint32_t Element_Size = sizeof(Element);
+
+    // Should not be copied.
+    generic_pool_atomic(const generic_pool_atomic&) ETL_DELETE;
+    generic_pool_atomic& operator =(const generic_pool_atomic&) ETL_DELETE;
+  };
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::ALIGNMENT;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::TYPE_SIZE;
+
+  //*************************************************************************
+  /// A templated lock free pool implementation that uses a fixed size pool.
+  ///\ingroup pool_atomic
+  //*************************************************************************
+  template <typename T, const size_t VSize>
+  class pool_atomic : public etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize>
+  {
+  private:
+
+    typedef etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize> base_t;
+
+  public:
+
+    using base_t::SIZE;
+    using base_t::ALIGNMENT;
+    using base_t::TYPE_SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_atomic()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* allocate()
+    {
+      return base_t::template allocate<T>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_ATOMIC_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* create()
+    {
+      return base_t::template create<T>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1>
+    T* create(const T1& value1)
+    {
+      return base_t::template create<T>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      return base_t::template create<T>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return base_t::template create<T>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return base_t::template create<T>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with variadic parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+      return base_t::template create<T>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    template <typename U>
+    void release(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release(p_object);
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::destroy(p_object);
+    }
+
+  private:
+
+    // Should not be copied.
+    pool_atomic(const pool_atomic&) ETL_DELETE;
+    pool_atomic& operator =(const pool_atomic&) ETL_DELETE;
+  };
+
+  //*************************************************************************
+  /// A per thread cache of free items from an etl::ipool_atomic.
+  /// Each thread that uses the pool owns its own cache, and allocates and
+  /// releases through it. The cache takes free items from the pool, and
+  /// gives them back, in batches of half its size, so that most calls do
+  /// not touch the shared pool at all.
+  /// Items may be released through any cache of the pool, or the pool itself.
+  /// The destructor returns any cached items to the pool.
+  /// A cache must not be used by more than one thread at a time.
+  ///\ingroup pool_atomic
+  //*************************************************************************
+  template <size_t VSize>
+  class pool_atomic_cache
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize >= 2U, "Cache size must be at least 2");
+
+    static ETL_CONSTANT size_t SIZE  = VSize;
+    static ETL_CONSTANT size_t BATCH = VSize / 2U;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    explicit pool_atomic_cache(etl::ipool_atomic& pool_)
+      : pool(pool_),
+        p_head(ETL_NULLPTR),
+        count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor
+    /// Returns any cached items to the pool.
+    //*************************************************************************
+    ~pool_atomic_cache()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > pool.Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_ATOMIC_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > pool.Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object to the cache.
+    /// If asserts or exceptions are enabled and the object does not belong to the
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      release_item((char*)p);
+    }
+
+    //*************************************************************************
+    /// Returns all of the cached items to the pool.
+    //*************************************************************************
+    void flush()
+    {
+      give_back(count);
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items held by the cache.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the cache holds no free items.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of free items held by the cache.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Returns the pool that the cache takes items from.
+    //*************************************************************************
+    etl::ipool_atomic& get_pool() const
+    {
+      return pool;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item, taking a batch from the pool if the cache is empty.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      if (p_head == ETL_NULLPTR)
+      {
+        take(BATCH);
+      }
+
+      char* p_value = p_head;
+
+      if (p_value != ETL_NULLPTR)
+      {
+        p_head = next_of(p_value);
+        --count;
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
+
+      return p_value;
+    }
+
+    //*************************************************************************
+    /// Release an item, giving a batch back to the pool if the cache is full.
+    //*************************************************************************
+    void release_item(char* p_value)
+    {
+      // Does it belong to the pool?
+      ETL_ASSERT_OR_RETURN(pool.is_item_in_pool(p_value), ETL_ERROR(pool_object_not_in_pool));
+
+      if (count == VSize)
+      {
+        give_back(BATCH);
+      }
+
+      link(p_value, p_head);
+      p_head = p_value;
+      ++count;
+    }
+
+    //*************************************************************************
+    /// Takes up to n items from the pool.
+    //*************************************************************************
+    void take(size_t n)
+    {
+      uint32_t taken = 0U;
+
+      while (taken < n)
+      {
+        char* p_item = pool.pop_item();
+
+        if (p_item == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        link(p_item, p_head);
+        p_head = p_item;
+        ++taken;
+      }
+
+      if (taken != 0U)
+      {
+        pool.items_allocated.fetch_add(taken, etl::memory_order_relaxed);
+        count += taken;
+      }
+    }
+
+    //*************************************************************************
+    /// Gives n items back to the pool, as one chain.
+    //*************************************************************************
+    void give_back(size_t n)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      char* p_first = p_head;
+      char* p_last  = p_head;
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        p_last = next_of(p_last);
+      }
+
+      p_head = next_of(p_last);
+      count -= n;
+
+      pool.push_items(p_first, p_last);
+      pool.remove_allocated(uint32_t(n));
+    }
+
+    //*************************************************************************
+    /// Cached items are chained with the same links as the pool's free stack.
+    //*************************************************************************
+    char* next_of(const char* p_item) const
+    {
+      const uint32_t next = etl::ipool_atomic::get_next(p_item);
+
+      return (next == 0U) ? ETL_NULLPTR : pool.get_item(next);
+    }
+
+    void link(char* p_item, const char* p_next) const
+    {
+      etl::ipool_atomic::set_next(p_item, (p_next == ETL_NULLPTR) ? 0U : pool.get_link(p_next));
+    }
+
+    // Should not be copied.
+    pool_atomic_cache(const pool_atomic_cache&) ETL_DELETE;
+    pool_atomic_cache& operator =(const pool_atomic_cache&) ETL_DELETE;
+
+    etl::ipool_atomic& pool;
+    char*              p_head; ///< The first cached item.
+    size_t             count;  ///< The number of cached items.
+  };
+
+  template <size_t VSize>
+  ETL_CONSTANT size_t pool_atomic_cache<VSize>::SIZE;
+
+  template <size_t VSize>
+  ETL_CONSTANT size_t pool_atomic_cache<VSize>::BATCH;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,1603 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_BASE_INCLUDED
+#define ETL_BTREE_BASE_INCLUDED
+
+#include "../platform.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../type_traits.h"
+#include "../alignment.h"
+#include "../placement_new.h"
+#include "../nullptr.h"
+#include "comparator_is_transparent.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// Clamps a node capacity to a sensible range.
+    //*************************************************************************
+    template <size_t Capacity>
+    struct clamp_capacity
+    {
+      static ETL_CONSTANT size_t value = (Capacity < 4U) ? 4U : ((Capacity > 64U) ? 64U : Capacity);
+    };
+
+    template <size_t Capacity>
+    ETL_CONSTANT size_t clamp_capacity<Capacity>::value;
+
+    //*************************************************************************
+    /// The maximum number of inner nodes needed to index N leaves, when
+    /// every inner node except the root has at least Min_Children children.
+    //*************************************************************************
+    template <size_t N, size_t Min_Children, bool Is_Root = (N <= 1U)>
+    struct inner_node_count
+    {
+      static ETL_CONSTANT size_t parents = ((N / Min_Children) == 0U) ? 1U : (N / Min_Children);
+      static ETL_CONSTANT size_t value   = parents + inner_node_count<parents, Min_Children>::value;
+    };
+
+    template <size_t N, size_t Min_Children>
+    struct inner_node_count<N, Min_Children, true>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t N, size_t Min_Children, bool Is_Root>
+    ETL_CONSTANT size_t inner_node_count<N, Min_Children, Is_Root>::parents;
+
+    template <size_t N, size_t Min_Children, bool Is_Root>
+    ETL_CONSTANT size_t inner_node_count<N, Min_Children, Is_Root>::value;
+
+    template <size_t N, size_t Min_Children>
+    ETL_CONSTANT size_t inner_node_count<N, Min_Children, true>::value;
+
+    //*************************************************************************
+    /// Gets the key from a stored value that is the key.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_is_value
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key from a stored key/mapped pair.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct key_is_first
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// The common implementation of the B+tree containers.
+    /// Values are held, in order, in doubly linked leaf nodes of several cache
+    /// lines each. Inner nodes hold copies of the separating keys.
+    /// Node storage is supplied by the derived class.
+    ///\tparam TKey         The key type.
+    ///\tparam TValue       The stored value type.
+    ///\tparam TKeyCompare  The key comparison functor.
+    ///\tparam TKeyOf       Gets the key from a stored value.
+    ///\tparam TElement     The type the iterators refer to.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyCompare, typename TKeyOf, typename TElement>
+    class ibtree
+    {
+    public:
+
+      typedef TKey                                            key_type;
+      typedef typename etl::remove_const<TElement>::type      value_type;
+      typedef TKeyCompare                                     key_compare;
+      typedef TElement&                                       reference;
+      typedef const value_type&                               const_reference;
+      typedef TElement*                                       pointer;
+      typedef const value_type*                               const_pointer;
+      typedef size_t                                          size_type;
+      typedef ptrdiff_t                                       difference_type;
+
+      /// The number of values in a leaf node.
+      static ETL_CONSTANT size_t Leaf_Capacity = clamp_capacity<(4U * ETL_CACHE_LINE_SIZE) / sizeof(TValue)>::value;
+
+      /// The number of keys in an inner node.
+      static ETL_CONSTANT size_t Inner_Capacity = clamp_capacity<(4U * ETL_CACHE_LINE_SIZE) / (sizeof(TKey) + sizeof(void*))>::value;
+
+      /// The minimum number of values in a leaf node that is not the root.
+      static ETL_CONSTANT size_t Min_Leaf = Leaf_Capacity / 2U;
+
+      /// The minimum number of keys in an inner node that is not the root.
+      static ETL_CONSTANT size_t Min_Inner = (Inner_Capacity - 1U) / 2U;
+
+    protected:
+
+      //*************************************************************************
+      /// A leaf node.
+      /// 'next' is also the link in the free list.
+      //*************************************************************************
+      struct leaf_node
+      {
+        leaf_node* prev;
+        leaf_node* next;
+        size_t     count;
+        typename etl::aligned_storage<sizeof(TValue), etl::alignment_of<TValue>::value>::type values[Leaf_Capacity];
+      };
+
+      //*************************************************************************
+      /// An inner node.
+      /// 'children[0]' is also the link in the free list.
+      //*************************************************************************
+      struct inner_node
+      {
+        size_t count;
+        typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type keys[Inner_Capacity];
+        void* children[Inner_Capacity + 1U];
+      };
+
+    public:
+
+      //*************************************************************************
+      /// The number of nodes needed for a given number of values.
+      //*************************************************************************
+      template <size_t Max_Size>
+      struct node_count
+      {
+        static ETL_CONSTANT size_t leaves = (Max_Size / Min_Leaf) + 1U;
+        static ETL_CONSTANT size_t inners = inner_node_count<leaves, Min_Inner + 1U>::value + 1U;
+      };
+
+      class const_iterator;
+
+      //*************************************************************************
+      /// iterator.
+      //*************************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type, difference_type, pointer, reference>
+      {
+      public:
+
+        friend class ibtree;
+        friend class const_iterator;
+
+        iterator()
+          : p_tree(ETL_NULLPTR)
+          , p_leaf(ETL_NULLPTR)
+          , index(0U)
+        {
+        }
+
+        iterator(const iterator& other)
+          : p_tree(other.p_tree)
+          , p_leaf(other.p_leaf)
+          , index(other.index)
+        {
+        }
+
+        iterator& operator =(const iterator& other)
+        {
+          p_tree = other.p_tree;
+          p_leaf = other.p_leaf;
+          index  = other.index;
+          return *this;
+        }
+
+        iterator& operator ++()
+        {
+          if (++index == p_leaf->count)
+          {
+            p_leaf = p_leaf->next;
+            index  = 0U;
+          }
+
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        iterator& operator --()
+        {
+          if (p_leaf == ETL_NULLPTR)
+          {
+            p_leaf = p_tree->p_tail;
+            index  = p_leaf->count - 1U;
+          }
+          else if (index == 0U)
+          {
+            p_leaf = p_leaf->prev;
+            index  = p_leaf->count - 1U;
+          }
+          else
+          {
+            --index;
+          }
+
+          return *this;
+        }
+
+        iterator operator --(int)
+        {
+          iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        reference operator *() const
+        {
+          return ibtree::element_at(*p_leaf, index);
+        }
+
+        pointer operator ->() const
+        {
+          return &ibtree::element_at(*p_leaf, index);
+        }
+
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+        }
+
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        iterator(ibtree* p_tree_, leaf_node* p_leaf_, size_t index_)
+          : p_tree(p_tree_)
+          , p_leaf(p_leaf_)
+          , index(index_)
+        {
+        }
+
+        ibtree*    p_tree;
+        leaf_node* p_leaf;
+        size_t     index;
+      };
+
+      //*************************************************************************
+      /// const_iterator.
+      //*************************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type, difference_type, const_pointer, const_reference>
+      {
+      public:
+
+        friend class ibtree;
+
+        const_iterator()
+          : p_tree(ETL_NULLPTR)
+          , p_leaf(ETL_NULLPTR)
+          , index(0U)
+        {
+        }
+
+        const_iterator(const typename ibtree::iterator& other)
+          : p_tree(other.p_tree)
+          , p_leaf(other.p_leaf)
+          , index(other.index)
+        {
+        }
+
+        const_iterator(const const_iterator& other)
+          : p_tree(other.p_tree)
+          , p_leaf(other.p_leaf)
+          , index(other.index)
+        {
+        }
+
+        const_iterator& operator =(const const_iterator& other)
+        {
+          p_tree = other.p_tree;
+          p_leaf = other.p_leaf;
+          index  = other.index;
+          return *this;
+        }
+
+        const_iterator& operator ++()
+        {
+          if (++index == p_leaf->count)
+          {
+            p_leaf = p_leaf->next;
+            index  = 0U;
+          }
+
+          return *this;
+        }
+
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        const_iterator& operator --()
+        {
+          if (p_leaf == ETL_NULLPTR)
+          {
+            p_leaf = p_tree->p_tail;
+            index  = p_leaf->count - 1U;
+          }
+          else if (index == 0U)
+          {
+            p_leaf = p_leaf->prev;
+            index  = p_leaf->count - 1U;
+          }
+          else
+          {
+            --index;
+          }
+
+          return *this;
+        }
+
+        const_iterator operator --(int)
+        {
+          const_iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        const_reference operator *() const
+        {
+          return ibtree::element_at(*p_leaf, index);
+        }
+
+        const_pointer operator ->() const
+        {
+          return &ibtree::element_at(*p_leaf, index);
+        }
+
+        friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+        }
+
+        friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        const_iterator(const ibtree* p_tree_, const leaf_node* p_leaf_, size_t index_)
+          : p_tree(p_tree_)
+          , p_leaf(p_leaf_)
+          , index(index_)
+        {
+        }
+
+        const ibtree*    p_tree;
+        const leaf_node* p_leaf;
+        size_t           index;
+      };
+
+      typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+      typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+      //*************************************************************************
+      /// Gets the beginning of the container.
+      //*************************************************************************
+      iterator begin()
+      {
+        return iterator(this, p_head, 0U);
+      }
+
+      //*************************************************************************
+      /// Gets the beginning of the container.
+      //*************************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(this, p_head, 0U);
+      }
+
+      //*************************************************************************
+      /// Gets the beginning of the container.
+      //*************************************************************************
+      const_iterator cbegin() const
+      {
+        return const_iterator(this, p_head, 0U);
+      }
+
+      //*************************************************************************
+      /// Gets the end of the container.
+      //*************************************************************************
+      iterator end()
+      {
+        return iterator(this, ETL_NULLPTR, 0U);
+      }
+
+      //*************************************************************************
+      /// Gets the end of the container.
+      //*************************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(this, ETL_NULLPTR, 0U);
+      }
+
+      //*************************************************************************
+      /// Gets the end of the container.
+      //*************************************************************************
+      const_iterator cend() const
+      {
+        return const_iterator(this, ETL_NULLPTR, 0U);
+      }
+
+      //*************************************************************************
+      /// Gets the reverse beginning of the container.
+      //*************************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse beginning of the container.
+      //*************************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse beginning of the container.
+      //*************************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(cend());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse end of the container.
+      //*************************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse end of the container.
+      //*************************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse end of the container.
+      //*************************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(cbegin());
+      }
+
+      //*************************************************************************
+      /// Finds an element.
+      //*************************************************************************
+      iterator find(const key_type& key)
+      {
+        return find_implementation(key);
+      }
+
+      //*************************************************************************
+      /// Finds an element.
+      //*************************************************************************
+      const_iterator find(const key_type& key) const
+      {
+        return const_iterator(const_cast<ibtree*>(this)->find_implementation(key));
+      }
+
+#if ETL_USING_CPP11
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      iterator find(const K& key)
+      {
+        return find_implementation(key);
+      }
+
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      const_iterator find(const K& key) const
+      {
+        return const_iterator(const_cast<ibtree*>(this)->find_implementation(key));
+      }
+#endif
+
+      //*************************************************************************
+      /// Counts the number of elements that match the key.
+      //*************************************************************************
+      size_type count(const key_type& key) const
+      {
+        return (find(key) == end()) ? 0U : 1U;
+      }
+
+#if ETL_USING_CPP11
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      size_type count(const K& key) const
+      {
+        return (find(key) == end()) ? 0U : 1U;
+      }
+#endif
+
+      //*************************************************************************
+      /// Checks if the container contains an element with the key.
+      //*************************************************************************
+      bool contains(const key_type& key) const
+      {
+        return find(key) != end();
+      }
+
+#if ETL_USING_CPP11
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      bool contains(const K& key) const
+      {
+        return find(key) != end();
+      }
+#endif
+
+      //*************************************************************************
+      /// Gets the first element not less than the key.
+      //*************************************************************************
+      iterator lower_bound(const key_type& key)
+      {
+        return lower_bound_implementation(key);
+      }
+
+      //*************************************************************************
+      /// Gets the first element not less than the key.
+      //*************************************************************************
+      const_iterator lower_bound(const key_type& key) const
+      {
+        return const_iterator(const_cast<ibtree*>(this)->lower_bound_implementation(key));
+      }
+
+#if ETL_USING_CPP11
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      iterator lower_bound(const K& key)
+      {
+        return lower_bound_implementation(key);
+      }
+
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      const_iterator lower_bound(const K& key) const
+      {
+        return const_iterator(const_cast<ibtree*>(this)->lower_bound_implementation(key));
+      }
+#endif
+
+      //*************************************************************************
+      /// Gets the first element greater than the key.
+      //*************************************************************************
+      iterator upper_bound(const key_type& key)
+      {
+        return upper_bound_implementation(key);
+      }
+
+      //*************************************************************************
+      /// Gets the first element greater than the key.
+      //*************************************************************************
+      const_iterator upper_bound(const key_type& key) const
+      {
+        return const_iterator(const_cast<ibtree*>(this)->upper_bound_implementation(key));
+      }
+
+#if ETL_USING_CPP11
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      iterator upper_bound(const K& key)
+      {
+        return upper_bound_implementation(key);
+      }
+
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      const_iterator upper_bound(const K& key) const
+      {
+        return const_iterator(const_cast<ibtree*>(this)->upper_bound_implementation(key));
+      }
+#endif
+
+      //*************************************************************************
+      /// Gets the range of elements that match the key.
+      //*************************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const key_type& key)
+      {
+        return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+      }
+
+      //*************************************************************************
+      /// Gets the range of elements that match the key.
+      //*************************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+      {
+        return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+      }
+
+#if ETL_USING_CPP11
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+      {
+        return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+      }
+
+      //*************************************************************************
+      template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+      {
+        return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+      }
+#endif
+
+      //*************************************************************************
+      /// Erases the element with the key.
+      ///\return The number of elements erased, 0 or 1.
+      //*************************************************************************
+      size_type erase(const key_type& key)
+      {
+        if (find(key) == end())
+        {
+          return 0U;
+        }
+
+        erase_implementation(key);
+
+        return 1U;
+      }
+
+      //*************************************************************************
+      /// Erases the element at the iterator.
+      ///\return An iterator to the element following the erased one.
+      //*************************************************************************
+      iterator erase(const_iterator position)
+      {
+        // Copy the key, as the element may be moved as the tree is rebalanced.
+        const key_type key(TKeyOf::get(value_at(*position.p_leaf, position.index)));
+
+        return erase_implementation(key);
+      }
+
+      //*************************************************************************
+      /// Erases a range of elements.
+      ///\return An iterator to the element following the erased ones.
+      //*************************************************************************
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        size_t n = static_cast<size_t>(etl::distance(first, last));
+
+        if (n == 0U)
+        {
+          return iterator(this, const_cast<leaf_node*>(first.p_leaf), first.index);
+        }
+
+        iterator position = erase(first);
+
+        while (--n != 0U)
+        {
+          position = erase(position);
+        }
+
+        return position;
+      }
+
+      //*************************************************************************
+      /// Clears the container.
+      //*************************************************************************
+      void clear()
+      {
+        if (p_root != ETL_NULLPTR)
+        {
+          destroy_node(p_root, height);
+        }
+
+        initialise();
+      }
+
+      //*************************************************************************
+      /// Gets the size of the container.
+      //*************************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*************************************************************************
+      /// Gets the maximum possible size of the container.
+      //*************************************************************************
+      size_type max_size() const
+      {
+        return CAPACITY;
+      }
+
+      //*************************************************************************
+      /// Gets the capacity of the container.
+      //*************************************************************************
+      size_type capacity() const
+      {
+        return CAPACITY;
+      }
+
+      //*************************************************************************
+      /// Checks if the container is empty.
+      //*************************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*************************************************************************
+      /// Checks if the container is full.
+      //*************************************************************************
+      bool full() const
+      {
+        return current_size == CAPACITY;
+      }
+
+      //*************************************************************************
+      /// Gets the number of free elements.
+      //*************************************************************************
+      size_type available() const
+      {
+        return CAPACITY - current_size;
+      }
+
+      //*************************************************************************
+      /// Gets the key comparison functor.
+      //*************************************************************************
+      key_compare key_comp() const
+      {
+        return compare;
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Constructor.
+      //*************************************************************************
+      ibtree(leaf_node* p_leaves_, size_t n_leaves_, inner_node* p_inners_, size_t n_inners_, size_t capacity_)
+        : p_leaves(p_leaves_)
+        , n_leaves(n_leaves_)
+        , p_inners(p_inners_)
+        , n_inners(n_inners_)
+        , p_root(ETL_NULLPTR)
+        , p_head(ETL_NULLPTR)
+        , p_tail(ETL_NULLPTR)
+        , p_free_leaves(ETL_NULLPTR)
+        , p_free_inners(ETL_NULLPTR)
+        , height(0U)
+        , current_size(0U)
+        , p_last_slot_leaf(ETL_NULLPTR)
+        , last_slot_index(0U)
+        , CAPACITY(capacity_)
+      {
+      }
+
+      //*************************************************************************
+      /// Resets the tree to empty and rebuilds the free lists.
+      /// Called from the derived constructor once the node storage exists.
+      //*************************************************************************
+      void initialise()
+      {
+        p_root       = ETL_NULLPTR;
+        p_head       = ETL_NULLPTR;
+        p_tail       = ETL_NULLPTR;
+        height       = 0U;
+        current_size = 0U;
+
+        p_free_leaves = ETL_NULLPTR;
+
+        for (size_t i = n_leaves; i != 0U; --i)
+        {
+          p_leaves[i - 1U].next = p_free_leaves;
+          p_free_leaves = &p_leaves[i - 1U];
+        }
+
+        p_free_inners = ETL_NULLPTR;
+
+        for (size_t i = n_inners; i != 0U; --i)
+        {
+          p_inners[i - 1U].children[0] = p_free_inners;
+          p_free_inners = &p_inners[i - 1U];
+        }
+      }
+
+      //*************************************************************************
+      /// Makes a slot for a new value with the key.
+      /// The key must not already be in the tree, and the tree must not be full.
+      /// Full nodes are split on the way down, so that there is always room for
+      /// the key that a split child passes up.
+      ///\return A pointer to the uninitialised slot.
+      //*************************************************************************
+      template <typename K>
+      TValue* make_slot(const K& key)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          leaf_node* p_leaf = allocate_leaf();
+          p_root = p_leaf;
+          p_head = p_leaf;
+          p_tail = p_leaf;
+          height = 1U;
+        }
+        else if (is_full(p_root, height))
+        {
+          inner_node* p_new_root = allocate_inner();
+          p_new_root->children[0] = p_root;
+          split_child(*p_new_root, 0U, height);
+          p_root = p_new_root;
+          ++height;
+        }
+
+        void* p_node = p_root;
+
+        for (size_t level = height; level > 1U; --level)
+        {
+          inner_node& inner = *static_cast<inner_node*>(p_node);
+          size_t      child = inner_upper_bound(inner, key);
+
+          if (is_full(inner.children[child], level - 1U))
+          {
+            split_child(inner, child, level - 1U);
+
+            if (!compare(key, key_at(inner, child)))
+            {
+              ++child;
+            }
+          }
+
+          p_node = inner.children[child];
+        }
+
+        leaf_node& leaf     = *static_cast<leaf_node*>(p_node);
+        size_t     position = leaf_lower_bound(leaf, key);
+
+        for (size_t i = leaf.count; i > position; --i)
+        {
+          relocate(value_at(leaf, i), value_at(leaf, i - 1U));
+        }
+
+        ++leaf.count;
+        ++current_size;
+        p_last_slot_leaf  = &leaf;
+        last_slot_index   = position;
+
+        return &value_at(leaf, position);
+      }
+
+      //*************************************************************************
+      /// Gets an iterator to the slot returned by the last call to make_slot.
+      //*************************************************************************
+      iterator last_slot()
+      {
+        return iterator(this, p_last_slot_leaf, last_slot_index);
+      }
+
+      //*************************************************************************
+      /// Destroys the values and keys in a subtree.
+      //*************************************************************************
+      void destroy_node(void* p_node, size_t level)
+      {
+        if (level == 1U)
+        {
+          leaf_node& leaf = *static_cast<leaf_node*>(p_node);
+
+          for (size_t i = 0U; i < leaf.count; ++i)
+          {
+            value_at(leaf, i).~TValue();
+          }
+        }
+        else
+        {
+          inner_node& inner = *static_cast<inner_node*>(p_node);
+
+          for (size_t i = 0U; i <= inner.count; ++i)
+          {
+            destroy_node(inner.children[i], level - 1U);
+          }
+
+          for (size_t i = 0U; i < inner.count; ++i)
+          {
+            key_at(inner, i).~TKey();
+          }
+        }
+      }
+
+      key_compare compare; ///< The key comparison functor.
+
+    private:
+
+      //*************************************************************************
+      static TValue& value_at(leaf_node& leaf, size_t i)
+      {
+        return *reinterpret_cast<TValue*>(&leaf.values[i]);
+      }
+
+      //*************************************************************************
+      static const TValue& value_at(const leaf_node& leaf, size_t i)
+      {
+        return *reinterpret_cast<const TValue*>(&leaf.values[i]);
+      }
+
+      //*************************************************************************
+      static TElement& element_at(const leaf_node& leaf, size_t i)
+      {
+        return *reinterpret_cast<TElement*>(const_cast<TValue*>(&value_at(leaf, i)));
+      }
+
+      //*************************************************************************
+      static const TKey& leaf_key(const leaf_node& leaf, size_t i)
+      {
+        return TKeyOf::get(value_at(leaf, i));
+      }
+
+      //*************************************************************************
+      static TKey& key_at(inner_node& inner, size_t i)
+      {
+        return *reinterpret_cast<TKey*>(&inner.keys[i]);
+      }
+
+      //*************************************************************************
+      static const TKey& key_at(const inner_node& inner, size_t i)
+      {
+        return *reinterpret_cast<const TKey*>(&inner.keys[i]);
+      }
+
+      //*************************************************************************
+      /// Moves an object into uninitialised storage and destroys the original.
+      //*************************************************************************
+      template <typename T>
+      static void relocate(T& destination, T& source)
+      {
+        ::new (&destination) T(ETL_MOVE(source));
+        source.~T();
+      }
+
+      //*************************************************************************
+      /// Is the node at the level full?
+      //*************************************************************************
+      static bool is_full(void* p_node, size_t level)
+      {
+        return (level == 1U) ? (static_cast<leaf_node*>(p_node)->count == Leaf_Capacity)
+                             : (static_cast<inner_node*>(p_node)->count == Inner_Capacity);
+      }
+
+      //*************************************************************************
+      /// Is the node at the level at its minimum size?
+      //*************************************************************************
+      static bool is_minimal(void* p_node, size_t level)
+      {
+        return (level == 1U) ? (static_cast<leaf_node*>(p_node)->count <= Min_Leaf)
+                             : (static_cast<inner_node*>(p_node)->count <= Min_Inner);
+      }
+
+      //*************************************************************************
+      /// The index of the first value in the leaf not less than the key.
+      //*************************************************************************
+      template <typename K>
+      size_t leaf_lower_bound(const leaf_node& leaf, const K& key) const
+      {
+        size_t first = 0U;
+        size_t n     = leaf.count;
+
+        while (n != 0U)
+        {
+          size_t half = n / 2U;
+
+          if (compare(leaf_key(leaf, first + half), key))
+          {
+            first += half + 1U;
+            n     -= half + 1U;
+          }
+          else
+          {
+            n = half;
+          }
+        }
+
+        return first;
+      }
+
+      //*************************************************************************
+      /// The index of the first value in the leaf greater than the key.
+      //*************************************************************************
+      template <typename K>
+      size_t leaf_upper_bound(const leaf_node& leaf, const K& key) const
+      {
+        size_t first = 0U;
+        size_t n     = leaf.count;
+
+        while (n != 0U)
+        {
+          size_t half = n / 2U;
+
+          if (!compare(key, leaf_key(leaf, first + half)))
+          {
+            first += half + 1U;
+            n     -= half + 1U;
+          }
+          else
+          {
+            n = half;
+          }
+        }
+
+        return first;
+      }
+
+      //*************************************************************************
+      /// The index of the child of the inner node that may contain the key.
+      //*************************************************************************
+      template <typename K>
+      size_t inner_upper_bound(const inner_node& inner, const K& key) const
+      {
+        size_t first = 0U;
+        size_t n     = inner.count;
+
+        while (n != 0U)
+        {
+          size_t half = n / 2U;
+
+          if (!compare(key, key_at(inner, first + half)))
+          {
+            first += half + 1U;
+            n     -= half + 1U;
+          }
+          else
+          {
+            n = half;
+          }
+        }
+
+        return first;
+      }
+
+      //*************************************************************************
+      /// Finds the leaf that may contain the key.
+      //*************************************************************************
+      template <typename K>
+      leaf_node* find_leaf(const K& key) const
+      {
+        void* p_node = p_root;
+
+        for (size_t level = height; level > 1U; --level)
+        {
+          const inner_node& inner = *static_cast<const inner_node*>(p_node);
+          p_node = inner.children[inner_upper_bound(inner, key)];
+        }
+
+        return static_cast<leaf_node*>(p_node);
+      }
+
+      //*************************************************************************
+      /// Makes an iterator from a leaf position, moving to the next leaf if
+      /// the position is past the last value.
+      //*************************************************************************
+      iterator make_iterator(leaf_node* p_leaf, size_t index)
+      {
+        if (index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return iterator(this, p_leaf, index);
+      }
+
+      //*************************************************************************
+      template <typename K>
+      iterator find_implementation(const K& key)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          return end();
+        }
+
+        leaf_node* p_leaf = find_leaf(key);
+        size_t     index  = leaf_lower_bound(*p_leaf, key);
+
+        if ((index != p_leaf->count) && !compare(key, leaf_key(*p_leaf, index)))
+        {
+          return iterator(this, p_leaf, index);
+        }
+
+        return end();
+      }
+
+      //*************************************************************************
+      template <typename K>
+      iterator lower_bound_implementation(const K& key)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          return end();
+        }
+
+        leaf_node* p_leaf = find_leaf(key);
+
+        return make_iterator(p_leaf, leaf_lower_bound(*p_leaf, key));
+      }
+
+      //*************************************************************************
+      template <typename K>
+      iterator upper_bound_implementation(const K& key)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          return end();
+        }
+
+        leaf_node* p_leaf = find_leaf(key);
+
+        return make_iterator(p_leaf, leaf_upper_bound(*p_leaf, key));
+      }
+
+      //*************************************************************************
+      /// Erases the value with the key, which must be in the tree.
+      /// Children at their minimum size are refilled on the way down, so that
+      /// removing a value never leaves a node under its minimum.
+      //*************************************************************************
+      template <typename K>
+      iterator erase_implementation(const K& key)
+      {
+        void* p_node = p_root;
+
+        for (size_t level = height; level > 1U; --level)
+        {
+          inner_node& inner = *static_cast<inner_node*>(p_node);
+          size_t      child = inner_upper_bound(inner, key);
+
+          if (is_minimal(inner.children[child], level - 1U))
+          {
+            child = refill_child(inner, child, level - 1U);
+          }
+
+          p_node = inner.children[child];
+        }
+
+        // Merging the only two children of the root leaves it empty.
+        while ((height > 1U) && (static_cast<inner_node*>(p_root)->count == 0U))
+        {
+          inner_node* p_old_root = static_cast<inner_node*>(p_root);
+          p_root = p_old_root->children[0];
+          release_inner(p_old_root);
+          --height;
+        }
+
+        leaf_node& leaf     = *static_cast<leaf_node*>(p_node);
+        size_t     position = leaf_lower_bound(leaf, key);
+
+        value_at(leaf, position).~TValue();
+
+        for (size_t i = position + 1U; i < leaf.count; ++i)
+        {
+          relocate(value_at(leaf, i - 1U), value_at(leaf, i));
+        }
+
+        --leaf.count;
+        --current_size;
+
+        if (leaf.count == 0U)
+        {
+          // Only the root leaf can become empty.
+          release_leaf(&leaf);
+          p_root = ETL_NULLPTR;
+          p_head = ETL_NULLPTR;
+          p_tail = ETL_NULLPTR;
+          height = 0U;
+
+          return end();
+        }
+
+        return make_iterator(&leaf, position);
+      }
+
+      //*************************************************************************
+      /// Splits the full child of an inner node in two.
+      /// The inner node must not be full.
+      //*************************************************************************
+      void split_child(inner_node& parent, size_t child, size_t child_level)
+      {
+        void* p_right;
+
+        // Make room in the parent for the new separator and child.
+        for (size_t i = parent.count; i > child; --i)
+        {
+          relocate(key_at(parent, i), key_at(parent, i - 1U));
+          parent.children[i + 1U] = parent.children[i];
+        }
+
+        if (child_level == 1U)
+        {
+          leaf_node& left  = *static_cast<leaf_node*>(parent.children[child]);
+          leaf_node& right = *allocate_leaf();
+
+          const size_t split = Leaf_Capacity / 2U;
+
+          for (size_t i = split; i < Leaf_Capacity; ++i)
+          {
+            relocate(value_at(right, i - split), value_at(left, i));
+          }
+
+          right.count = Leaf_Capacity - split;
+          left.count  = split;
+
+          right.prev = &left;
+          right.next = left.next;
+
+          if (left.next != ETL_NULLPTR)
+          {
+            left.next->prev = &right;
+          }
+          else
+          {
+            p_tail = &right;
+          }
+
+          left.next = &right;
+
+          ::new (&key_at(parent, child)) TKey(leaf_key(right, 0U));
+
+          p_right = &right;
+        }
+        else
+        {
+          inner_node& left  = *static_cast<inner_node*>(parent.children[child]);
+          inner_node& right = *allocate_inner();
+
+          const size_t split = Inner_Capacity / 2U;
+
+          for (size_t i = split + 1U; i < Inner_Capacity; ++i)
+          {
+            relocate(key_at(right, i - split - 1U), key_at(left, i));
+          }
+
+          for (size_t i = split + 1U; i <= Inner_Capacity; ++i)
+          {
+            right.children[i - split - 1U] = left.children[i];
+          }
+
+          right.count = Inner_Capacity - split - 1U;
+          left.count  = split;
+
+          // The middle key moves up to the parent.
+          relocate(key_at(parent, child), key_at(left, split));
+
+          p_right = &right;
+        }
+
+        parent.children[child + 1U] = p_right;
+        ++parent.count;
+      }
+
+      //*************************************************************************
+      /// Refills a child at its minimum size, either by borrowing from a
+      /// sibling or by merging with one.
+      ///\return The index of the child that now covers the original child's range.
+      //*************************************************************************
+      size_t refill_child(inner_node& parent, size_t child, size_t child_level)
+      {
+        if (child_level == 1U)
+        {
+          leaf_node& node   = *static_cast<leaf_node*>(parent.children[child]);
+          leaf_node* p_left  = (child > 0U)           ? static_cast<leaf_node*>(parent.children[child - 1U]) : ETL_NULLPTR;
+          leaf_node* p_right = (child < parent.count) ? static_cast<leaf_node*>(parent.children[child + 1U]) : ETL_NULLPTR;
+
+          if ((p_left != ETL_NULLPTR) && (p_left->count > Min_Leaf))
+          {
+            // Borrow the last value of the left sibling.
+            for (size_t i = node.count; i > 0U; --i)
+            {
+              relocate(value_at(node, i), value_at(node, i - 1U));
+            }
+
+            relocate(value_at(node, 0U), value_at(*p_left, p_left->count - 1U));
+            --p_left->count;
+            ++node.count;
+
+            key_at(parent, child - 1U) = leaf_key(node, 0U);
+
+            return child;
+          }
+
+          if ((p_right != ETL_NULLPTR) && (p_right->count > Min_Leaf))
+          {
+            // Borrow the first value of the right sibling.
+            relocate(value_at(node, node.count), value_at(*p_right, 0U));
+
+            for (size_t i = 1U; i < p_right->count; ++i)
+            {
+              relocate(value_at(*p_right, i - 1U), value_at(*p_right, i));
+            }
+
+            --p_right->count;
+            ++node.count;
+
+            key_at(parent, child) = leaf_key(*p_right, 0U);
+
+            return child;
+          }
+
+          if (p_left != ETL_NULLPTR)
+          {
+            merge_leaves(parent, child - 1U);
+
+            return child - 1U;
+          }
+
+          merge_leaves(parent, child);
+
+          return child;
+        }
+        else
+        {
+          inner_node& node    = *static_cast<inner_node*>(parent.children[child]);
+          inner_node* p_left  = (child > 0U)           ? static_cast<inner_node*>(parent.children[child - 1U]) : ETL_NULLPTR;
+          inner_node* p_right = (child < parent.count) ? static_cast<inner_node*>(parent.children[child + 1U]) : ETL_NULLPTR;
+
+          if ((p_left != ETL_NULLPTR) && (p_left->count > Min_Inner))
+          {
+            // Rotate the last key and child of the left sibling through the parent.
+            node.children[node.count + 1U] = node.children[node.count];
+
+            for (size_t i = node.count; i > 0U; --i)
+            {
+              relocate(key_at(node, i), key_at(node, i - 1U));
+              node.children[i] = node.children[i - 1U];
+            }
+
+            relocate(key_at(node, 0U), key_at(parent, child - 1U));
+            node.children[0] = p_left->children[p_left->count];
+            relocate(key_at(parent, child - 1U), key_at(*p_left, p_left->count - 1U));
+
+            --p_left->count;
+            ++node.count;
+
+            return child;
+          }
+
+          if ((p_right != ETL_NULLPTR) && (p_right->count > Min_Inner))
+          {
+            // Rotate the first key and child of the right sibling through the parent.
+            relocate(key_at(node, node.count), key_at(parent, child));
+            node.children[node.count + 1U] = p_right->children[0];
+            relocate(key_at(parent, child), key_at(*p_right, 0U));
+
+            for (size_t i = 1U; i < p_right->count; ++i)
+            {
+              relocate(key_at(*p_right, i - 1U), key_at(*p_right, i));
+            }
+
+            for (size_t i = 1U; i <= p_right->count; ++i)
+            {
+              p_right->children[i - 1U] = p_right->children[i];
+            }
+
+            --p_right->count;
+            ++node.count;
+
+            return child;
+          }
+
+          if (p_left != ETL_NULLPTR)
+          {
+            merge_inners(parent, child - 1U);
+
+            return child - 1U;
+          }
+
+          merge_inners(parent, child);
+
+          return child;
+        }
+      }
+
+      //*************************************************************************
+      /// Merges the leaf at index + 1 into the leaf at index.
+      //*************************************************************************
+      void merge_leaves(inner_node& parent, size_t index)
+      {
+        leaf_node& left  = *static_cast<leaf_node*>(parent.children[index]);
+        leaf_node& right = *static_cast<leaf_node*>(parent.children[index + 1U]);
+
+        for (size_t i = 0U; i < right.count; ++i)
+        {
+          relocate(value_at(left, left.count + i), value_at(right, i));
+        }
+
+        left.count += right.count;
+        left.next   = right.next;
+
+        if (right.next != ETL_NULLPTR)
+        {
+          right.next->prev = &left;
+        }
+        else
+        {
+          p_tail = &left;
+        }
+
+        release_leaf(&right);
+
+        key_at(parent, index).~TKey();
+        remove_from_parent(parent, index);
+      }
+
+      //*************************************************************************
+      /// Merges the inner node at index + 1 into the inner node at index,
+      /// pulling down the separating key from the parent.
+      //*************************************************************************
+      void merge_inners(inner_node& parent, size_t index)
+      {
+        inner_node& left  = *static_cast<inner_node*>(parent.children[index]);
+        inner_node& right = *static_cast<inner_node*>(parent.children[index + 1U]);
+
+        relocate(key_at(left, left.count), key_at(parent, index));
+
+        for (size_t i = 0U; i < right.count; ++i)
+        {
+          relocate(key_at(left, left.count + 1U + i), key_at(right, i));
+        }
+
+        for (size_t i = 0U; i <= right.count; ++i)
+        {
+          left.children[left.count + 1U + i] = right.children[i];
+        }
+
+        left.count += right.count + 1U;
+
+        release_inner(&right);
+
+        remove_from_parent(parent, index);
+      }
+
+      //*************************************************************************
+      /// Closes the gap left in the parent by a merge.
+      /// The key at 'index' has already been moved or destroyed.
+      //*************************************************************************
+      void remove_from_parent(inner_node& parent, size_t index)
+      {
+        for (size_t i = index + 1U; i < parent.count; ++i)
+        {
+          relocate(key_at(parent, i - 1U), key_at(parent, i));
+          parent.children[i] = parent.children[i + 1U];
+        }
+
+        --parent.count;
+      }
+
+      //*************************************************************************
+      leaf_node* allocate_leaf()
+      {
+        leaf_node* p_leaf = p_free_leaves;
+        p_free_leaves = p_leaf->next;
+
+        p_leaf->prev  = ETL_NULLPTR;
+        p_leaf->next  = ETL_NULLPTR;
+        p_leaf->count = 0U;
+
+        return p_leaf;
+      }
+
+      //*************************************************************************
+      void release_leaf(leaf_node* p_leaf)
+      {
+        p_leaf->next  = p_free_leaves;
+        p_free_leaves = p_leaf;
+      }
+
+      //*************************************************************************
+      inner_node* allocate_inner()
+      {
+        inner_node* p_inner = p_free_inners;
+        p_free_inners = static_cast<inner_node*>(p_inner->children[0]);
+
+        p_inner->count = 0U;
+
+        return p_inner;
+      }
+
+      //*************************************************************************
+      void release_inner(inner_node* p_inner)
+      {
+        p_inner->children[0] = p_free_inners;
+        p_free_inners = p_inner;
+      }
+
+      leaf_node*  p_leaves;         ///< The leaf node storage.
+      size_t      n_leaves;         ///< The number of leaf nodes.
+      inner_node* p_inners;         ///< The inner node storage.
+      size_t      n_inners;         ///< The number of inner nodes.
+      void*       p_root;           ///< The root node. A leaf when the height is 1.
+      leaf_node*  p_head;           ///< The first leaf.
+      leaf_node*  p_tail;           ///< The last leaf.
+      leaf_node*  p_free_leaves;    ///< The free leaf nodes.
+      inner_node* p_free_inners;    ///< The free inner nodes.
+      size_t      height;           ///< The number of levels. 0 when empty.
+      size_t      current_size;     ///< The number of values.
+      leaf_node*  p_last_slot_leaf; ///< The leaf of the last slot made.
+      size_t      last_slot_index;  ///< The index of the last slot made.
+
+      const size_t CAPACITY;        ///< The maximum number of values.
+
+      // Disable copy construction and assignment.
+      ibtree(const ibtree&);
+      ibtree& operator =(const ibtree&);
+
+    protected:
+
+      //*************************************************************************
+      /// Destructor.
+      //*************************************************************************
+      ~ibtree()
+      {
+      }
+    };
+
+    template <typename TKey, typename TValue, typename TKeyCompare, typename TKeyOf, typename TElement>
+    ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyCompare, TKeyOf, TElement>::Leaf_Capacity;
+
+    template <typename TKey, typename TValue, typename TKeyCompare, typename TKeyOf, typename TElement>
+    ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyCompare, TKeyOf, TElement>::Inner_Capacity;
+
+    template <typename TKey, typename TValue, typename TKeyCompare, typename TKeyOf, typename TElement>
+    ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyCompare, TKeyOf, TElement>::Min_Leaf;
+
+    template <typename TKey, typename TValue, typename TKeyCompare, typename TKeyOf, typename TElement>
+    ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyCompare, TKeyOf, TElement>::Min_Inner;
+
+    template <typename TKey, typename TValue, typename TKeyCompare, typename TKeyOf, typename TElement>
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyCompare, TKeyOf, TElement>::node_count<Max_Size>::leaves;
+
+    template <typename TKey, typename TValue, typename TKeyCompare, typename TKeyOf, typename TElement>
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyCompare, TKeyOf, TElement>::node_count<Max_Size>::inners;
+  }
+}
+
+#endif
@@ -36,9 +36,15 @@ SOFTWARE.
 #include "../static_assert.h"
 #include "../binary.h"
 #include "../type_traits.h"
+#include "../iterator.h"
 
 #include "stdint.h"
 
+#if ETL_USING_SSE42
+  #include <string.h>
+  #include <nmmintrin.h>
+#endif
+
 #include "crc_parameters.h"
 
 #if defined(ETL_COMPILER_KEIL)
@@ -587,6 +593,230 @@ namespace etl
       }
     };
 
+    //*****************************************************************************
+    /// CRC Slice Table.
+    /// Slicing-by-N tables. Slice 0 is the standard 256 entry table.
+    /// Slice s holds the CRC of each byte value followed by s zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table
+    {
+      //*************************************************************************
+      ETL_CONSTEXPR14 crc_slice_table()
+        : entries()
+      {
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          entries[0U][i] = byte_entry(i);
+        }
+
+        for (size_t slice = 1U; slice < Slices; ++slice)
+        {
+          for (size_t i = 0U; i < 256U; ++i)
+          {
+            const TAccumulator previous = entries[slice - 1U][i];
+
+            if ETL_IF_CONSTEXPR(Reflect)
+            {
+              entries[slice][i] = TAccumulator(shift_right_8(previous) ^ entries[0U][previous & 0xFFU]);
+            }
+            else
+            {
+              entries[slice][i] = TAccumulator(shift_left_8(previous) ^ entries[0U][(previous >> (Accumulator_Bits - 8U)) & 0xFFU]);
+            }
+          }
+        }
+      }
+
+      TAccumulator entries[Slices][256U];
+
+    private:
+
+      //*************************************************************************
+      /// Calculates the standard table entry for a byte value, one bit at a time.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 TAccumulator byte_entry(size_t index)
+      {
+        if ETL_IF_CONSTEXPR(Reflect)
+        {
+          const TAccumulator polynomial = etl::reverse_bits_const<TAccumulator, Polynomial>::value;
+
+          TAccumulator crc = TAccumulator(index);
+
+          for (int bit = 0; bit < 8; ++bit)
+          {
+            crc = ((crc & 1U) != 0U) ? TAccumulator((crc >> 1U) ^ polynomial) : TAccumulator(crc >> 1U);
+          }
+
+          return crc;
+        }
+        else
+        {
+          const TAccumulator top_bit = TAccumulator(TAccumulator(1U) << (Accumulator_Bits - 1U));
+
+          TAccumulator crc = TAccumulator(TAccumulator(index) << (Accumulator_Bits - 8U));
+
+          for (int bit = 0; bit < 8; ++bit)
+          {
+            crc = ((crc & top_bit) != 0U) ? TAccumulator((crc << 1U) ^ Polynomial) : TAccumulator(crc << 1U);
+          }
+
+          return crc;
+        }
+      }
+
+      //*************************************************************************
+      /// Shifts that are safe for 8 bit accumulators.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 TAccumulator shift_right_8(TAccumulator value)
+      {
+        return (Accumulator_Bits > 8U) ? TAccumulator(value >> (Accumulator_Bits > 8U ? 8U : 0U)) : TAccumulator(0U);
+      }
+
+      static ETL_CONSTEXPR14 TAccumulator shift_left_8(TAccumulator value)
+      {
+        return (Accumulator_Bits > 8U) ? TAccumulator(value << (Accumulator_Bits > 8U ? 8U : 0U)) : TAccumulator(0U);
+      }
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Step.
+    /// Combines the table lookups for one block of Slices bytes.
+    /// Recursive, so that the lookups are unrolled at compile time.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices, size_t Index>
+    struct crc_slice_step
+    {
+      static ETL_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+      static ETL_CONSTANT size_t Crc_Shift = (Index < Accumulator_Bytes) ? (Reflect ? (Index * 8U) : (Accumulator_Bits - 8U - (Index * 8U))) : 0U;
+
+      static TAccumulator add(TAccumulator crc, const uint8_t* p_data, const TAccumulator (&table)[Slices][256U])
+      {
+        uint8_t index = p_data[Index];
+
+        if (Index < Accumulator_Bytes)
+        {
+          index ^= static_cast<uint8_t>(crc >> Crc_Shift);
+        }
+
+        return TAccumulator(table[Slices - 1U - Index][index] ^ crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Index + 1U>::add(crc, p_data, table));
+      }
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices, size_t Index>
+    ETL_CONSTANT size_t crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Index>::Accumulator_Bytes;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices, size_t Index>
+    ETL_CONSTANT size_t crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Index>::Crc_Shift;
+
+    //*********************************
+    // End of the block.
+    // The part of the CRC that was not combined with the data is shifted out.
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices>
+    struct crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Slices>
+    {
+      static ETL_CONSTANT size_t Remaining_Shift = ((Accumulator_Bits / 8U) > Slices) ? (Slices * 8U) : 0U;
+
+      static TAccumulator add(TAccumulator crc, const uint8_t* /*p_data*/, const TAccumulator (&/*table*/)[Slices][256U])
+      {
+        if (Remaining_Shift == 0U)
+        {
+          return TAccumulator(0U);
+        }
+        else
+        {
+          return Reflect ? TAccumulator(crc >> Remaining_Shift) : TAccumulator(crc << Remaining_Shift);
+        }
+      }
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices>
+    ETL_CONSTANT size_t crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Slices>::Remaining_Shift;
+
+    //*****************************************************************************
+    /// Slicing-by-N CRC table.
+    /// Processes Slices bytes per step using Slices table lookups.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_table_sliced
+    {
+      typedef crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices> table_type;
+
+      //*************************************************************************
+      /// Adds a single byte, using the first slice.
+      //*************************************************************************
+      static TAccumulator add(TAccumulator crc, uint8_t value)
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, get_table().entries[0U]);
+      }
+
+      //*************************************************************************
+      /// Adds a contiguous block of bytes.
+      //*************************************************************************
+      static TAccumulator add(TAccumulator crc, const uint8_t* p_data, size_t length)
+      {
+        const table_type& table = get_table();
+
+        while (length >= Slices)
+        {
+          crc = add_slice(crc, p_data, table);
+          p_data += Slices;
+          length -= Slices;
+        }
+
+        while (length != 0U)
+        {
+          crc = crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, *p_data++, table.entries[0U]);
+          --length;
+        }
+
+        return crc;
+      }
+
+      //*************************************************************************
+      /// Adds a range of bytes from a non-contiguous iterator.
+      /// The bytes are gathered in to a local block of Slices bytes.
+      //*************************************************************************
+      template <typename TIterator>
+      static TAccumulator add(TAccumulator crc, TIterator begin, const TIterator end)
+      {
+        uint8_t block[Slices];
+
+        while (begin != end)
+        {
+          size_t length = 0U;
+
+          while ((length < Slices) && (begin != end))
+          {
+            block[length++] = static_cast<uint8_t>(*begin);
+            ++begin;
+          }
+
+          crc = add(crc, block, length);
+        }
+
+        return crc;
+      }
+
+    private:
+
+      //*************************************************************************
+      /// The table is generated once, at compile time for C++14 and above.
+      //*************************************************************************
+      static const table_type& get_table()
+      {
+        static ETL_CONSTEXPR14 const table_type table;
+
+        return table;
+      }
+
+      //*************************************************************************
+      static TAccumulator add_slice(TAccumulator crc, const uint8_t* p_data, const table_type& table)
+      {
+        return crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, 0U>::add(crc, p_data, table.entries);
+      }
+    };
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
@@ -676,17 +906,264 @@ namespace etl
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
+
+    //*********************************
+    // Policy for slicing-by-N tables.
+    template <typename TCrcParameters, size_t Slices>
+    struct crc_policy_sliced : public crc_table_sliced<typename TCrcParameters::accumulator_type,
+                                                       TCrcParameters::Accumulator_Bits,
+                                                       TCrcParameters::Polynomial,
+                                                       TCrcParameters::Reflect,
+                                                       Slices>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for slicing-by-16 (16 x 256 entry tables).
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_policy_sliced<TCrcParameters, 16U>
+    {
+    };
+
+    //*********************************
+    // Policy for slicing-by-8 (8 x 256 entry tables).
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_policy_sliced<TCrcParameters, 8U>
+    {
+    };
+
+    //*********************************
+    // Policy for slicing-by-4 (4 x 256 entry tables).
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 1024U> : public crc_policy_sliced<TCrcParameters, 4U>
+    {
+    };
+
+    //*****************************************************************************
+    // Hardware CRC.
+    // Available when the target has an instruction that calculates the CRC.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_hardware
+    {
+      static ETL_CONSTANT bool Available = false;
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT bool crc_hardware<TCrcParameters>::Available;
+
+#if ETL_USING_SSE42
+    //*********************************
+    // CRC32-C using the SSE4.2 crc32 instruction.
+    template <>
+    struct crc_hardware<crc32_c_parameters>
+    {
+      static ETL_CONSTANT bool Available = true;
+
+      //*************************************************************************
+      static uint32_t add(uint32_t crc, const uint8_t* p_data, size_t length)
+      {
+  #if ETL_PLATFORM_64BIT
+        uint64_t crc64 = crc;
+
+        while (length >= 8U)
+        {
+          uint64_t value;
+          memcpy(&value, p_data, 8U);
+          crc64 = _mm_crc32_u64(crc64, value);
+          p_data += 8U;
+          length -= 8U;
+        }
+
+        crc = static_cast<uint32_t>(crc64);
+  #endif
+
+        while (length >= 4U)
+        {
+          uint32_t value;
+          memcpy(&value, p_data, 4U);
+          crc = _mm_crc32_u32(crc, value);
+          p_data += 4U;
+          length -= 4U;
+        }
+
+        while (length != 0U)
+        {
+          crc = _mm_crc32_u8(crc, *p_data++);
+          --length;
+        }
+
+        return crc;
+      }
+    };
+#endif
+
+    //*****************************************************************************
+    /// CRC Combine.
+    /// Calculates the CRC of the concatenation of two blocks of data from their
+    /// individual CRCs and the length of the second block.
+    /// The 'zero bytes' operator for the polynomial is a GF(2) matrix which is
+    /// raised to the required power by repeated squaring.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    class crc_combiner
+    {
+    public:
+
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT size_t Bits = TCrcParameters::Accumulator_Bits;
+
+      //*************************************************************************
+      /// \param crc_a    The final CRC of the first block.
+      /// \param crc_b    The final CRC of the second block.
+      /// \param length_b The length of the second block, in bytes.
+      //*************************************************************************
+      static accumulator_type combine(accumulator_type crc_a, accumulator_type crc_b, size_t length_b)
+      {
+        if (length_b == 0U)
+        {
+          return crc_a;
+        }
+
+        accumulator_type odd[Bits];  // Odd power of two zero bits operator.
+        accumulator_type even[Bits]; // Even power of two zero bits operator.
+
+        // Operator for one zero bit.
+        if ETL_IF_CONSTEXPR(TCrcParameters::Reflect)
+        {
+          odd[0U] = etl::reverse_bits_const<accumulator_type, TCrcParameters::Polynomial>::value;
+
+          for (size_t i = 1U; i < Bits; ++i)
+          {
+            odd[i] = accumulator_type(accumulator_type(1U) << (i - 1U));
+          }
+        }
+        else
+        {
+          for (size_t i = 0U; i < (Bits - 1U); ++i)
+          {
+            odd[i] = accumulator_type(accumulator_type(1U) << (i + 1U));
+          }
+
+          odd[Bits - 1U] = TCrcParameters::Polynomial;
+        }
+
+        matrix_square(even, odd); // Two zero bits.
+        matrix_square(odd, even); // Four zero bits.
+
+        // Remove the effect of the initial value and final xor from the first CRC,
+        // as they are already included in the second.
+        const accumulator_type initial = TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                                                 : TCrcParameters::Initial;
+
+        accumulator_type crc = accumulator_type(crc_a ^ TCrcParameters::Xor_Out ^ initial);
+
+        // Apply 'length_b' zero bytes to the first CRC.
+        do
+        {
+          matrix_square(even, odd);
+
+          if ((length_b & 1U) != 0U)
+          {
+            crc = matrix_times(even, crc);
+          }
+
+          length_b >>= 1U;
+
+          if (length_b == 0U)
+          {
+            break;
+          }
+
+          matrix_square(odd, even);
+
+          if ((length_b & 1U) != 0U)
+          {
+            crc = matrix_times(odd, crc);
+          }
+
+          length_b >>= 1U;
+        } while (length_b != 0U);
+
+        return accumulator_type(crc ^ crc_b);
+      }
+
+    private:
+
+      //*************************************************************************
+      static accumulator_type matrix_times(const accumulator_type* matrix, accumulator_type vector)
+      {
+        accumulator_type sum = 0U;
+
+        while (vector != 0U)
+        {
+          if ((vector & 1U) != 0U)
+          {
+            sum ^= *matrix;
+          }
+
+          vector >>= 1U;
+          ++matrix;
+        }
+
+        return sum;
+      }
+
+      //*************************************************************************
+      static void matrix_square(accumulator_type* square, const accumulator_type* matrix)
+      {
+        for (size_t i = 0U; i < Bits; ++i)
+        {
+          square[i] = matrix_times(matrix, matrix[i]);
+        }
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_combiner<TCrcParameters>::Bits;
   }
 
   //*****************************************************************************
   /// Basic parameterised CRC type.
+  /// Table_Size may be 4, 16 or 256, for a single table,
+  /// or 1024, 2048 or 4096 for slicing-by-4, 8 or 16.
+  /// Slicing tables are generated at compile time for C++14 and above,
+  /// otherwise on first use.
+  /// If ETL_USE_X86_SIMD is defined and the target supports SSE4.2 then CRC32-C
+  /// ranges defined by pointers are calculated with the crc32 instruction.
   //*****************************************************************************
   template <typename TCrcParameters, size_t Table_Size>
   class crc_type : public etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> >
   {
+  private:
+
+    typedef etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> > base_t;
+    typedef typename base_t::policy_type policy_type;
+    typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+    static ETL_CONSTANT bool Is_Sliced   = (Table_Size > 256U);
+    static ETL_CONSTANT bool Is_Hardware = private_crc::crc_hardware<TCrcParameters>::Available;
+
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) ||
+                      (Table_Size == 1024U) || (Table_Size == 2048U) || (Table_Size == 4096U), "Table size must be 4, 16, 256, 1024, 2048 or 4096");
 
     //*************************************************************************
     /// Default constructor.
@@ -707,7 +1184,137 @@ namespace etl
       this->reset();
       this->add(begin, end);
     }
+
+    using base_t::add;
+
+    //*************************************************************************
+    /// Appends a block of data, using the CRC that was calculated for that
+    /// block separately, such as by another thread.
+    /// The result is the same as if the block had been added with 'add'.
+    /// \param crc_b    The CRC of the block.
+    /// \param length_b The length of the block, in bytes.
+    //*************************************************************************
+    void append(accumulator_type crc_b, size_t length_b)
+    {
+      this->frame_check = accumulator_type(combine(this->value(), crc_b, length_b) ^ TCrcParameters::Xor_Out);
+    }
+
+    //*************************************************************************
+    /// Combines the CRCs of two consecutive blocks of data.
+    /// Returns the CRC of the concatenated blocks.
+    /// \param crc_a    The CRC of the first block.
+    /// \param crc_b    The CRC of the second block.
+    /// \param length_b The length of the second block, in bytes.
+    //*************************************************************************
+    static accumulator_type combine(accumulator_type crc_a, accumulator_type crc_b, size_t length_b)
+    {
+      return private_crc::crc_combiner<TCrcParameters>::combine(crc_a, crc_b, length_b);
+    }
+
+    //*************************************************************************
+    /// Combines the CRCs of consecutive, equally sized chunks.
+    /// Each chunk's CRC is independent of the others, so they may be
+    /// calculated concurrently before being combined.
+    /// \param chunk_crcs The CRC of each chunk, in order.
+    /// \param n_chunks   The number of chunks.
+    /// \param chunk_size The length of each chunk, in bytes.
+    /// \param length     The total length. The last chunk is (length - ((n_chunks - 1) * chunk_size)) bytes.
+    //*************************************************************************
+    static accumulator_type combine_chunks(const accumulator_type* chunk_crcs, size_t n_chunks, size_t chunk_size, size_t length)
+    {
+      if (n_chunks == 0U)
+      {
+        return crc_type().value();
+      }
+
+      accumulator_type crc = chunk_crcs[0];
+
+      for (size_t i = 1U; i < n_chunks; ++i)
+      {
+        const size_t size = (i == (n_chunks - 1U)) ? (length - (i * chunk_size)) : chunk_size;
+
+        crc = combine(crc, chunk_crcs[i], size);
+      }
+
+      return crc;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
+
+      this->frame_check = add_range(this->frame_check, begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value && Is_Hardware>());
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Hardware calculation of a range defined by pointers.
+    //*************************************************************************
+    template<typename TIterator>
+    accumulator_type add_range(accumulator_type crc, TIterator begin, const TIterator end, etl::true_type /*is_hardware*/) const
+    {
+      const uint8_t* p_data = reinterpret_cast<const uint8_t*>(begin);
+
+      return private_crc::crc_hardware<TCrcParameters>::add(crc, p_data, static_cast<size_t>(end - begin));
+    }
+
+    //*************************************************************************
+    /// Table calculation.
+    //*************************************************************************
+    template<typename TIterator>
+    accumulator_type add_range(accumulator_type crc, TIterator begin, const TIterator end, etl::false_type /*is_hardware*/) const
+    {
+      return add_table(crc, begin, end, etl::integral_constant<bool, Is_Sliced>(), etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Sliced table, contiguous range.
+    //*************************************************************************
+    template<typename TIterator>
+    accumulator_type add_table(accumulator_type crc, TIterator begin, const TIterator end, etl::true_type /*is_sliced*/, etl::true_type /*is_pointer*/) const
+    {
+      const uint8_t* p_data = reinterpret_cast<const uint8_t*>(begin);
+
+      return policy_type::add(crc, p_data, static_cast<size_t>(end - begin));
+    }
+
+    //*************************************************************************
+    /// Sliced table, iterator range.
+    //*************************************************************************
+    template<typename TIterator>
+    accumulator_type add_table(accumulator_type crc, TIterator begin, const TIterator end, etl::true_type /*is_sliced*/, etl::false_type /*is_pointer*/) const
+    {
+      return policy_type::add(crc, begin, end);
+    }
+
+    //*************************************************************************
+    /// Single table.
+    //*************************************************************************
+    template<typename TIterator, typename TIsPointer>
+    accumulator_type add_table(accumulator_type crc, TIterator begin, const TIterator end, etl::false_type /*is_sliced*/, TIsPointer) const
+    {
+      while (begin != end)
+      {
+        crc = this->policy.add(crc, static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+
+      return crc;
+    }
   };
+
+  template <typename TCrcParameters, size_t Table_Size>
+  ETL_CONSTANT bool crc_type<TCrcParameters, Table_Size>::Is_Sliced;
+
+  template <typename TCrcParameters, size_t Table_Size>
+  ETL_CONSTANT bool crc_type<TCrcParameters, Table_Size>::Is_Hardware;
 }
 
 #endif
@@ -0,0 +1,269 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_ROUTER_DISPATCH_TABLE_INCLUDED
+#define ETL_MESSAGE_ROUTER_DISPATCH_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../message_types.h"
+#include "../nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP17
+
+namespace etl
+{
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// A compile time table that maps message ids to handlers.
+    /// If the ids are dense, the table is indexed directly by (id - lowest id).
+    /// If the ids are sparse, the table is indexed by a multiplicative hash that
+    /// is searched for at compile time to be collision free for the ids.
+    /// 'is_valid' is false if no collision free hash was found.
+    /// For duplicate ids, the first handler is used.
+    //*************************************************************************
+    template <typename THandler, etl::message_id_t... Ids>
+    class dispatch_table
+    {
+    public:
+
+      static constexpr size_t Number_Of_Ids = sizeof...(Ids);
+
+    private:
+
+      // A trailing zero keeps the array valid for an empty id list.
+      static constexpr etl::message_id_t id_list[Number_Of_Ids + 1U] = { Ids..., 0 };
+
+      //*******************************
+      static constexpr etl::message_id_t lowest_id()
+      {
+        etl::message_id_t result = id_list[0];
+
+        for (size_t i = 1U; i < Number_Of_Ids; ++i)
+        {
+          result = (id_list[i] < result) ? id_list[i] : result;
+        }
+
+        return result;
+      }
+
+      //*******************************
+      static constexpr etl::message_id_t highest_id()
+      {
+        etl::message_id_t result = id_list[0];
+
+        for (size_t i = 1U; i < Number_Of_Ids; ++i)
+        {
+          result = (id_list[i] > result) ? id_list[i] : result;
+        }
+
+        return result;
+      }
+
+    public:
+
+      static constexpr etl::message_id_t Lowest_Id  = lowest_id();
+      static constexpr etl::message_id_t Highest_Id = highest_id();
+      static constexpr size_t            Id_Range   = size_t(Highest_Id - Lowest_Id) + 1U;
+
+      /// The ids are dense if at least a quarter of the directly indexed table would be used.
+      static constexpr bool Is_Dense = (Number_Of_Ids != 0U) && (Id_Range <= (4U * Number_Of_Ids));
+
+    private:
+
+      //*******************************
+      struct hash_parameters
+      {
+        size_t   size;
+        uint32_t multiplier;
+        uint32_t shift;
+        bool     found;
+      };
+
+      static constexpr size_t Max_Hash_Attempts = 256U;
+
+      //*******************************
+      static constexpr size_t log2_round_up(size_t n)
+      {
+        size_t bits = 0U;
+
+        while ((size_t(1U) << bits) < n)
+        {
+          ++bits;
+        }
+
+        return bits;
+      }
+
+      // The hash table sizes tried are 2, 4 and 8 times the number of ids, rounded up to a power of 2.
+      static constexpr size_t Min_Hash_Bits = log2_round_up(Number_Of_Ids) + 1U;
+      static constexpr size_t Max_Hash_Bits = Min_Hash_Bits + 2U;
+      static constexpr size_t Max_Hash_Size = size_t(1U) << Max_Hash_Bits;
+
+      //*******************************
+      static constexpr size_t hash(etl::message_id_t id, uint32_t multiplier, uint32_t shift)
+      {
+        return size_t(uint32_t(uint32_t(id) * multiplier) >> shift);
+      }
+
+      //*******************************
+      static constexpr hash_parameters find_hash()
+      {
+        hash_parameters result = { 0U, 0U, 0U, false };
+
+        if (Is_Dense || (Number_Of_Ids == 0U) || (Max_Hash_Bits > 16U))
+        {
+          return result;
+        }
+
+        for (size_t bits = Min_Hash_Bits; bits <= Max_Hash_Bits; ++bits)
+        {
+          const size_t   size  = size_t(1U) << bits;
+          const uint32_t shift = uint32_t(32U - bits);
+
+          for (size_t attempt = 0U; attempt < Max_Hash_Attempts; ++attempt)
+          {
+            // Odd multipliers, starting at the golden ratio.
+            const uint32_t multiplier = uint32_t(0x9E3779B1UL + (2UL * attempt));
+
+            etl::message_id_t slot_ids[Max_Hash_Size] = {};
+            bool              slot_used[Max_Hash_Size] = {};
+            bool              collision = false;
+
+            for (size_t i = 0U; (i < Number_Of_Ids) && !collision; ++i)
+            {
+              const size_t index = hash(id_list[i], multiplier, shift);
+
+              if (slot_used[index])
+              {
+                // The same id twice is not a collision.
+                collision = (slot_ids[index] != id_list[i]);
+              }
+              else
+              {
+                slot_used[index] = true;
+                slot_ids[index]  = id_list[i];
+              }
+            }
+
+            if (!collision)
+            {
+              result.size       = size;
+              result.multiplier = multiplier;
+              result.shift      = shift;
+              result.found      = true;
+
+              return result;
+            }
+          }
+        }
+
+        return result;
+      }
+
+      static constexpr hash_parameters Hash = find_hash();
+
+    public:
+
+      /// Can the table be used?
+      static constexpr bool Is_Valid = Is_Dense || Hash.found;
+
+      /// The number of entries in the table.
+      static constexpr size_t Size = Is_Dense ? Id_Range : (Hash.found ? Hash.size : 1U);
+
+      //*******************************
+      /// Constructs the table from the handlers, in the same order as the ids.
+      //*******************************
+      constexpr dispatch_table(const THandler (&handlers)[Number_Of_Ids + 1U])
+        : entry_ids()
+        , entry_handlers()
+      {
+        if (Is_Valid)
+        {
+          for (size_t i = 0U; i < Number_Of_Ids; ++i)
+          {
+            const size_t index = get_index(id_list[i]);
+
+            if (entry_handlers[index] == ETL_NULLPTR)
+            {
+              entry_ids[index]      = id_list[i];
+              entry_handlers[index] = handlers[i];
+            }
+          }
+        }
+      }
+
+      //*******************************
+      /// Gets the handler for the id.
+      /// Returns a null handler if the id is not in the table.
+      //*******************************
+      constexpr THandler find(etl::message_id_t id) const
+      {
+        if constexpr (Is_Dense)
+        {
+          // Ids below the lowest wrap around to a large index.
+          const size_t index = size_t(id) - size_t(Lowest_Id);
+
+          return (index < Size) ? entry_handlers[index] : ETL_NULLPTR;
+        }
+        else
+        {
+          const size_t index = get_index(id);
+
+          return (entry_ids[index] == id) ? entry_handlers[index] : ETL_NULLPTR;
+        }
+      }
+
+    private:
+
+      //*******************************
+      static constexpr size_t get_index(etl::message_id_t id)
+      {
+        if constexpr (Is_Dense)
+        {
+          return size_t(id) - size_t(Lowest_Id);
+        }
+        else
+        {
+          return Hash.found ? hash(id, Hash.multiplier, Hash.shift) : 0U;
+        }
+      }
+
+      etl::message_id_t entry_ids[Size];
+      THandler          entry_handlers[Size];
+    };
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,733 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHORTEST_DECIMAL_INCLUDED
+#define ETL_SHORTEST_DECIMAL_INCLUDED
+
+#include "../platform.h"
+#include "../static_assert.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  namespace private_shortest_decimal
+  {
+    //*************************************************************************
+    /// A decimal floating point value: digits * 10^exponent.
+    //*************************************************************************
+    struct decimal
+    {
+      uint64_t digits;
+      int32_t  exponent;
+    };
+
+    //*************************************************************************
+    /// Powers of 5 for the conversion of binary to decimal exponents.
+    ///
+    /// The conversion needs, for each decimal exponent q, 5^q and 2^k / 5^q
+    /// to 125 significant bits. Only every 26th value is stored. The others
+    /// are computed from the nearest stored value and a small power of 5, and
+    /// then adjusted by a 2 bit correction to the exact value.
+    ///
+    /// pow5_split[n]     = floor(5^(26n) * 2^(125 - bits(5^(26n))))
+    /// pow5_inv_split[n] = floor(2^(bits(5^(26n)) + 124) / 5^(26n))
+    //*************************************************************************
+    template <typename T = void>
+    struct tables
+    {
+      static const uint64_t pow5[26];
+      static const uint64_t pow5_split[13][2];
+      static const uint64_t pow5_inv_split[15][2];
+      static const uint32_t pow5_offsets[21];
+      static const uint32_t pow5_inv_offsets[22];
+    };
+
+    template <typename T>
+    const uint64_t tables<T>::pow5[26] =
+    {
+        0x0000000000000001ULL, 0x0000000000000005ULL, 0x0000000000000019ULL,
+        0x000000000000007DULL, 0x0000000000000271ULL, 0x0000000000000C35ULL,
+        0x0000000000003D09ULL, 0x000000000001312DULL, 0x000000000005F5E1ULL,
+        0x00000000001DCD65ULL, 0x00000000009502F9ULL, 0x0000000002E90EDDULL,
+        0x000000000E8D4A51ULL, 0x0000000048C27395ULL, 0x000000016BCC41E9ULL,
+        0x000000071AFD498DULL, 0x0000002386F26FC1ULL, 0x000000B1A2BC2EC5ULL,
+        0x000003782DACE9D9ULL, 0x00001158E460913DULL, 0x000056BC75E2D631ULL,
+        0x0001B1AE4D6E2EF5ULL, 0x000878678326EAC9ULL, 0x002A5A058FC295EDULL,
+        0x00D3C21BCECCEDA1ULL, 0x0422CA8B0A00A425ULL
+    };
+
+    template <typename T>
+    const uint64_t tables<T>::pow5_split[13][2] =
+    {
+        { 0x0000000000000000ULL, 0x1000000000000000ULL },
+        { 0x0000000000000000ULL, 0x14ADF4B7320334B9ULL },
+        { 0x0E549208B31ADB10ULL, 0x1ABA4714957D300DULL },
+        { 0x6DC6AD264D8F0866ULL, 0x1145B7E285BF98F5ULL },
+        { 0xEB1DBD923D8596CAULL, 0x1652EFDC6018A1FCULL },
+        { 0xB4C1B80B22AE923CULL, 0x1CDA62055B2D9D83ULL },
+        { 0x5BB28B4E8F7E4C30ULL, 0x12A5568B9F52F416ULL },
+        { 0xF08AED437682D4FBULL, 0x1819651531F9E78FULL },
+        { 0xB4EE134AD99BF150ULL, 0x1F25C186A6F04C28ULL },
+        { 0x16499ECB70C25F03ULL, 0x1420EB449C8842E6ULL },
+        { 0x85A56EAD360865B0ULL, 0x1A03FDE214CAF085ULL },
+        { 0x093DB1D57999890BULL, 0x10CFEB353A97DAD8ULL },
+        { 0xCF38BB735E3F36ACULL, 0x15BAAF44FA52673EULL }
+    };
+
+    template <typename T>
+    const uint64_t tables<T>::pow5_inv_split[15][2] =
+    {
+        { 0x0000000000000000ULL, 0x2000000000000000ULL },
+        { 0x52A6C95FC0655033ULL, 0x18C240C4AECB13BBULL },
+        { 0x7CA8D50071DFC805ULL, 0x1327FC58DA0F6FF5ULL },
+        { 0x6520247D3556476DULL, 0x1DA48CE468E7C702ULL },
+        { 0x6139CDD76802E6E8ULL, 0x16EF5B40C2FC7779ULL },
+        { 0xF951A7FF43DE8C78ULL, 0x11BEBDF578B2F391ULL },
+        { 0x7BE8BEE8D6E957E7ULL, 0x1B758D848FAC54B0ULL },
+        { 0x8BD3F9E999A423E9ULL, 0x153EDA614071A3B7ULL },
+        { 0x0848F973CB3EE3CDULL, 0x10701BD527B4978CULL },
+        { 0x153285EBB9EFBFA1ULL, 0x196FBB9BB44DB44DULL },
+        { 0xADEEE7F86C07B695ULL, 0x13AE3591F5B4D936ULL },
+        { 0x4D686A4EAF182221ULL, 0x1E74404F3DAADA91ULL },
+        { 0x98C0A106E09EBD9EULL, 0x17900EA4FDA7C257ULL },
+        { 0x8F20E37371497D0DULL, 0x123B140576D820B2ULL },
+        { 0xB043138134743D84ULL, 0x1C35F4275F7A29ADULL }
+    };
+
+    template <typename T>
+    const uint32_t tables<T>::pow5_offsets[21] =
+    {
+        0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x40000000UL, 0x59695995UL,
+        0x55545555UL, 0x56555515UL, 0x41150504UL, 0x40555410UL, 0x44555145UL, 0x44504540UL,
+        0x45555550UL, 0x40004000UL, 0x96440440UL, 0x55565565UL, 0x54454045UL, 0x40154151UL,
+        0x55559155UL, 0x51405555UL, 0x00000105UL
+    };
+
+    template <typename T>
+    const uint32_t tables<T>::pow5_inv_offsets[22] =
+    {
+        0x54544554UL, 0x04055545UL, 0x10041000UL, 0x00400414UL, 0x40010000UL, 0x41155555UL,
+        0x00000454UL, 0x00010044UL, 0x40000000UL, 0x44000041UL, 0x50454450UL, 0x55550054UL,
+        0x51655554UL, 0x40004000UL, 0x01000001UL, 0x00010500UL, 0x51515411UL, 0x05555554UL,
+        0x50411500UL, 0x40040000UL, 0x05040110UL, 0x00000000UL
+    };
+
+    static ETL_CONSTANT int32_t  Pow5_Bit_Count     = 125;
+    static ETL_CONSTANT int32_t  Pow5_Inv_Bit_Count = 125;
+    static ETL_CONSTANT uint32_t Pow5_Table_Size    = 26U;
+
+    //*************************************************************************
+    /// 64 x 64 -> 128 bit multiplication.
+    ///\return The low 64 bits. The high 64 bits are returned in 'high'.
+    //*************************************************************************
+    inline uint64_t multiply_128(const uint64_t a, const uint64_t b, uint64_t& high)
+    {
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t product = static_cast<uint128_t>(a) * b;
+      high = static_cast<uint64_t>(product >> 64U);
+
+      return static_cast<uint64_t>(product);
+#else
+      const uint64_t a_lo = a & 0xFFFFFFFFU;
+      const uint64_t a_hi = a >> 32U;
+      const uint64_t b_lo = b & 0xFFFFFFFFU;
+      const uint64_t b_hi = b >> 32U;
+
+      const uint64_t lo_lo = a_lo * b_lo;
+      const uint64_t hi_lo = a_hi * b_lo;
+      const uint64_t lo_hi = a_lo * b_hi;
+      const uint64_t hi_hi = a_hi * b_hi;
+
+      const uint64_t cross = (lo_lo >> 32U) + (hi_lo & 0xFFFFFFFFU) + lo_hi;
+
+      high = (hi_lo >> 32U) + (cross >> 32U) + hi_hi;
+
+      return (cross << 32U) | (lo_lo & 0xFFFFFFFFU);
+#endif
+    }
+
+    //*************************************************************************
+    /// Shifts the 128 bit value right by 0 < shift < 64.
+    //*************************************************************************
+    inline uint64_t shift_right_128(const uint64_t low, const uint64_t high, const uint32_t shift)
+    {
+      return (high << (64U - shift)) | (low >> shift);
+    }
+
+    //*************************************************************************
+    /// The number of bits in 5^e, or 1 for e == 0. Valid for 0 <= e <= 3528.
+    //*************************************************************************
+    inline int32_t pow5_bits(const int32_t e)
+    {
+      return static_cast<int32_t>((static_cast<uint32_t>(e) * 1217359U) >> 19U) + 1;
+    }
+
+    //*************************************************************************
+    /// floor(log10(2^e)). Valid for 0 <= e <= 1650.
+    //*************************************************************************
+    inline uint32_t log10_pow2(const int32_t e)
+    {
+      return (static_cast<uint32_t>(e) * 78913U) >> 18U;
+    }
+
+    //*************************************************************************
+    /// floor(log10(5^e)). Valid for 0 <= e <= 2620.
+    //*************************************************************************
+    inline uint32_t log10_pow5(const int32_t e)
+    {
+      return (static_cast<uint32_t>(e) * 732923U) >> 20U;
+    }
+
+    //*************************************************************************
+    /// Gets 5^i to 125 significant bits.
+    //*************************************************************************
+    inline void pow5_split(const uint32_t i, uint64_t result[2])
+    {
+      const uint32_t  base   = i / Pow5_Table_Size;
+      const uint32_t  base2  = base * Pow5_Table_Size;
+      const uint32_t  offset = i - base2;
+      const uint64_t* mul    = tables<>::pow5_split[base];
+
+      if (offset == 0U)
+      {
+        result[0] = mul[0];
+        result[1] = mul[1];
+        return;
+      }
+
+      const uint64_t m = tables<>::pow5[offset];
+
+      uint64_t high1;
+      const uint64_t low1 = multiply_128(m, mul[1], high1);
+      uint64_t high0;
+      const uint64_t low0 = multiply_128(m, mul[0], high0);
+
+      const uint64_t sum = high0 + low1;
+
+      if (sum < high0)
+      {
+        ++high1;
+      }
+
+      const uint32_t shift = static_cast<uint32_t>(pow5_bits(static_cast<int32_t>(i)) - pow5_bits(static_cast<int32_t>(base2)));
+
+      result[0] = shift_right_128(low0, sum, shift) + ((tables<>::pow5_offsets[i / 16U] >> ((i % 16U) << 1U)) & 3U);
+      result[1] = shift_right_128(sum, high1, shift);
+    }
+
+    //*************************************************************************
+    /// Gets 2^k / 5^i to 125 significant bits, rounded up.
+    //*************************************************************************
+    inline void pow5_inv_split(const uint32_t i, uint64_t result[2])
+    {
+      const uint32_t  base   = (i + Pow5_Table_Size - 1U) / Pow5_Table_Size;
+      const uint32_t  base2  = base * Pow5_Table_Size;
+      const uint32_t  offset = base2 - i;
+      const uint64_t* mul    = tables<>::pow5_inv_split[base];
+
+      const uint64_t correction = 1U + ((tables<>::pow5_inv_offsets[i / 16U] >> ((i % 16U) << 1U)) & 3U);
+
+      if (offset == 0U)
+      {
+        result[0] = mul[0] + correction;
+        result[1] = mul[1];
+        return;
+      }
+
+      const uint64_t m = tables<>::pow5[offset];
+
+      uint64_t high1;
+      const uint64_t low1 = multiply_128(m, mul[1], high1);
+      uint64_t high0;
+      const uint64_t low0 = multiply_128(m, mul[0], high0);
+
+      const uint64_t sum = high0 + low1;
+
+      if (sum < high0)
+      {
+        ++high1;
+      }
+
+      const uint32_t shift = static_cast<uint32_t>(pow5_bits(static_cast<int32_t>(base2)) - pow5_bits(static_cast<int32_t>(i)));
+
+      result[0] = shift_right_128(low0, sum, shift) + correction;
+      result[1] = shift_right_128(sum, high1, shift);
+    }
+
+    //*************************************************************************
+    /// The number of times that 5 divides the value.
+    //*************************************************************************
+    inline uint32_t pow5_factor(uint64_t value)
+    {
+      uint32_t count = 0U;
+
+      while ((value % 5U) == 0U)
+      {
+        value /= 5U;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    inline bool is_multiple_of_pow5(const uint64_t value, const uint32_t p)
+    {
+      return pow5_factor(value) >= p;
+    }
+
+    //*************************************************************************
+    inline bool is_multiple_of_pow2(const uint64_t value, const uint32_t p)
+    {
+      return (value & ((uint64_t(1U) << p) - 1U)) == 0U;
+    }
+
+    //*************************************************************************
+    /// (m * mul) >> j, for 64 < j < 128.
+    //*************************************************************************
+    inline uint64_t multiply_shift(const uint64_t m, const uint64_t mul[2], const int32_t j)
+    {
+      uint64_t high0;
+      multiply_128(m, mul[0], high0);
+      uint64_t high1;
+      const uint64_t low1 = multiply_128(m, mul[1], high1);
+
+      const uint64_t sum = high0 + low1;
+
+      if (sum < high0)
+      {
+        ++high1;
+      }
+
+      return shift_right_128(sum, high1, static_cast<uint32_t>(j - 64));
+    }
+
+    //*************************************************************************
+    /// Finds the shortest decimal that rounds to the binary floating point value.
+    /// After Ulf Adams, "Ryu: fast float-to-string conversion", PLDI 2018.
+    ///\param ieee_mantissa  The stored mantissa bits.
+    ///\param ieee_exponent  The stored (biased) exponent bits.
+    ///\param mantissa_bits  The number of stored mantissa bits.
+    ///\param exponent_bias  The exponent bias.
+    //*************************************************************************
+    inline decimal to_decimal(const uint64_t ieee_mantissa,
+                              const uint32_t ieee_exponent,
+                              const uint32_t mantissa_bits,
+                              const int32_t  exponent_bias)
+    {
+      if ((ieee_exponent == 0U) && (ieee_mantissa == 0U))
+      {
+        decimal zero = { 0U, 0 };
+        return zero;
+      }
+
+      int32_t  e2;
+      uint64_t m2;
+
+      if (ieee_exponent == 0U)
+      {
+        // Subnormal.
+        e2 = 1 - exponent_bias - static_cast<int32_t>(mantissa_bits) - 2;
+        m2 = ieee_mantissa;
+      }
+      else
+      {
+        e2 = static_cast<int32_t>(ieee_exponent) - exponent_bias - static_cast<int32_t>(mantissa_bits) - 2;
+        m2 = (uint64_t(1U) << mantissa_bits) | ieee_mantissa;
+      }
+
+      const bool accept_bounds = (m2 & 1U) == 0U;
+
+      // The value and the halfway points to its neighbours, scaled by 4.
+      const uint64_t mv       = 4U * m2;
+      const uint32_t mm_shift = ((ieee_mantissa != 0U) || (ieee_exponent <= 1U)) ? 1U : 0U;
+
+      uint64_t vr;
+      uint64_t vp;
+      uint64_t vm;
+      int32_t  e10;
+      bool     vm_is_trailing_zeros = false;
+      bool     vr_is_trailing_zeros = false;
+
+      // Scale by a power of 10, so that the interval [vm, vp] has only a few digits.
+      if (e2 >= 0)
+      {
+        const uint32_t q = log10_pow2(e2) - ((e2 > 3) ? 1U : 0U);
+        e10 = static_cast<int32_t>(q);
+
+        const int32_t k = Pow5_Inv_Bit_Count + pow5_bits(static_cast<int32_t>(q)) - 1;
+        const int32_t i = -e2 + static_cast<int32_t>(q) + k;
+
+        uint64_t pow5[2];
+        pow5_inv_split(q, pow5);
+
+        vr = multiply_shift(4U * m2, pow5, i);
+        vp = multiply_shift((4U * m2) + 2U, pow5, i);
+        vm = multiply_shift((4U * m2) - 1U - mm_shift, pow5, i);
+
+        if (q <= 21U)
+        {
+          // Only one of mp, mv and mm can be a multiple of 5, if any.
+          if ((mv % 5U) == 0U)
+          {
+            vr_is_trailing_zeros = is_multiple_of_pow5(mv, q);
+          }
+          else if (accept_bounds)
+          {
+            vm_is_trailing_zeros = is_multiple_of_pow5(mv - 1U - mm_shift, q);
+          }
+          else
+          {
+            vp -= is_multiple_of_pow5(mv + 2U, q) ? 1U : 0U;
+          }
+        }
+      }
+      else
+      {
+        const uint32_t q = log10_pow5(-e2) - ((-e2 > 1) ? 1U : 0U);
+        e10 = static_cast<int32_t>(q) + e2;
+
+        const int32_t i = -e2 - static_cast<int32_t>(q);
+        const int32_t k = pow5_bits(i) - Pow5_Bit_Count;
+        const int32_t j = static_cast<int32_t>(q) - k;
+
+        uint64_t pow5[2];
+        pow5_split(static_cast<uint32_t>(i), pow5);
+
+        vr = multiply_shift(4U * m2, pow5, j);
+        vp = multiply_shift((4U * m2) + 2U, pow5, j);
+        vm = multiply_shift((4U * m2) - 1U - mm_shift, pow5, j);
+
+        if (q <= 1U)
+        {
+          // mv has at least q trailing zero bits, as it is a multiple of 4.
+          vr_is_trailing_zeros = true;
+
+          if (accept_bounds)
+          {
+            vm_is_trailing_zeros = (mm_shift == 1U);
+          }
+          else
+          {
+            --vp;
+          }
+        }
+        else if (q < 63U)
+        {
+          vr_is_trailing_zeros = is_multiple_of_pow2(mv, q);
+        }
+      }
+
+      // Remove the digits that are common to the whole interval.
+      int32_t  removed = 0;
+      uint32_t last_removed_digit = 0U;
+      uint64_t output;
+
+      if (vm_is_trailing_zeros || vr_is_trailing_zeros)
+      {
+        // The general case, which is rare.
+        while ((vp / 10U) > (vm / 10U))
+        {
+          vm_is_trailing_zeros &= (vm % 10U) == 0U;
+          vr_is_trailing_zeros &= (last_removed_digit == 0U);
+          last_removed_digit = static_cast<uint32_t>(vr % 10U);
+          vr /= 10U;
+          vp /= 10U;
+          vm /= 10U;
+          ++removed;
+        }
+
+        if (vm_is_trailing_zeros)
+        {
+          while ((vm % 10U) == 0U)
+          {
+            vr_is_trailing_zeros &= (last_removed_digit == 0U);
+            last_removed_digit = static_cast<uint32_t>(vr % 10U);
+            vr /= 10U;
+            vp /= 10U;
+            vm /= 10U;
+            ++removed;
+          }
+        }
+
+        if (vr_is_trailing_zeros && (last_removed_digit == 5U) && ((vr % 2U) == 0U))
+        {
+          // Exactly halfway: round to even.
+          last_removed_digit = 4U;
+        }
+
+        output = vr + ((((vr == vm) && (!accept_bounds || !vm_is_trailing_zeros)) || (last_removed_digit >= 5U)) ? 1U : 0U);
+      }
+      else
+      {
+        // The common case.
+        bool round_up = false;
+
+        if ((vp / 100U) > (vm / 100U))
+        {
+          round_up = (vr % 100U) >= 50U;
+          vr /= 100U;
+          vp /= 100U;
+          vm /= 100U;
+          removed += 2;
+        }
+
+        while ((vp / 10U) > (vm / 10U))
+        {
+          round_up = (vr % 10U) >= 5U;
+          vr /= 10U;
+          vp /= 10U;
+          vm /= 10U;
+          ++removed;
+        }
+
+        output = vr + (((vr == vm) || round_up) ? 1U : 0U);
+      }
+
+      decimal result;
+      result.digits   = output;
+      result.exponent = e10 + removed;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the shortest decimal for a double.
+    //*************************************************************************
+    inline decimal to_decimal(const double value, bool& negative)
+    {
+      ETL_STATIC_ASSERT(sizeof(double) == sizeof(uint64_t), "Expected a 64 bit double");
+
+      uint64_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      negative = (bits >> 63U) != 0U;
+
+      return to_decimal(bits & ((uint64_t(1U) << 52U) - 1U), static_cast<uint32_t>((bits >> 52U) & 0x7FFU), 52U, 1023);
+    }
+
+    //*************************************************************************
+    /// Gets the shortest decimal for a float.
+    //*************************************************************************
+    inline decimal to_decimal(const float value, bool& negative)
+    {
+      ETL_STATIC_ASSERT(sizeof(float) == sizeof(uint32_t), "Expected a 32 bit float");
+
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      negative = (bits >> 31U) != 0U;
+
+      return to_decimal(bits & 0x7FFFFFU, (bits >> 23U) & 0xFFU, 23U, 127);
+    }
+
+    //*************************************************************************
+    /// Gets the shortest decimal for a long double.
+    /// The value is first rounded to double.
+    //*************************************************************************
+    inline decimal to_decimal(const long double value, bool& negative)
+    {
+      return to_decimal(static_cast<double>(value), negative);
+    }
+
+    //*************************************************************************
+    /// The number of decimal digits in the value.
+    //*************************************************************************
+    inline uint32_t digit_count(uint64_t value)
+    {
+      uint32_t count = 1U;
+
+      while (value >= 10000U)
+      {
+        value /= 10000U;
+        count += 4U;
+      }
+
+      while (value >= 10U)
+      {
+        value /= 10U;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Writes the shortest representation of the decimal, in either fixed or
+    /// scientific notation, whichever is shorter. Fixed is preferred if they
+    /// are the same length. This matches std::to_chars with no format.
+    ///\param buffer A buffer of at least 32 characters.
+    ///\return The number of characters written.
+    //*************************************************************************
+    template <typename TChar>
+    uint32_t write(const decimal& value, const bool negative, const bool upper_case, TChar* buffer)
+    {
+      TChar digits[20];
+      const uint32_t n = digit_count(value.digits);
+
+      uint64_t d = value.digits;
+      uint32_t index = n;
+
+      // Peel off 8 digit chunks so that the per digit arithmetic is 32 bit.
+      while (d >= 100000000U)
+      {
+        uint32_t chunk = static_cast<uint32_t>(d % 100000000U);
+        d /= 100000000U;
+
+        for (uint32_t j = 0U; j < 8U; ++j)
+        {
+          digits[--index] = TChar('0' + (chunk % 10U));
+          chunk /= 10U;
+        }
+      }
+
+      uint32_t rest = static_cast<uint32_t>(d);
+
+      while (index != 0U)
+      {
+        digits[--index] = TChar('0' + (rest % 10U));
+        rest /= 10U;
+      }
+
+      const int32_t exponent            = value.exponent;
+      const int32_t scientific_exponent = exponent + static_cast<int32_t>(n) - 1;
+      const int32_t abs_sci_exponent    = (scientific_exponent < 0) ? -scientific_exponent : scientific_exponent;
+
+      const int32_t scientific_length = static_cast<int32_t>(n) + ((n > 1U) ? 1 : 0) + 2 + ((abs_sci_exponent >= 100) ? 3 : 2);
+
+      int32_t fixed_length;
+
+      if (exponent >= 0)
+      {
+        fixed_length = static_cast<int32_t>(n) + exponent;
+      }
+      else if (scientific_exponent >= 0)
+      {
+        fixed_length = static_cast<int32_t>(n) + 1;
+      }
+      else
+      {
+        fixed_length = static_cast<int32_t>(n) + 1 - scientific_exponent;
+      }
+
+      TChar* p = buffer;
+
+      if (negative)
+      {
+        *p++ = TChar('-');
+      }
+
+      if (fixed_length <= scientific_length)
+      {
+        if (exponent >= 0)
+        {
+          // ddd000
+          for (uint32_t i = 0U; i < n; ++i)
+          {
+            *p++ = digits[i];
+          }
+
+          for (int32_t i = 0; i < exponent; ++i)
+          {
+            *p++ = TChar('0');
+          }
+        }
+        else if (scientific_exponent >= 0)
+        {
+          // ddd.ddd
+          const uint32_t integral_digits = static_cast<uint32_t>(scientific_exponent) + 1U;
+
+          for (uint32_t i = 0U; i < n; ++i)
+          {
+            if (i == integral_digits)
+            {
+              *p++ = TChar('.');
+            }
+
+            *p++ = digits[i];
+          }
+        }
+        else
+        {
+          // 0.000ddd
+          *p++ = TChar('0');
+          *p++ = TChar('.');
+
+          for (int32_t i = -1; i > scientific_exponent; --i)
+          {
+            *p++ = TChar('0');
+          }
+
+          for (uint32_t i = 0U; i < n; ++i)
+          {
+            *p++ = digits[i];
+          }
+        }
+      }
+      else
+      {
+        // d.ddde+XX
+        *p++ = digits[0];
+
+        if (n > 1U)
+        {
+          *p++ = TChar('.');
+
+          for (uint32_t i = 1U; i < n; ++i)
+          {
+            *p++ = digits[i];
+          }
+        }
+
+        *p++ = upper_case ? TChar('E') : TChar('e');
+        *p++ = (scientific_exponent < 0) ? TChar('-') : TChar('+');
+
+        if (abs_sci_exponent >= 100)
+        {
+          *p++ = TChar('0' + (abs_sci_exponent / 100));
+        }
+
+        *p++ = TChar('0' + ((abs_sci_exponent / 10) % 10));
+        *p++ = TChar('0' + (abs_sci_exponent % 10));
+      }
+
+      return static_cast<uint32_t>(p - buffer);
+    }
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,481 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_ACCUMULATE_INCLUDED
+#define ETL_STATISTICS_ACCUMULATE_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../iterator.h"
+#include "../type_traits.h"
+#include "../static_assert.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //*************************************************************************
+    /// Accumulation parameters.
+    /// A floating point range is summed in blocks of Block_Size samples, each
+    /// with Lanes independent partial sums. The lanes break the dependency
+    /// between successive additions so that they may be pipelined or
+    /// vectorised, and the partial sums are folded into the totals once per
+    /// block, so rounding error grows with the number of blocks rather than
+    /// with the number of samples.
+    /// Integral sums are exact in any order, so the compiler is already free
+    /// to vectorise the plain loop, and does it better.
+    //*************************************************************************
+    template <typename T = void>
+    struct accumulate_parameters
+    {
+      static ETL_CONSTANT size_t Lanes      = 8U;
+      static ETL_CONSTANT size_t Block_Size = 256U;
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t accumulate_parameters<T>::Lanes;
+
+    template <typename T>
+    ETL_CONSTANT size_t accumulate_parameters<T>::Block_Size;
+
+    //*************************************************************************
+    /// Selects the blocked accumulation.
+    //*************************************************************************
+    template <typename TCalc, typename TIterator>
+    struct use_blocks
+    {
+      static ETL_CONSTANT bool value = etl::is_floating_point<TCalc>::value &&
+                                       etl::is_random_access_iterator<TIterator>::value;
+    };
+
+    template <typename TCalc, typename TIterator>
+    ETL_CONSTANT bool use_blocks<TCalc, TIterator>::value;
+
+    //*************************************************************************
+    /// Adds the lanes pairwise.
+    //*************************************************************************
+    template <typename TCalc>
+    TCalc fold(const TCalc (&lanes)[accumulate_parameters<>::Lanes])
+    {
+      ETL_STATIC_ASSERT(accumulate_parameters<>::Lanes == 8U, "fold expects 8 lanes");
+
+      return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+             ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+
+    //*************************************************************************
+    /// Selects the value of each sample for a single term accumulation.
+    //*************************************************************************
+    struct value_term
+    {
+      template <typename TInput, typename TCalc>
+      static TCalc get(TInput v)
+      {
+        return TCalc(v);
+      }
+    };
+
+    //*************************************************************************
+    /// Selects the square of each sample for a single term accumulation.
+    //*************************************************************************
+    struct square_term
+    {
+      template <typename TInput, typename TCalc>
+      static TCalc get(TInput v)
+      {
+        return TCalc(v * v);
+      }
+    };
+
+    //*************************************************************************
+    /// Adds one term, selected by TTerm, of each sample of a floating point
+    /// random access range. Returns the number of samples.
+    //*************************************************************************
+    template <typename TInput, typename TTerm, typename TCalc, typename TIterator>
+    typename etl::enable_if<use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first, TIterator last, TCalc& total)
+    {
+      typedef accumulate_parameters<> parameters;
+
+      const size_t n = size_t(last - first);
+      size_t remaining = n;
+
+      while (remaining >= parameters::Lanes)
+      {
+        const size_t block = ((remaining < parameters::Block_Size) ? remaining : parameters::Block_Size) & ~(parameters::Lanes - 1U);
+
+        TCalc t[parameters::Lanes];
+
+        for (size_t j = 0U; j < parameters::Lanes; ++j)
+        {
+          t[j] = TCalc(0);
+        }
+
+        for (size_t i = 0U; i < block; i += parameters::Lanes)
+        {
+          for (size_t j = 0U; j < parameters::Lanes; ++j)
+          {
+            t[j] += TTerm::template get<TInput, TCalc>(first[i + j]);
+          }
+        }
+
+        total += fold(t);
+
+        first     += block;
+        remaining -= block;
+      }
+
+      while (remaining != 0U)
+      {
+        total += TTerm::template get<TInput, TCalc>(*first);
+
+        ++first;
+        --remaining;
+      }
+
+      return uint32_t(n);
+    }
+
+    //*************************************************************************
+    /// Adds one term, selected by TTerm, of each sample of any other range.
+    /// Returns the number of samples.
+    //*************************************************************************
+    template <typename TInput, typename TTerm, typename TCalc, typename TIterator>
+    typename etl::enable_if<!use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first, TIterator last, TCalc& total)
+    {
+      uint32_t n = 0U;
+
+      while (first != last)
+      {
+        total += TTerm::template get<TInput, TCalc>(*first);
+
+        ++first;
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Adds the sum and the sum of squares of a floating point random access
+    /// range. Returns the number of samples.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TIterator>
+    typename etl::enable_if<use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first, TIterator last, TCalc& sum, TCalc& sum_of_squares)
+    {
+      typedef accumulate_parameters<> parameters;
+
+      const size_t n = size_t(last - first);
+      size_t remaining = n;
+
+      while (remaining >= parameters::Lanes)
+      {
+        const size_t block = ((remaining < parameters::Block_Size) ? remaining : parameters::Block_Size) & ~(parameters::Lanes - 1U);
+
+        TCalc s[parameters::Lanes];
+        TCalc q[parameters::Lanes];
+
+        for (size_t j = 0U; j < parameters::Lanes; ++j)
+        {
+          s[j] = TCalc(0);
+          q[j] = TCalc(0);
+        }
+
+        for (size_t i = 0U; i < block; i += parameters::Lanes)
+        {
+          for (size_t j = 0U; j < parameters::Lanes; ++j)
+          {
+            const TInput v = first[i + j];
+
+            s[j] += TCalc(v);
+            q[j] += TCalc(v * v);
+          }
+        }
+
+        sum            += fold(s);
+        sum_of_squares += fold(q);
+
+        first     += block;
+        remaining -= block;
+      }
+
+      while (remaining != 0U)
+      {
+        const TInput v = *first;
+
+        sum            += TCalc(v);
+        sum_of_squares += TCalc(v * v);
+
+        ++first;
+        --remaining;
+      }
+
+      return uint32_t(n);
+    }
+
+    //*************************************************************************
+    /// Adds the sum and the sum of squares of any other range.
+    /// Returns the number of samples.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TIterator>
+    typename etl::enable_if<!use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first, TIterator last, TCalc& sum, TCalc& sum_of_squares)
+    {
+      uint32_t n = 0U;
+
+      while (first != last)
+      {
+        const TInput v = *first;
+
+        sum            += TCalc(v);
+        sum_of_squares += TCalc(v * v);
+
+        ++first;
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Adds the sums and the inner product of a pair of floating point random
+    /// access ranges. Returns the number of sample pairs.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TIterator>
+    typename etl::enable_if<use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first1, TIterator last1, TIterator first2,
+                 TCalc& sum1, TCalc& sum2, TCalc& inner_product)
+    {
+      typedef accumulate_parameters<> parameters;
+
+      const size_t n = size_t(last1 - first1);
+      size_t remaining = n;
+
+      while (remaining >= parameters::Lanes)
+      {
+        const size_t block = ((remaining < parameters::Block_Size) ? remaining : parameters::Block_Size) & ~(parameters::Lanes - 1U);
+
+        TCalc a[parameters::Lanes];
+        TCalc b[parameters::Lanes];
+        TCalc ab[parameters::Lanes];
+
+        for (size_t j = 0U; j < parameters::Lanes; ++j)
+        {
+          a[j]  = TCalc(0);
+          b[j]  = TCalc(0);
+          ab[j] = TCalc(0);
+        }
+
+        for (size_t i = 0U; i < block; i += parameters::Lanes)
+        {
+          for (size_t j = 0U; j < parameters::Lanes; ++j)
+          {
+            const TInput x = first1[i + j];
+            const TInput y = first2[i + j];
+
+            a[j]  += TCalc(x);
+            b[j]  += TCalc(y);
+            ab[j] += TCalc(x * y);
+          }
+        }
+
+        sum1          += fold(a);
+        sum2          += fold(b);
+        inner_product += fold(ab);
+
+        first1    += block;
+        first2    += block;
+        remaining -= block;
+      }
+
+      while (remaining != 0U)
+      {
+        const TInput x = *first1;
+        const TInput y = *first2;
+
+        sum1          += TCalc(x);
+        sum2          += TCalc(y);
+        inner_product += TCalc(x * y);
+
+        ++first1;
+        ++first2;
+        --remaining;
+      }
+
+      return uint32_t(n);
+    }
+
+    //*************************************************************************
+    /// Adds the sums and the inner product of any other pair of ranges.
+    /// Returns the number of sample pairs.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TIterator>
+    typename etl::enable_if<!use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first1, TIterator last1, TIterator first2,
+                 TCalc& sum1, TCalc& sum2, TCalc& inner_product)
+    {
+      uint32_t n = 0U;
+
+      while (first1 != last1)
+      {
+        const TInput x = *first1;
+        const TInput y = *first2;
+
+        sum1          += TCalc(x);
+        sum2          += TCalc(y);
+        inner_product += TCalc(x * y);
+
+        ++first1;
+        ++first2;
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Adds the sums, the sums of squares and the inner product of a pair of
+    /// floating point random access ranges.
+    /// Returns the number of sample pairs.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TIterator>
+    typename etl::enable_if<use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first1, TIterator last1, TIterator first2,
+                 TCalc& sum1, TCalc& sum2, TCalc& sum_of_squares1, TCalc& sum_of_squares2, TCalc& inner_product)
+    {
+      typedef accumulate_parameters<> parameters;
+
+      const size_t n = size_t(last1 - first1);
+      size_t remaining = n;
+
+      while (remaining >= parameters::Lanes)
+      {
+        const size_t block = ((remaining < parameters::Block_Size) ? remaining : parameters::Block_Size) & ~(parameters::Lanes - 1U);
+
+        TCalc a[parameters::Lanes];
+        TCalc b[parameters::Lanes];
+        TCalc aa[parameters::Lanes];
+        TCalc bb[parameters::Lanes];
+        TCalc ab[parameters::Lanes];
+
+        for (size_t j = 0U; j < parameters::Lanes; ++j)
+        {
+          a[j]  = TCalc(0);
+          b[j]  = TCalc(0);
+          aa[j] = TCalc(0);
+          bb[j] = TCalc(0);
+          ab[j] = TCalc(0);
+        }
+
+        for (size_t i = 0U; i < block; i += parameters::Lanes)
+        {
+          for (size_t j = 0U; j < parameters::Lanes; ++j)
+          {
+            const TInput x = first1[i + j];
+            const TInput y = first2[i + j];
+
+            a[j]  += TCalc(x);
+            b[j]  += TCalc(y);
+            aa[j] += TCalc(x * x);
+            bb[j] += TCalc(y * y);
+            ab[j] += TCalc(x * y);
+          }
+        }
+
+        sum1            += fold(a);
+        sum2            += fold(b);
+        sum_of_squares1 += fold(aa);
+        sum_of_squares2 += fold(bb);
+        inner_product   += fold(ab);
+
+        first1    += block;
+        first2    += block;
+        remaining -= block;
+      }
+
+      while (remaining != 0U)
+      {
+        const TInput x = *first1;
+        const TInput y = *first2;
+
+        sum1            += TCalc(x);
+        sum2            += TCalc(y);
+        sum_of_squares1 += TCalc(x * x);
+        sum_of_squares2 += TCalc(y * y);
+        inner_product   += TCalc(x * y);
+
+        ++first1;
+        ++first2;
+        --remaining;
+      }
+
+      return uint32_t(n);
+    }
+
+    //*************************************************************************
+    /// Adds the sums, the sums of squares and the inner product of any other
+    /// pair of ranges.
+    /// Returns the number of sample pairs.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TIterator>
+    typename etl::enable_if<!use_blocks<TCalc, TIterator>::value, uint32_t>::type
+      accumulate(TIterator first1, TIterator last1, TIterator first2,
+                 TCalc& sum1, TCalc& sum2, TCalc& sum_of_squares1, TCalc& sum_of_squares2, TCalc& inner_product)
+    {
+      uint32_t n = 0U;
+
+      while (first1 != last1)
+      {
+        const TInput x = *first1;
+        const TInput y = *first2;
+
+        sum1            += TCalc(x);
+        sum2            += TCalc(y);
+        sum_of_squares1 += TCalc(x * x);
+        sum_of_squares2 += TCalc(y * y);
+        inner_product   += TCalc(x * y);
+
+        ++first1;
+        ++first2;
+        ++n;
+      }
+
+      return n;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,297 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// Finds a single character, one element at a time.
+    /// Usable in constant expressions.
+    //*************************************************************************
+    struct portable_char_finder
+    {
+      template <typename T>
+      static ETL_CONSTEXPR14 const T* find(const T* first, const T* last, T c)
+      {
+        while (first != last)
+        {
+          if (*first == c)
+          {
+            return first;
+          }
+
+          ++first;
+        }
+
+        return last;
+      }
+    };
+
+    //*************************************************************************
+    /// Finds a single character with memchr for single byte character types.
+    /// The library memchr compares a word or vector register at a time.
+    //*************************************************************************
+    struct memchr_char_finder
+    {
+      template <typename T>
+      static const T* find(const T* first, const T* last, T c)
+      {
+        if (sizeof(T) == 1U)
+        {
+          const void* p = (first != last) ? memchr(first, static_cast<unsigned char>(c), static_cast<size_t>(last - first)) : ETL_NULLPTR;
+
+          return (p != ETL_NULLPTR) ? static_cast<const T*>(p) : last;
+        }
+        else
+        {
+          return portable_char_finder::find(first, last, c);
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Finds the last occurrence of a character.
+    /// Returns 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* rfind_char(const T* first, const T* last, T c)
+    {
+      const T* itr = last;
+
+      while (itr != first)
+      {
+        --itr;
+
+        if (*itr == c)
+        {
+          return itr;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the sequence [s_first, s_last).
+    /// Candidates are found by a search for the first character, then
+    /// filtered on the last character before the rest is compared.
+    /// Returns 'last' if not found.
+    //*************************************************************************
+    template <typename TCharFinder, typename T>
+    ETL_CONSTEXPR14 const T* search(const T* first, const T* last, const T* s_first, const T* s_last)
+    {
+      const size_t length = static_cast<size_t>(s_last - s_first);
+
+      if (length == 0U)
+      {
+        return first;
+      }
+
+      if (static_cast<size_t>(last - first) < length)
+      {
+        return last;
+      }
+
+      const T  first_char = s_first[0];
+      const T  last_char  = s_first[length - 1U];
+      const T* end        = last - length + 1U; // One past the last possible match.
+
+      while (first != end)
+      {
+        first = TCharFinder::find(first, end, first_char);
+
+        if (first == end)
+        {
+          break;
+        }
+
+        if (first[length - 1U] == last_char)
+        {
+          size_t i = 1U;
+
+          while ((i < (length - 1U)) && (first[i] == s_first[i]))
+          {
+            ++i;
+          }
+
+          if (i >= (length - 1U))
+          {
+            return first;
+          }
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the sequence [s_first, s_last).
+    /// Candidates are found by a reverse search for the last character, then
+    /// filtered on the first character before the rest is compared.
+    /// Returns 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* rsearch(const T* first, const T* last, const T* s_first, const T* s_last)
+    {
+      const size_t length = static_cast<size_t>(s_last - s_first);
+
+      if (length == 0U)
+      {
+        return last;
+      }
+
+      if (static_cast<size_t>(last - first) < length)
+      {
+        return last;
+      }
+
+      const T  first_char = s_first[0];
+      const T  last_char  = s_first[length - 1U];
+      const T* begin      = first + length - 1U; // The earliest possible position of the last character.
+      const T* itr        = last;
+
+      while (itr != begin)
+      {
+        const T* p = rfind_char(begin, itr, last_char);
+
+        if (p == itr)
+        {
+          break;
+        }
+
+        const T* candidate = p - (length - 1U);
+
+        if (*candidate == first_char)
+        {
+          size_t i = 1U;
+
+          while ((i < (length - 1U)) && (candidate[i] == s_first[i]))
+          {
+            ++i;
+          }
+
+          if (i >= (length - 1U))
+          {
+            return candidate;
+          }
+        }
+
+        itr = p;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// A set of characters for the find_first_of families.
+    /// Characters less than 256 are held in a 256 bit map, so that testing one
+    /// costs the same whatever the size of the set. Any others, for wide
+    /// character types, are found by a search of the original set.
+    //*************************************************************************
+    template <typename T>
+    class character_set
+    {
+    public:
+
+      //***********************************************************************
+      /// Constructs the set from the characters in [first, last).
+      //***********************************************************************
+      ETL_CONSTEXPR14 character_set(const T* first, const T* last)
+        : bits()
+        , p_first(first)
+        , p_last(last)
+        , has_wide(false)
+      {
+        while (first != last)
+        {
+          const uint32_t index = to_index(*first++);
+
+          if (index < 256U)
+          {
+            bits[index >> 5U] |= (uint32_t(1U) << (index & 0x1FU));
+          }
+          else
+          {
+            has_wide = true;
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Returns true if the set contains the character.
+      //***********************************************************************
+      template <typename TChar>
+      ETL_CONSTEXPR14 bool contains(TChar c) const
+      {
+        const uint32_t index = to_index(static_cast<T>(c));
+
+        if (index < 256U)
+        {
+          return (bits[index >> 5U] & (uint32_t(1U) << (index & 0x1FU))) != 0U;
+        }
+        else
+        {
+          return has_wide && (portable_char_finder::find(p_first, p_last, static_cast<T>(c)) != p_last);
+        }
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Single byte characters are always in the map.
+      //***********************************************************************
+      static ETL_CONSTEXPR14 uint32_t to_index(T c)
+      {
+        return (sizeof(T) == 1U) ? static_cast<uint32_t>(static_cast<unsigned char>(c)) : static_cast<uint32_t>(c);
+      }
+
+      uint32_t bits[8];
+      const T* p_first;
+      const T* p_last;
+      bool     has_wide;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,333 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../timer.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer_wheel
+  {
+    //*************************************************************************
+    /// A hashed timing wheel of intrusively linked timers.
+    /// Each slot holds the timers that expire at a time that hashes to that slot.
+    /// Start and stop are O(1). Advancing time visits one slot per tick.
+    /// TTimer must have the members 'id', 'expiry', 'slot', 'previous' and 'next'.
+    /// The slot array must have number_of_slots_ + 1 entries; the last is the due list.
+    //*************************************************************************
+    template <typename TTimer>
+    class wheel
+    {
+    public:
+
+      typedef etl::timer::wheel_id::type id_type;
+
+      //*******************************
+      wheel(TTimer* ptimers_, id_type* pslots_, id_type number_of_slots_)
+        : ptimers(ptimers_)
+        , pslots(pslots_)
+        , mask(static_cast<id_type>(number_of_slots_ - 1U))
+        , due_slot(number_of_slots_)
+        , current_time(0U)
+        , number_active(0U)
+      {
+      }
+
+      //*******************************
+      /// Removes all of the timers from the wheel.
+      /// The timers themselves are not modified.
+      //*******************************
+      void clear()
+      {
+        for (size_t i = 0U; i <= due_slot; ++i)
+        {
+          pslots[i] = etl::timer::wheel_id::NO_TIMER;
+        }
+
+        number_active = 0U;
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return number_active == 0U;
+      }
+
+      //*******************************
+      /// Inserts a timer to expire after 'delay' ticks.
+      //*******************************
+      void insert(id_type id_, uint32_t delay)
+      {
+        TTimer& timer = ptimers[id_];
+
+        timer.expiry = current_time + delay;
+        link(id_, static_cast<id_type>(timer.expiry & mask));
+        ++number_active;
+      }
+
+      //*******************************
+      /// Removes a timer from the wheel.
+      //*******************************
+      void remove(id_type id_)
+      {
+        unlink(id_);
+        --number_active;
+      }
+
+      //*******************************
+      /// Moves the timers that expire at the current time to the due list.
+      /// Timers due at the same time are handled in the order they were started.
+      //*******************************
+      void collect()
+      {
+        id_type id = pslots[current_time & mask];
+
+        while (id != etl::timer::wheel_id::NO_TIMER)
+        {
+          TTimer& timer = ptimers[id];
+          id = timer.next;
+
+          if (timer.expiry == current_time)
+          {
+            unlink(timer.id);
+            link(timer.id, due_slot);
+          }
+        }
+      }
+
+      //*******************************
+      /// Removes and returns the next due timer.
+      /// Returns etl::timer::wheel_id::NO_TIMER if there are none.
+      //*******************************
+      id_type pop_due()
+      {
+        id_type id = pslots[due_slot];
+
+        if (id != etl::timer::wheel_id::NO_TIMER)
+        {
+          remove(id);
+        }
+
+        return id;
+      }
+
+      //*******************************
+      /// Advances the time by one tick and collects the due timers.
+      /// If there are no active timers, the remaining count is skipped in one step.
+      /// Returns false when the count has been used up.
+      //*******************************
+      bool advance(uint32_t& count)
+      {
+        if (count == 0U)
+        {
+          return false;
+        }
+
+        if (number_active == 0U)
+        {
+          current_time += count;
+          count = 0U;
+          return false;
+        }
+
+        ++current_time;
+        --count;
+        collect();
+
+        return true;
+      }
+
+      //*******************************
+      /// Get the time to the next expiry.
+      /// Returns etl::timer::interval::No_Active_Interval if there are no active timers.
+      /// Visits the slots in time order, stopping once no nearer expiry is possible.
+      //*******************************
+      uint32_t time_to_next() const
+      {
+        uint32_t result = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+
+        if (pslots[due_slot] != etl::timer::wheel_id::NO_TIMER)
+        {
+          return 0U;
+        }
+
+        if (number_active != 0U)
+        {
+          // A timer in the slot at distance 'd' cannot expire in fewer than 'd' ticks.
+          for (uint32_t d = 0U; (d <= mask) && (d < result); ++d)
+          {
+            id_type id = pslots[(current_time + d) & mask];
+
+            while (id != etl::timer::wheel_id::NO_TIMER)
+            {
+              const TTimer& timer = ptimers[id];
+
+              uint32_t delta = timer.expiry - current_time;
+
+              if (delta < result)
+              {
+                result = delta;
+              }
+
+              id = timer.next;
+            }
+          }
+        }
+
+        return result;
+      }
+
+    private:
+
+      //*******************************
+      /// Links a timer to the front of a slot.
+      //*******************************
+      void link(id_type id_, id_type slot_)
+      {
+        TTimer& timer = ptimers[id_];
+
+        timer.slot     = slot_;
+        timer.previous = etl::timer::wheel_id::NO_TIMER;
+        timer.next     = pslots[slot_];
+
+        if (timer.next != etl::timer::wheel_id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = id_;
+        }
+
+        pslots[slot_] = id_;
+      }
+
+      //*******************************
+      /// Unlinks a timer from its slot.
+      //*******************************
+      void unlink(id_type id_)
+      {
+        TTimer& timer = ptimers[id_];
+
+        if (timer.previous == etl::timer::wheel_id::NO_TIMER)
+        {
+          pslots[timer.slot] = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (timer.next != etl::timer::wheel_id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        timer.slot     = etl::timer::wheel_id::NO_TIMER;
+        timer.previous = etl::timer::wheel_id::NO_TIMER;
+        timer.next     = etl::timer::wheel_id::NO_TIMER;
+      }
+
+      TTimer* const  ptimers;
+      id_type* const pslots;
+      const id_type  mask;
+      const id_type  due_slot;
+      uint32_t       current_time;
+      id_type        number_active;
+    };
+
+    //*************************************************************************
+    /// A list of the unregistered timers, linked through their 'next' member.
+    /// Register and unregister are O(1).
+    //*************************************************************************
+    template <typename TTimer>
+    class free_list
+    {
+    public:
+
+      typedef etl::timer::wheel_id::type id_type;
+
+      //*******************************
+      free_list(TTimer* ptimers_)
+        : ptimers(ptimers_)
+        , head(etl::timer::wheel_id::NO_TIMER)
+      {
+      }
+
+      //*******************************
+      /// Links all of the timers, lowest id first.
+      //*******************************
+      void initialise(id_type number_of_timers)
+      {
+        head = etl::timer::wheel_id::NO_TIMER;
+
+        while (number_of_timers != 0U)
+        {
+          --number_of_timers;
+          release(number_of_timers);
+        }
+      }
+
+      //*******************************
+      /// Takes a timer from the list.
+      /// Returns etl::timer::wheel_id::NO_TIMER if the list is empty.
+      //*******************************
+      id_type allocate()
+      {
+        id_type id = head;
+
+        if (id != etl::timer::wheel_id::NO_TIMER)
+        {
+          head = ptimers[id].next;
+          ptimers[id].next = etl::timer::wheel_id::NO_TIMER;
+        }
+
+        return id;
+      }
+
+      //*******************************
+      /// Returns a timer to the list.
+      //*******************************
+      void release(id_type id_)
+      {
+        ptimers[id_].next = head;
+        head = id_;
+      }
+
+    private:
+
+      TTimer* const ptimers;
+      id_type       head;
+    };
+  }
+}
+
+#endif
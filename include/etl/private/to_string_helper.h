@@ -44,6 +44,7 @@ SOFTWARE.
 #include "../iterator.h"
 #include "../math.h"
 #include "../limits.h"
+#include "shortest_decimal.h"
 
 #include <math.h>
 
@@ -136,8 +137,107 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// Character tables for integral formatting.
+    //***************************************************************************
+    template <typename T = void>
+    struct digit_tables
+    {
+      static const char decimal_pairs[201];
+      static const char lower_case[17];
+      static const char upper_case[17];
+    };
+
+    template <typename T>
+    const char digit_tables<T>::decimal_pairs[201] = "00010203040506070809"
+                                                     "10111213141516171819"
+                                                     "20212223242526272829"
+                                                     "30313233343536373839"
+                                                     "40414243444546474849"
+                                                     "50515253545556575859"
+                                                     "60616263646566676869"
+                                                     "70717273747576777879"
+                                                     "80818283848586878889"
+                                                     "90919293949596979899";
+
+    template <typename T>
+    const char digit_tables<T>::lower_case[17] = "0123456789abcdef";
+
+    template <typename T>
+    const char digit_tables<T>::upper_case[17] = "0123456789ABCDEF";
+
+    //***************************************************************************
+    /// Writes the decimal digits of the value, two at a time, backwards from 'last'.
+    ///\return A pointer to the first digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_decimal(TUnsigned value, TChar* last)
+    {
+      const char* pairs = digit_tables<>::decimal_pairs;
+
+      while (value >= 100U)
+      {
+        const size_t index = static_cast<size_t>(value % 100U) * 2U;
+        value /= 100U;
+
+        *--last = TChar(pairs[index + 1U]);
+        *--last = TChar(pairs[index]);
+      }
+
+      if (value >= 10U)
+      {
+        const size_t index = static_cast<size_t>(value) * 2U;
+
+        *--last = TChar(pairs[index + 1U]);
+        *--last = TChar(pairs[index]);
+      }
+      else
+      {
+        *--last = TChar('0' + value);
+      }
+
+      return last;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of the value in a power of 2 base, backwards from 'last'.
+    ///\tparam Shift The number of bits per digit.
+    ///\return A pointer to the first digit.
+    //***************************************************************************
+    template <size_t Shift, typename TChar, typename TUnsigned>
+    TChar* write_power_of_2(TUnsigned value, TChar* last, const char* digits)
+    {
+      do
+      {
+        *--last = TChar(digits[static_cast<size_t>(value & ((1U << Shift) - 1U))]);
+        value >>= Shift;
+      } while (value != 0U);
+
+      return last;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of the value in any base, backwards from 'last'.
+    ///\return A pointer to the first digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_digits(TUnsigned value, TChar* last, const uint32_t base, const bool upper_case)
+    {
+      do
+      {
+        const TUnsigned remainder = value % base;
+        value /= base;
+
+        *--last = (remainder > 9U) ? (upper_case ? TChar('A' + (remainder - 10U)) : TChar('a' + (remainder - 10U))) : TChar('0' + remainder);
+      } while (value != 0U);
+
+      return last;
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
+    /// The characters are built backwards in a local buffer and then appended
+    /// to the string in one operation.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_integral(T value,
@@ -146,8 +246,9 @@ namespace etl
                       bool append,
                       const bool negative)
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type       type;
+      typedef typename TIString::iterator         iterator;
+      typedef typename etl::make_unsigned<T>::type utype;
 
       if (!append)
       {
@@ -156,67 +257,92 @@ namespace etl
 
       iterator start = str.end();
 
-      if (value == 0)
+      utype magnitude = value;
+
+      if (etl::is_negative(value))
       {
-        // If number is negative, append '-' (a negative zero might occur for fractional numbers > -1.0)
-        if ((format.get_base() == 10U) && negative)
+        magnitude = 0U - magnitude;
+      }
+
+      // Room for the digits of the largest value in base 2, plus a prefix or sign.
+      type        buffer[etl::numeric_limits<utype>::digits + 3U];
+      type* const last = buffer + ETL_ARRAY_SIZE(buffer);
+      type*       first;
+
+      const uint32_t base = format.get_base();
+
+      switch (base)
+      {
+        case 10U:
         {
-          str.push_back(type('-'));
+          first = etl::private_to_string::write_decimal(magnitude, last);
+          break;
         }
 
-        str.push_back(type('0'));
-      }
-      else
-      {
-        // Extract the digits, in reverse order.
-        while (value != 0)
+        case 16U:
         {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
+          first = etl::private_to_string::write_power_of_2<4U>(magnitude, last, format.is_upper_case() ? digit_tables<>::upper_case : digit_tables<>::lower_case);
+          break;
         }
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10U) && negative)
+        case 8U:
         {
-          str.push_back(type('-'));
+          first = etl::private_to_string::write_power_of_2<3U>(magnitude, last, digit_tables<>::lower_case);
+          break;
         }
 
-        if (format.is_show_base())
+        case 2U:
         {
-          switch (format.get_base())
+          first = etl::private_to_string::write_power_of_2<1U>(magnitude, last, digit_tables<>::lower_case);
+          break;
+        }
+
+        default:
+        {
+          first = etl::private_to_string::write_digits(magnitude, last, base, format.is_upper_case());
+          break;
+        }
+      }
+
+      if ((magnitude != 0U) && format.is_show_base())
+      {
+        switch (base)
+        {
+          case 2U:
           {
-            case 2U:
-            {
-              str.push_back(format.is_upper_case() ? type('B') : type('b'));
-              str.push_back(type('0'));
-              break;
-            }
-
-            case 8U:
-            {
-              str.push_back(type('0'));
-              break;
-            }
-
-            case 16U:
-            {
-              str.push_back(format.is_upper_case() ? type('X') : type('x'));
-              str.push_back(type('0'));
-              break;
-            }
-
-            default:
-            {
-              break;
-            }
+            *--first = format.is_upper_case() ? type('B') : type('b');
+            *--first = type('0');
+            break;
+          }
+
+          case 8U:
+          {
+            *--first = type('0');
+            break;
+          }
+
+          case 16U:
+          {
+            *--first = format.is_upper_case() ? type('X') : type('x');
+            *--first = type('0');
+            break;
+          }
+
+          default:
+          {
+            break;
           }
         }
+      }
 
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
+      // If number is negative, prepend '-' (a negative zero might occur for fractional numbers > -1.0)
+      if ((base == 10U) && negative)
+      {
+        *--first = type('-');
       }
 
+      str.insert(str.end(), first, last);
+
       etl::private_to_string::add_alignment(str, start, format);
     }
 
@@ -312,6 +438,18 @@ namespace etl
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
       }
+#if ETL_USING_64BIT_TYPES
+      else if (format.is_shortest())
+      {
+        bool negative;
+        const etl::private_shortest_decimal::decimal shortest = etl::private_shortest_decimal::to_decimal(value, negative);
+
+        type buffer[32];
+        const uint32_t length = etl::private_shortest_decimal::write(shortest, negative, format.is_upper_case(), buffer);
+
+        str.insert(str.end(), buffer, buffer + length);
+      }
+#endif
       else
       {
         // Make sure we format the two halves correctly.
@@ -0,0 +1,116 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_BUCKET_POLICY_INCLUDED
+#define ETL_UNORDERED_BUCKET_POLICY_INCLUDED
+
+#include "../platform.h"
+#include "../power.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// Finalising mixer for a hash (the MurmurHash3 'fmix').
+    /// Spreads weak hashes, such as the identity hash for integers, across all bits.
+    //*************************************************************************
+    inline size_t mix_hash(size_t hash)
+    {
+#if ETL_PLATFORM_64BIT
+      uint64_t h = hash;
+      h ^= h >> 33U;
+      h *= 0xFF51AFD7ED558CCDULL;
+      h ^= h >> 33U;
+      h *= 0xC4CEB9FE1A85EC53ULL;
+      h ^= h >> 33U;
+      return h;
+#else
+      uint32_t h = hash;
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16U;
+      return h;
+#endif
+    }
+  }
+
+  //***************************************************************************
+  /// Bucket policy for the unordered containers.
+  /// The bucket is the hash modulo the number of buckets.
+  /// The number of buckets is as specified.
+  //***************************************************************************
+  struct unordered_bucket_modulo
+  {
+    template <size_t Buckets>
+    struct bucket_count
+    {
+      static ETL_CONSTANT size_t value = Buckets;
+    };
+
+    static size_t get_bucket_index(size_t hash, size_t number_of_buckets)
+    {
+      return hash % number_of_buckets;
+    }
+  };
+
+  template <size_t Buckets>
+  ETL_CONSTANT size_t unordered_bucket_modulo::bucket_count<Buckets>::value;
+
+  //***************************************************************************
+  /// Bucket policy for the unordered containers.
+  /// The hash is mixed and the bucket selected by masking with the number of buckets.
+  /// The number of buckets is rounded up to a power of 2.
+  /// Avoids a division, and the clustering of weak hashes, for each lookup.
+  //***************************************************************************
+  struct unordered_bucket_power_of_2
+  {
+    template <size_t Buckets>
+    struct bucket_count
+    {
+      static ETL_CONSTANT size_t value = etl::power_of_2_round_up<Buckets>::value;
+    };
+
+    static size_t get_bucket_index(size_t hash, size_t number_of_buckets)
+    {
+      return private_unordered::mix_hash(hash) & (number_of_buckets - 1U);
+    }
+  };
+
+  template <size_t Buckets>
+  ETL_CONSTANT size_t unordered_bucket_power_of_2::bucket_count<Buckets>::value;
+}
+
+#endif
@@ -0,0 +1,658 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_t read_position  = read.load(etl::memory_order_acquire);
+      size_t write_position = write.load(etl::memory_order_acquire);
+
+      ptrdiff_t n = get_difference(write_position, read_position);
+
+      if (n < 0)
+      {
+        return 0;
+      }
+      else if (n > ptrdiff_t(MAX_SIZE))
+      {
+        return MAX_SIZE;
+      }
+      else
+      {
+        return size_type(n);
+      }
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : MAX_SIZE(max_size_),
+        POSITION_LIMIT(((etl::integral_limits<size_t>::max / 2U) / max_size_) * max_size_),
+        write(0),
+        read(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Advances a position by 'n'.
+    /// Positions count from 0 to POSITION_LIMIT - 1, which is a multiple of
+    /// the capacity, so that the slot for a position is always 'position % MAX_SIZE'.
+    //*************************************************************************
+    size_t get_next_position(size_t position, size_t n) const
+    {
+      return (n < (POSITION_LIMIT - position)) ? position + n : n - (POSITION_LIMIT - position);
+    }
+
+    //*************************************************************************
+    /// The signed distance from position 'b' to position 'a'.
+    //*************************************************************************
+    ptrdiff_t get_difference(size_t a, size_t b) const
+    {
+      size_t distance = (a >= b) ? a - b : a + (POSITION_LIMIT - b);
+
+      if (distance > (POSITION_LIMIT / 2U))
+      {
+        return -ptrdiff_t(POSITION_LIMIT - distance);
+      }
+      else
+      {
+        return ptrdiff_t(distance);
+      }
+    }
+
+    const size_type MAX_SIZE;    ///< The maximum number of items in the queue.
+    const size_t POSITION_LIMIT; ///< The point at which the positions wrap.
+
+#if ETL_HAS_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION
+    char write_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_t> write; ///< The position of the next push.
+
+#if ETL_HAS_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION
+    char read_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_t> read;  ///< The position of the next pop.
+
+#if ETL_HAS_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION
+    char end_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomic's that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 10> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// It is lock free, using a sequence number per slot (D. Vyukov's bounded MPMC queue).
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    using base_t::write;
+    using base_t::read;
+    using base_t::MAX_SIZE;
+    using base_t::get_next_position;
+    using base_t::get_difference;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value);
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(etl::move(value));
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(etl::forward<Args>(args)...);
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    bool emplace()
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T();
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1);
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2);
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3);
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_t position;
+      cell_type* p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3, value4);
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_t position;
+      cell_type* p_cell = claim_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        T* p_value = reinterpret_cast<T*>(&p_cell->value);
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = etl::move(*p_value);
+#else
+        value = *p_value;
+#endif
+
+        p_value->~T();
+        publish_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_t position;
+      cell_type* p_cell = claim_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        reinterpret_cast<T*>(&p_cell->value)->~T();
+        publish_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Items pushed concurrently may remain in the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A slot in the queue.
+    /// The sequence says whether the slot is free or full for a particular position.
+    //*************************************************************************
+    struct cell_type
+    {
+      etl::atomic<size_t> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell_type* p_cells_, size_type max_size_)
+      : base_t(max_size_),
+        p_cells(p_cells_)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialises the slot sequences.
+    /// Called from the derived constructor, once the slots have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_cells[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the slot for the next push.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    cell_type* claim_push(size_t& position)
+    {
+      position = write.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_type* p_cell = &p_cells[position % MAX_SIZE];
+
+        const ptrdiff_t difference = get_difference(p_cell->sequence.load(etl::memory_order_acquire), position);
+
+        if (difference == 0)
+        {
+          // The slot is free for this position.
+          if (write.compare_exchange_weak(position, get_next_position(position, 1U), etl::memory_order_relaxed))
+          {
+            return p_cell;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot still holds the item from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer has claimed this position.
+          position = write.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a pushed item visible to the consumers.
+    //*************************************************************************
+    void publish_push(cell_type* p_cell, size_t position)
+    {
+      p_cell->sequence.store(get_next_position(position, 1U), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the slot for the next pop.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    cell_type* claim_pop(size_t& position)
+    {
+      position = read.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_type* p_cell = &p_cells[position % MAX_SIZE];
+
+        const ptrdiff_t difference = get_difference(p_cell->sequence.load(etl::memory_order_acquire), get_next_position(position, 1U));
+
+        if (difference == 0)
+        {
+          // The slot holds the item for this position.
+          if (read.compare_exchange_weak(position, get_next_position(position, 1U), etl::memory_order_relaxed))
+          {
+            return p_cell;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been filled for this position.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer has claimed this position.
+          position = read.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Frees a popped slot for the producers' next lap.
+    //*************************************************************************
+    void publish_pop(cell_type* p_cell, size_t position)
+    {
+      p_cell->sequence.store(get_next_position(position, MAX_SIZE), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    cell_type* p_cells; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// Define ETL_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION to place the push and pop
+  /// positions on separate cache lines (ETL_CACHE_LINE_SIZE).
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be at least 2.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    // With one slot, a full slot's sequence would equal the next lap's free value.
+    ETL_STATIC_ASSERT((SIZE >= 2U), "Size must be at least two");
+    ETL_STATIC_ASSERT((SIZE <= etl::integral_limits<size_type>::max), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(buffer, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The slots used in the queue_mpmc_atomic.
+    typename base_t::cell_type buffer[MAX_SIZE];
+  };
+
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::size_type queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+}
+
+#endif
+#endif
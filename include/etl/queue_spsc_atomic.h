@@ -39,6 +39,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -128,9 +129,11 @@ namespace etl
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
+      : RESERVED(reserved_),
+        write(0),
+        cached_read(0),
         read(0),
-        RESERVED(reserved_)
+        cached_write(0)
     {
     }
 
@@ -149,12 +152,135 @@ namespace etl
       return index;
     }
 
+    //*************************************************************************
+    /// Is there space for the item at 'next_index'?
+    /// Called from the 'push' thread.
+    /// Only reloads the read index when the cached copy says the queue is full.
+    //*************************************************************************
+    bool can_push(size_type next_index)
+    {
+      if (next_index == cached_read)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+      }
+
+      return (next_index != cached_read);
+    }
+
+    //*************************************************************************
+    /// Is there an item at 'read_index'?
+    /// Called from the 'pop' thread.
+    /// Only reloads the write index when the cached copy says the queue is empty.
+    //*************************************************************************
+    bool can_pop(size_type read_index)
+    {
+      if (read_index == cached_write)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+      }
+
+      return (read_index != cached_write);
+    }
+
+    //*************************************************************************
+    /// How many contiguous free slots are there from 'write_index'?
+    /// Called from the 'push' thread.
+    /// Only reloads the read index when the cached copy gives fewer than 'wanted'.
+    //*************************************************************************
+    size_type get_contiguous_free(size_type write_index, size_type wanted)
+    {
+      size_type n = calculate_contiguous_free(write_index, cached_read, RESERVED);
+
+      if (n < wanted)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+        n = calculate_contiguous_free(write_index, cached_read, RESERVED);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// How many contiguous items are there from 'read_index'?
+    /// Called from the 'pop' thread.
+    /// Only reloads the write index when the cached copy gives fewer than 'wanted'.
+    //*************************************************************************
+    size_type get_contiguous_used(size_type read_index, size_type wanted)
+    {
+      size_type n = calculate_contiguous_used(read_index, cached_write, RESERVED);
+
+      if (n < wanted)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+        n = calculate_contiguous_used(read_index, cached_write, RESERVED);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Advances an index by 'n', wrapping at 'maximum'.
+    /// 'n' must not take the index past 'maximum'.
+    //*************************************************************************
+    static size_type get_next_index(size_type index, size_type n, size_type maximum)
+    {
+      index += n;
+
+      if (index == maximum)
+      {
+        index = 0;
+      }
+
+      return index;
+    }
+
+    const size_type RESERVED;     ///< The maximum number of items in the queue.
+
+#if ETL_HAS_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION
+    char write_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
     etl::atomic<size_type> write; ///< Where to input new data.
+    size_type cached_read;        ///< The 'push' thread's copy of the read index.
+
+#if ETL_HAS_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION
+    char read_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
     etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+    size_type cached_write;       ///< The 'pop' thread's copy of the write index.
+
+#if ETL_HAS_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION
+    char end_padding[ETL_CACHE_LINE_SIZE];
+#endif
 
   private:
 
+    //*************************************************************************
+    /// The number of free slots from 'write_index' before the end of the buffer
+    /// or the slot before 'read_index'.
+    //*************************************************************************
+    static size_type calculate_contiguous_free(size_type write_index, size_type read_index, size_type reserved)
+    {
+      if (read_index > write_index)
+      {
+        return read_index - write_index - 1;
+      }
+      else
+      {
+        return (read_index == 0) ? reserved - write_index - 1 : reserved - write_index;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of items from 'read_index' before the end of the buffer
+    /// or 'write_index'.
+    //*************************************************************************
+    static size_type calculate_contiguous_used(size_type read_index, size_type write_index, size_type reserved)
+    {
+      return (write_index >= read_index) ? write_index - read_index : reserved - read_index;
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -203,6 +329,10 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::can_push;
+    using base_t::can_pop;
+    using base_t::get_contiguous_free;
+    using base_t::get_contiguous_used;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,7 +342,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -234,7 +364,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
@@ -259,7 +389,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
@@ -281,7 +411,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T();
 
@@ -304,7 +434,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -327,7 +457,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -350,7 +480,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -373,7 +503,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -394,7 +524,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -412,7 +542,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -440,7 +570,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -488,6 +618,172 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// The values are published with a single index store.
+    /// Pushes until the range is exhausted or the queue is full.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type count = 0;
+
+      while (first != last)
+      {
+        size_type n = get_contiguous_free(write_index, 1U);
+
+        if (n == 0U)
+        {
+          // Queue is full.
+          break;
+        }
+
+        T* p_item = p_buffer + write_index;
+
+        write_index = get_next_index(write_index, n, RESERVED);
+
+        while ((n != 0U) && (first != last))
+        {
+          ::new (p_item++) T(*first++);
+          --n;
+          ++count;
+        }
+
+        if (n != 0U)
+        {
+          // Stopped before the end of the free block.
+          write_index = size_type(p_item - p_buffer);
+        }
+      }
+
+      if (count != 0U)
+      {
+        write.store(write_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_count' values from the queue to an output iterator.
+    /// The slots are released with a single index store.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator destination, size_type max_count)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type count = 0;
+
+      while (count != max_count)
+      {
+        size_type n = get_contiguous_used(read_index, max_count - count);
+
+        if (n == 0U)
+        {
+          // Queue is empty.
+          break;
+        }
+
+        if (n > (max_count - count))
+        {
+          n = max_count - count;
+        }
+
+        T* p_item = p_buffer + read_index;
+
+        read_index = get_next_index(read_index, n, RESERVED);
+        count += n;
+
+        while (n-- != 0U)
+        {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+          *destination++ = etl::move(*p_item);
+#else
+          *destination++ = *p_item;
+#endif
+          p_item->~T();
+          ++p_item;
+        }
+      }
+
+      if (count != 0U)
+      {
+        read.store(read_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_count' contiguous free slots for writing in place.
+    /// The span may be shorter than requested if the queue is nearly full or the
+    /// free space wraps around the end of the buffer.
+    /// The slots are uninitialised storage; non-trivial types must be
+    /// constructed with placement new.
+    /// Called from the 'push' thread.
+    //*************************************************************************
+    etl::span<T> write_reserve(size_type max_count)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type n = get_contiguous_free(write_index, max_count);
+
+      return etl::span<T>(p_buffer + write_index, (n < max_count) ? n : max_count);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'count' slots of the last write_reserve.
+    /// 'count' must not be greater than the size of the reserved span.
+    /// Called from the 'push' thread.
+    //*************************************************************************
+    void write_commit(size_type count)
+    {
+      if (count != 0U)
+      {
+        size_type write_index = write.load(etl::memory_order_relaxed);
+
+        write.store(get_next_index(write_index, count, RESERVED), etl::memory_order_release);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous items at the front of the queue for reading in place.
+    /// The queue may contain more items after the end of the span, if they
+    /// wrap around the end of the buffer.
+    /// Called from the 'pop' thread.
+    //*************************************************************************
+    etl::span<T> read_acquire()
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type n = get_contiguous_used(read_index, RESERVED);
+
+      return etl::span<T>(p_buffer + read_index, n);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'count' items of the last read_acquire.
+    /// 'count' must not be greater than the size of the acquired span.
+    /// Called from the 'pop' thread.
+    //*************************************************************************
+    void read_release(size_type count)
+    {
+      if (count != 0U)
+      {
+        size_type read_index = read.load(etl::memory_order_relaxed);
+
+        T* p_item = p_buffer + read_index;
+
+        for (size_type i = 0U; i < count; ++i)
+        {
+          p_item[i].~T();
+        }
+
+        read.store(get_next_index(read_index, count, RESERVED), etl::memory_order_release);
+      }
+    }
+
   protected:
 
     //*************************************************************************
@@ -517,6 +813,9 @@ namespace etl
   ///\ingroup queue_spsc
   /// A fixed capacity spsc queue.
   /// This queue supports concurrent access by one producer and one consumer.
+  /// Define ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION to place the read and write
+  /// indexes on separate cache lines (ETL_CACHE_LINE_SIZE), so that the producer
+  /// and consumer cores do not contend for the same line.
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
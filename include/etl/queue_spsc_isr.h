@@ -38,6 +38,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -142,6 +143,58 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue from an ISR.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_isr(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_count' values to an output iterator from an ISR.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_isr(TOutputIterator destination, size_type max_count)
+    {
+      return pop_implementation(destination, max_count);
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_count' contiguous free slots for writing in place, from an ISR.
+    //*************************************************************************
+    etl::span<T> write_reserve_from_isr(size_type max_count)
+    {
+      return write_reserve_implementation(max_count);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'count' slots of the last write_reserve, from an ISR.
+    //*************************************************************************
+    void write_commit_from_isr(size_type count)
+    {
+      write_commit_implementation(count);
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous items at the front of the queue, from an ISR.
+    //*************************************************************************
+    etl::span<T> read_acquire_from_isr()
+    {
+      return read_acquire_implementation();
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'count' items of the last read_acquire, from an ISR.
+    //*************************************************************************
+    void read_release_from_isr(size_type count)
+    {
+      read_release_implementation(count);
+    }
+
     //*************************************************************************
     /// Is the queue empty?
     /// Called from ISR.
@@ -435,6 +488,113 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      size_type count = 0;
+
+      while ((first != last) && (current_size != MAX_SIZE))
+      {
+        ::new (&p_buffer[write_index]) T(*first);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
+        ++current_size;
+        ++first;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_count' values from the queue to an output iterator.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator destination, size_type max_count)
+    {
+      size_type count = 0;
+
+      while ((count != max_count) && (current_size != 0))
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ISR_FORCE_CPP03_IMPLEMENTATION)
+        *destination = etl::move(p_buffer[read_index]);
+#else
+        *destination = p_buffer[read_index];
+#endif
+
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, MAX_SIZE);
+
+        --current_size;
+        ++destination;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_count' contiguous free slots for writing in place.
+    /// The slots are uninitialised storage; non-trivial types must be
+    /// constructed with placement new.
+    //*************************************************************************
+    etl::span<T> write_reserve_implementation(size_type max_count)
+    {
+      size_type n = MAX_SIZE - current_size;
+
+      if (n > (MAX_SIZE - write_index))
+      {
+        n = MAX_SIZE - write_index;
+      }
+
+      return etl::span<T>(p_buffer + write_index, (n < max_count) ? n : max_count);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'count' slots of the last write_reserve.
+    /// 'count' must not be greater than the size of the reserved span.
+    //*************************************************************************
+    void write_commit_implementation(size_type count)
+    {
+      write_index = get_next_index(write_index, count, MAX_SIZE);
+      current_size += count;
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous items at the front of the queue for reading in place.
+    //*************************************************************************
+    etl::span<T> read_acquire_implementation()
+    {
+      size_type n = current_size;
+
+      if (n > (MAX_SIZE - read_index))
+      {
+        n = MAX_SIZE - read_index;
+      }
+
+      return etl::span<T>(p_buffer + read_index, n);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'count' items of the last read_acquire.
+    /// 'count' must not be greater than the size of the acquired span.
+    //*************************************************************************
+    void read_release_implementation(size_type count)
+    {
+      for (size_type i = 0U; i < count; ++i)
+      {
+        p_buffer[read_index + i].~T();
+      }
+
+      read_index = get_next_index(read_index, count, MAX_SIZE);
+      current_size -= count;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -450,6 +610,22 @@ namespace etl
       return index;
     }
 
+    //*************************************************************************
+    /// Advances an index by 'n', wrapping at 'maximum'.
+    /// 'n' must not take the index past 'maximum'.
+    //*************************************************************************
+    static size_type get_next_index(size_type index, size_type n, size_type maximum)
+    {
+      index += n;
+
+      if (index == maximum)
+      {
+        index = 0;
+      }
+
+      return index;
+    }
+
     T* p_buffer;              ///< The internal buffer.
     size_type write_index;    ///< Where to input new data.
     size_type read_index;     ///< Where to get the oldest data.
@@ -700,6 +876,94 @@ namespace etl
       TAccess::unlock();
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Interrupts are locked once for the whole range.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      TAccess::lock();
+
+      size_type result = this->push_implementation(first, last);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_count' values from the queue to an output iterator.
+    /// Interrupts are locked once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator destination, size_type max_count)
+    {
+      TAccess::lock();
+
+      size_type result = this->pop_implementation(destination, max_count);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_count' contiguous free slots for writing in place.
+    /// The span may be shorter than requested if the queue is nearly full or the
+    /// free space wraps around the end of the buffer.
+    //*************************************************************************
+    etl::span<T> write_reserve(size_type max_count)
+    {
+      TAccess::lock();
+
+      etl::span<T> result = this->write_reserve_implementation(max_count);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'count' slots of the last write_reserve.
+    //*************************************************************************
+    void write_commit(size_type count)
+    {
+      TAccess::lock();
+
+      this->write_commit_implementation(count);
+
+      TAccess::unlock();
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous items at the front of the queue for reading in place.
+    //*************************************************************************
+    etl::span<T> read_acquire()
+    {
+      TAccess::lock();
+
+      etl::span<T> result = this->read_acquire_implementation();
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'count' items of the last read_acquire.
+    //*************************************************************************
+    void read_release(size_type count)
+    {
+      TAccess::lock();
+
+      this->read_release_implementation(count);
+
+      TAccess::unlock();
+    }
+
     //*************************************************************************
     /// Is the queue empty?
     //*************************************************************************
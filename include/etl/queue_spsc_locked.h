@@ -39,6 +39,7 @@ SOFTWARE.
 #include "function.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -126,6 +127,22 @@ namespace etl
       return index;
     }
 
+    //*************************************************************************
+    /// Advances an index by 'n', wrapping at 'maximum'.
+    /// 'n' must not take the index past 'maximum'.
+    //*************************************************************************
+    static size_type get_next_index(size_type index, size_type n, size_type maximum)
+    {
+      index += n;
+
+      if (index == maximum)
+      {
+        index = 0;
+      }
+
+      return index;
+    }
+
     size_type write_index;    ///< Where to input new data.
     size_type read_index;     ///< Where to get the oldest data.
     size_type current_size;   ///< The current size of the queue.
@@ -518,6 +535,158 @@ namespace etl
       unlock();
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Unlocked.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_unlocked(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Locked once for the whole range.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      lock();
+
+      size_type result = push_implementation(first, last);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_count' values from the queue to an output iterator.
+    /// Unlocked.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_unlocked(TOutputIterator destination, size_type max_count)
+    {
+      return pop_implementation(destination, max_count);
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_count' values from the queue to an output iterator.
+    /// Locked once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator destination, size_type max_count)
+    {
+      lock();
+
+      size_type result = pop_implementation(destination, max_count);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_count' contiguous free slots for writing in place.
+    /// Unlocked.
+    //*************************************************************************
+    etl::span<T> write_reserve_from_unlocked(size_type max_count)
+    {
+      return write_reserve_implementation(max_count);
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_count' contiguous free slots for writing in place.
+    /// The span may be shorter than requested if the queue is nearly full or the
+    /// free space wraps around the end of the buffer.
+    /// The slots are uninitialised storage; non-trivial types must be
+    /// constructed with placement new.
+    //*************************************************************************
+    etl::span<T> write_reserve(size_type max_count)
+    {
+      lock();
+
+      etl::span<T> result = write_reserve_implementation(max_count);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'count' slots of the last write_reserve.
+    /// Unlocked.
+    //*************************************************************************
+    void write_commit_from_unlocked(size_type count)
+    {
+      write_commit_implementation(count);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'count' slots of the last write_reserve.
+    /// 'count' must not be greater than the size of the reserved span.
+    //*************************************************************************
+    void write_commit(size_type count)
+    {
+      lock();
+
+      write_commit_implementation(count);
+
+      unlock();
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous items at the front of the queue for reading in place.
+    /// Unlocked.
+    //*************************************************************************
+    etl::span<T> read_acquire_from_unlocked()
+    {
+      return read_acquire_implementation();
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous items at the front of the queue for reading in place.
+    /// The queue may contain more items after the end of the span, if they
+    /// wrap around the end of the buffer.
+    //*************************************************************************
+    etl::span<T> read_acquire()
+    {
+      lock();
+
+      etl::span<T> result = read_acquire_implementation();
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'count' items of the last read_acquire.
+    /// Unlocked.
+    //*************************************************************************
+    void read_release_from_unlocked(size_type count)
+    {
+      read_release_implementation(count);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'count' items of the last read_acquire.
+    /// 'count' must not be greater than the size of the acquired span.
+    //*************************************************************************
+    void read_release(size_type count)
+    {
+      lock();
+
+      read_release_implementation(count);
+
+      unlock();
+    }
+
     //*************************************************************************
     /// How much free space available in the queue.
     //*************************************************************************
@@ -826,6 +995,115 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Unlocked
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      size_type count = 0;
+
+      while ((first != last) && (this->current_size != this->MAX_SIZE))
+      {
+        ::new (&p_buffer[this->write_index]) T(*first);
+
+        this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
+
+        ++this->current_size;
+        ++first;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_count' values from the queue to an output iterator.
+    /// Unlocked
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator destination, size_type max_count)
+    {
+      size_type count = 0;
+
+      while ((count != max_count) && (this->current_size != 0))
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION)
+        *destination = etl::move(p_buffer[this->read_index]);
+#else
+        *destination = p_buffer[this->read_index];
+#endif
+
+        p_buffer[this->read_index].~T();
+
+        this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
+
+        --this->current_size;
+        ++destination;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_count' contiguous free slots for writing in place.
+    /// Unlocked
+    //*************************************************************************
+    etl::span<T> write_reserve_implementation(size_type max_count)
+    {
+      size_type n = this->MAX_SIZE - this->current_size;
+
+      if (n > (this->MAX_SIZE - this->write_index))
+      {
+        n = this->MAX_SIZE - this->write_index;
+      }
+
+      return etl::span<T>(p_buffer + this->write_index, (n < max_count) ? n : max_count);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'count' slots of the last write_reserve.
+    /// Unlocked
+    //*************************************************************************
+    void write_commit_implementation(size_type count)
+    {
+      this->write_index = this->get_next_index(this->write_index, count, this->MAX_SIZE);
+      this->current_size += count;
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous items at the front of the queue.
+    /// Unlocked
+    //*************************************************************************
+    etl::span<T> read_acquire_implementation()
+    {
+      size_type n = this->current_size;
+
+      if (n > (this->MAX_SIZE - this->read_index))
+      {
+        n = this->MAX_SIZE - this->read_index;
+      }
+
+      return etl::span<T>(p_buffer + this->read_index, n);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'count' items of the last read_acquire.
+    /// Unlocked
+    //*************************************************************************
+    void read_release_implementation(size_type count)
+    {
+      for (size_type i = 0U; i < count; ++i)
+      {
+        p_buffer[this->read_index + i].~T();
+      }
+
+      this->read_index = this->get_next_index(this->read_index, count, this->MAX_SIZE);
+      this->current_size -= count;
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_locked(const iqueue_spsc_locked&) ETL_DELETE;
     iqueue_spsc_locked& operator =(const iqueue_spsc_locked&) ETL_DELETE;
@@ -0,0 +1,127 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_REFERENCE_COUNTED_MESSAGE_POOL_ATOMIC_INCLUDED
+#define ETL_REFERENCE_COUNTED_MESSAGE_POOL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "reference_counted_message_pool.h"
+#include "fixed_sized_memory_block_allocator_atomic.h"
+#include "atomic.h"
+
+#if ETL_USING_CPP11 && ETL_HAS_ATOMIC && ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  namespace private_reference_counted_message_pool_atomic
+  {
+    //*************************************************************************
+    /// Holds the memory block allocator so that it is constructed before the
+    /// message pool that refers to it.
+    //*************************************************************************
+    template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+    struct allocator_holder
+    {
+      etl::fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize> memory_block_allocator;
+    };
+  }
+
+  //***************************************************************************
+  /// A pool of reference counted messages that may be shared between threads
+  /// without a lock.
+  /// The messages are held in a lock free pool sized for the largest of
+  /// TMessages, and their reference counts are etl::atomic_int32_t, so
+  /// etl::shared_message objects created from it may be copied and released
+  /// from any thread. The lock() and unlock() hooks are not used.
+  /// VSize is the number of messages that may be allocated at once.
+  //***************************************************************************
+  template <size_t VSize, typename... TMessages>
+  class reference_counted_message_pool_atomic
+    : private private_reference_counted_message_pool_atomic::allocator_holder<reference_counted_message_pool<etl::atomic_int32_t>::pool_message_parameters<TMessages...>::max_size,
+                                                                              reference_counted_message_pool<etl::atomic_int32_t>::pool_message_parameters<TMessages...>::max_alignment,
+                                                                              VSize>
+    , public etl::reference_counted_message_pool<etl::atomic_int32_t>
+  {
+  private:
+
+    typedef etl::reference_counted_message_pool<etl::atomic_int32_t>  base_t;
+    typedef base_t::pool_message_parameters<TMessages...>             parameters_t;
+
+    typedef private_reference_counted_message_pool_atomic::allocator_holder<parameters_t::max_size,
+                                                                            parameters_t::max_alignment,
+                                                                            VSize> holder_t;
+
+  public:
+
+    static ETL_CONSTANT size_t Size = VSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    reference_counted_message_pool_atomic()
+      : holder_t()
+      , base_t(holder_t::memory_block_allocator)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated messages.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return holder_t::memory_block_allocator.size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of free messages.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return holder_t::memory_block_allocator.available();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of messages.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return VSize;
+    }
+  };
+
+  template <size_t VSize, typename... TMessages>
+  ETL_CONSTANT size_t reference_counted_message_pool_atomic<VSize, TMessages...>::Size;
+}
+
+#endif
+
+#endif
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "private/statistics_accumulate.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -120,11 +121,20 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first);
-        ++first;
-      }
+      counter += private_statistics::accumulate<TInput, private_statistics::square_term>(first, last, sum_of_squares);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add the values added to another rms.
+    /// Allows partial results, calculated on separate threads or blocks of
+    /// data, to be combined.
+    //*********************************
+    void merge(const rms& other)
+    {
+      sum_of_squares += other.sum_of_squares;
+      counter        += other.counter;
+      recalculate = true;
     }
 
     //*********************************
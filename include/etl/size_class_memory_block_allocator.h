@@ -0,0 +1,342 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "generic_pool.h"
+#include "ipool.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// Describes one size class of a size_class_memory_block_allocator.
+  /// VBlock_Size is the largest request served by the class and VSize is the
+  /// number of blocks in it.
+  //***************************************************************************
+  template <size_t VBlock_Size, size_t VSize>
+  struct memory_block_class
+  {
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Size       = VSize;
+  };
+
+  template <size_t VBlock_Size, size_t VSize>
+  ETL_CONSTANT size_t memory_block_class<VBlock_Size, VSize>::Block_Size;
+
+  template <size_t VBlock_Size, size_t VSize>
+  ETL_CONSTANT size_t memory_block_class<VBlock_Size, VSize>::Size;
+
+  namespace private_size_class_memory_block_allocator
+  {
+    //*************************************************************************
+    /// Rounds a size up to a multiple of the alignment.
+    //*************************************************************************
+    template <size_t VSize, size_t VAlignment>
+    struct round_up
+    {
+      static ETL_CONSTANT size_t value = ((VSize + VAlignment - 1U) / VAlignment) * VAlignment;
+    };
+
+    //*************************************************************************
+    /// Checks that the block sizes of the classes strictly increase.
+    //*************************************************************************
+    template <typename... TClasses>
+    struct is_ascending : etl::true_type
+    {
+    };
+
+    template <typename TClass1, typename TClass2, typename... TClasses>
+    struct is_ascending<TClass1, TClass2, TClasses...>
+      : etl::integral_constant<bool, (TClass1::Block_Size < TClass2::Block_Size) && is_ascending<TClass2, TClasses...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The pools for the classes, one after another in memory, in class order.
+    //*************************************************************************
+    template <size_t VAlignment, typename... TClasses>
+    struct pools;
+
+    template <size_t VAlignment>
+    struct pools<VAlignment>
+    {
+      static ETL_CONSTANT size_t Max_Block_Size = 0U;
+
+      void get(etl::ipool**, const char**, size_t*)
+      {
+      }
+    };
+
+    template <size_t VAlignment, typename TClass, typename... TClasses>
+    struct pools<VAlignment, TClass, TClasses...>
+    {
+      static ETL_CONSTANT size_t Block_Size     = round_up<TClass::Block_Size, VAlignment>::value;
+      static ETL_CONSTANT size_t Max_Block_Size = (pools<VAlignment, TClasses...>::Max_Block_Size > Block_Size) ? pools<VAlignment, TClasses...>::Max_Block_Size : Block_Size;
+
+      //***********************************************************************
+      /// Fills in the pool, the end address and the block size of each class.
+      //***********************************************************************
+      void get(etl::ipool** p_pools, const char** p_ends, size_t* p_block_sizes)
+      {
+        *p_pools       = &pool;
+        *p_ends        = reinterpret_cast<const char*>(&pool) + sizeof(pool);
+        *p_block_sizes = Block_Size;
+
+        rest.get(p_pools + 1, p_ends + 1, p_block_sizes + 1);
+      }
+
+      etl::generic_pool<Block_Size, VAlignment, TClass::Size> pool;
+      pools<VAlignment, TClasses...>                          rest;
+    };
+  }
+
+  //***************************************************************************
+  /// A memory block allocator with a pool for each of several size classes.
+  /// A request is routed to the smallest class that will hold it by a table
+  /// indexed by size, rather than by asking each allocator in turn. If that
+  /// class is full then the next larger class is tried, and then the successor,
+  /// if configured.
+  /// The pools lie one after another in memory, so a block is released to its
+  /// class by comparing its address against the class boundaries, with no
+  /// virtual calls.
+  /// Each class records the highest number of blocks allocated from it.
+  /// VAlignment is the alignment of every block.
+  /// TClasses are etl::memory_block_class types, in ascending order of block size.
+  //***************************************************************************
+  template <size_t VAlignment, typename... TClasses>
+  class size_class_memory_block_allocator : public imemory_block_allocator
+  {
+  private:
+
+    typedef private_size_class_memory_block_allocator::pools<VAlignment, TClasses...> pools_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TClasses) != 0U, "At least one class is required");
+    ETL_STATIC_ASSERT(sizeof...(TClasses) <= 255U, "Too many classes");
+    ETL_STATIC_ASSERT((private_size_class_memory_block_allocator::is_ascending<TClasses...>::value), "Class block sizes must be in ascending order");
+
+    static ETL_CONSTANT size_t Alignment      = VAlignment;
+    static ETL_CONSTANT size_t Classes        = sizeof...(TClasses);
+    static ETL_CONSTANT size_t Max_Block_Size = pools_t::Max_Block_Size;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    size_class_memory_block_allocator()
+    {
+      storage.get(p_pools, p_ends, block_sizes);
+
+      p_begin = reinterpret_cast<const char*>(&storage);
+
+      // Map each multiple of the alignment to the smallest class that holds it.
+      size_t class_index = 0U;
+
+      for (size_t i = 0U; i < Lookup_Size; ++i)
+      {
+        while (block_sizes[class_index] < (i * VAlignment))
+        {
+          ++class_index;
+        }
+
+        lookup[i] = static_cast<uint8_t>(class_index);
+      }
+
+      reset_high_water_marks();
+    }
+
+    //*************************************************************************
+    /// Returns the number of size classes.
+    //*************************************************************************
+    size_t number_of_classes() const
+    {
+      return Classes;
+    }
+
+    //*************************************************************************
+    /// Returns the block size of a class.
+    //*************************************************************************
+    size_t block_size(size_t class_index) const
+    {
+      return block_sizes[class_index];
+    }
+
+    //*************************************************************************
+    /// Returns the number of blocks in a class.
+    //*************************************************************************
+    size_t max_blocks(size_t class_index) const
+    {
+      return p_pools[class_index]->max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of blocks currently allocated from a class.
+    //*************************************************************************
+    size_t allocated_blocks(size_t class_index) const
+    {
+      return p_pools[class_index]->size();
+    }
+
+    //*************************************************************************
+    /// Returns the highest number of blocks allocated from a class at once.
+    //*************************************************************************
+    size_t high_water_mark(size_t class_index) const
+    {
+      return high_water_marks[class_index];
+    }
+
+    //*************************************************************************
+    /// Sets the high water marks to the numbers currently allocated.
+    //*************************************************************************
+    void reset_high_water_marks()
+    {
+      for (size_t i = 0U; i < Classes; ++i)
+      {
+        high_water_marks[i] = p_pools[i]->size();
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_alignment > VAlignment) || (required_size > Max_Block_Size))
+      {
+        return ETL_NULLPTR;
+      }
+
+      for (size_t i = lookup[(required_size + VAlignment - 1U) / VAlignment]; i < Classes; ++i)
+      {
+        etl::ipool& pool = *p_pools[i];
+
+        if (!pool.full())
+        {
+          void* p = pool.allocate<char>();
+
+          if (pool.size() > high_water_marks[i])
+          {
+            high_water_marks[i] = pool.size();
+          }
+
+          return p;
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      etl::ipool* p_pool = find_pool(pblock);
+
+      if (p_pool != ETL_NULLPTR)
+      {
+        p_pool->release(pblock);
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      return find_pool(pblock) != ETL_NULLPTR;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Lookup_Size = (Max_Block_Size / VAlignment) + 1U;
+
+    //*************************************************************************
+    /// Finds the pool that owns the block, or a null pointer if none do.
+    //*************************************************************************
+    etl::ipool* find_pool(const void* const pblock) const
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      if ((p < p_begin) || (p >= p_ends[Classes - 1U]))
+      {
+        return ETL_NULLPTR;
+      }
+
+      size_t i = 0U;
+
+      while (p >= p_ends[i])
+      {
+        ++i;
+      }
+
+      return p_pools[i]->is_in_pool(pblock) ? p_pools[i] : ETL_NULLPTR;
+    }
+
+    pools_t     storage;                    ///< The pools for each class.
+    etl::ipool* p_pools[Classes];           ///< The pool for each class.
+    const char* p_begin;                    ///< The start of the first pool.
+    const char* p_ends[Classes];            ///< The end of each pool.
+    size_t      block_sizes[Classes];       ///< The block size of each class.
+    size_t      high_water_marks[Classes];  ///< The most blocks allocated from each class.
+    uint8_t     lookup[Lookup_Size];        ///< The class for each multiple of the alignment.
+  };
+
+  template <size_t VAlignment, typename... TClasses>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, TClasses...>::Alignment;
+
+  template <size_t VAlignment, typename... TClasses>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, TClasses...>::Classes;
+
+  template <size_t VAlignment, typename... TClasses>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, TClasses...>::Max_Block_Size;
+}
+
+#endif
+
+#endif
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "private/statistics_accumulate.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -144,11 +145,21 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first);
-        ++first;
-      }
+      counter += private_statistics::accumulate<TInput>(first, last, sum, sum_of_squares);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add the values added to another standard deviation.
+    /// Allows partial results, calculated on separate threads or blocks of
+    /// data, to be combined.
+    //*********************************
+    void merge(const standard_deviation& other)
+    {
+      sum_of_squares += other.sum_of_squares;
+      sum            += other.sum;
+      counter        += other.counter;
+      recalculate = true;
     }
 
     //*********************************
@@ -37,6 +37,8 @@ SOFTWARE.
 #include "memory.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "iterator.h"
+#include "private/string_search.h"
 
 #include <ctype.h>
 #include <stdint.h>
@@ -504,20 +506,17 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_of(TIterator first, TIterator last, TPointer delimiters)
   {
+    typedef typename etl::iterator_traits<TPointer>::value_type char_type;
+
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
+
     TIterator itr(first);
 
     while (itr != last)
     {
-      TPointer pd = delimiters;
-
-      while (*pd != 0)
+      if (set.contains(*itr))
       {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
-
-        ++pd;
+        return itr;
       }
 
       ++itr;
@@ -550,26 +549,15 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_not_of(TIterator first, TIterator last, TPointer delimiters)
   {
+    typedef typename etl::iterator_traits<TPointer>::value_type char_type;
+
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
+
     TIterator itr(first);
 
     while (itr != last)
     {
-      TPointer pd = delimiters;
-
-      bool found = false;
-
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
+      if (!set.contains(*itr))
       {
         return itr;
       }
@@ -609,6 +597,10 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::iterator_traits<TPointer>::value_type char_type;
+
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
+
     TIterator itr(last);
     TIterator end(first);
 
@@ -616,16 +608,9 @@ namespace etl
     {
       --itr;
 
-      TPointer pd = delimiters;
-
-      while (*pd != 0)
+      if (set.contains(*itr))
       {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
-
-        ++pd;
+        return itr;
       }
     } while (itr != end);
 
@@ -661,6 +646,10 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::iterator_traits<TPointer>::value_type char_type;
+
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
+
     TIterator itr(last);
     TIterator end(first);
 
@@ -668,22 +657,7 @@ namespace etl
     {
       --itr;
 
-      TPointer pd = delimiters;
-
-      bool found = false;
-
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
+      if (!set.contains(*itr))
       {
         return itr;
       }
@@ -756,6 +730,322 @@ namespace etl
     return etl::optional<TStringView>(view);
   }
 
+  //***************************************************************************
+  /// token_delimiter
+  /// ANY_OF    Each character of the delimiter string is a delimiter.
+  /// SEQUENCE  The delimiter string as a whole is the delimiter.
+  //***************************************************************************
+  struct token_delimiter
+  {
+    enum enum_type
+    {
+      ANY_OF,
+      SEQUENCE
+    };
+
+    ETL_DECLARE_ENUM_TYPE(token_delimiter, int)
+    ETL_ENUM_TYPE(ANY_OF,   "any of")
+    ETL_ENUM_TYPE(SEQUENCE, "sequence")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// A pseudo-container that splits a string view into tokens.
+  /// The tokens are views of the input and are found lazily as the iterator
+  /// is incremented, so no storage is used.
+  /// The delimiter set is built once, on construction.
+  /// If a quote character is supplied, a token that starts with it extends to
+  /// the next quote character, ignoring any delimiters in between. The token
+  /// excludes the quotes, and anything from the closing quote to the next
+  /// delimiter is skipped.
+  /// The input and delimiter strings must outlive the tokenizer, and the
+  /// tokenizer must outlive its iterators.
+  //***************************************************************************
+  template <typename TStringView>
+  class tokenizer
+  {
+  public:
+
+    typedef TStringView                           value_type;
+    typedef typename TStringView::value_type      char_type;
+    typedef typename TStringView::const_pointer   const_pointer;
+    typedef typename TStringView::size_type       size_type;
+
+    //*************************************************************************
+    /// Const Iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class tokenizer;
+
+      //***********************************************************************
+      /// Default constructor
+      //***********************************************************************
+      const_iterator()
+        : p_tokenizer(ETL_NULLPTR)
+        , p_next(ETL_NULLPTR)
+        , token()
+      {
+      }
+
+      //***********************************************************************
+      /// Pre-increment operator
+      //***********************************************************************
+      const_iterator& operator ++()
+      {
+        next();
+
+        return *this;
+      }
+
+      //***********************************************************************
+      /// Post-increment operator
+      //***********************************************************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+
+        next();
+
+        return temp;
+      }
+
+      //***********************************************************************
+      /// De-reference operator
+      //***********************************************************************
+      const value_type& operator *() const
+      {
+        return token;
+      }
+
+      //***********************************************************************
+      /// Member access operator
+      //***********************************************************************
+      const value_type* operator ->() const
+      {
+        return &token;
+      }
+
+      //***********************************************************************
+      /// Equality operator
+      //***********************************************************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.token.data() == rhs.token.data()) && (lhs.p_next == rhs.p_next);
+      }
+
+      //***********************************************************************
+      /// Inequality operator
+      //***********************************************************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Constructor for use by tokenizer
+      //***********************************************************************
+      const_iterator(const tokenizer* p_tokenizer_, const_pointer p_next_)
+        : p_tokenizer(p_tokenizer_)
+        , p_next(p_next_)
+        , token()
+      {
+        next();
+      }
+
+      //***********************************************************************
+      /// Moves to the next token, or to the end if there are none left.
+      //***********************************************************************
+      void next()
+      {
+        while (p_next != ETL_NULLPTR)
+        {
+          const_pointer first       = p_next;
+          const_pointer token_end   = ETL_NULLPTR;
+          const_pointer search_from = first;
+
+          if (p_tokenizer->is_quote(first))
+          {
+            ++first;
+            token_end   = etl::private_string_search::portable_char_finder::find(first, p_tokenizer->p_end, p_tokenizer->quote);
+            search_from = (token_end == p_tokenizer->p_end) ? token_end : token_end + 1;
+          }
+
+          size_type     delimiter_length = 0U;
+          const_pointer delimiter        = p_tokenizer->find_delimiter(search_from, delimiter_length);
+
+          if (token_end == ETL_NULLPTR)
+          {
+            token_end = delimiter;
+          }
+
+          token  = value_type(first, static_cast<size_type>(token_end - first));
+          p_next = (delimiter == p_tokenizer->p_end) ? ETL_NULLPTR : delimiter + delimiter_length;
+
+          if (!token.empty() || !p_tokenizer->ignore_empty_tokens)
+          {
+            return;
+          }
+        }
+
+        token = value_type();
+      }
+
+      const tokenizer* p_tokenizer;
+      const_pointer    p_next;
+      value_type       token;
+    };
+
+    typedef const_iterator iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param input                The string to split.
+    ///\param delimiters           A null terminated string of delimiters.
+    ///\param ignore_empty_tokens_ If true, tokens of zero length are skipped.
+    ///\param delimiter_type_      How the delimiter string is interpreted.
+    ///\param quote_               The quote character, or 0 for none.
+    //*************************************************************************
+    tokenizer(const TStringView& input,
+              const_pointer      delimiters,
+              bool               ignore_empty_tokens_ = true,
+              token_delimiter    delimiter_type_      = token_delimiter::ANY_OF,
+              char_type          quote_               = char_type(0))
+      : p_begin(input.data())
+      , p_end(input.data() + input.size())
+      , p_delimiters(delimiters)
+      , delimiters_length(etl::strlen(delimiters))
+      , delimiter_set(p_delimiters, p_delimiters + delimiters_length)
+      , ignore_empty_tokens(ignore_empty_tokens_)
+      , delimiter_type(delimiter_type_)
+      , quote(quote_)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first token.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, p_begin);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first token.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, p_begin);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the tokens.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the tokens.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Is the character at 'p' an opening quote?
+    //*************************************************************************
+    bool is_quote(const_pointer p) const
+    {
+      return (quote != char_type(0)) && (p != p_end) && (*p == quote);
+    }
+
+    //*************************************************************************
+    /// Finds the next delimiter at or after 'first'.
+    /// Returns p_end if there are no more.
+    //*************************************************************************
+    const_pointer find_delimiter(const_pointer first, size_type& length) const
+    {
+      if (delimiter_type == token_delimiter::SEQUENCE)
+      {
+        length = delimiters_length;
+
+        if (delimiters_length == 0U)
+        {
+          return p_end;
+        }
+
+        return etl::private_string_search::search<etl::private_string_search::portable_char_finder>(first, p_end, p_delimiters, p_delimiters + delimiters_length);
+      }
+      else
+      {
+        length = 1U;
+
+        while (first != p_end)
+        {
+          if (delimiter_set.contains(*first))
+          {
+            return first;
+          }
+
+          ++first;
+        }
+
+        return p_end;
+      }
+    }
+
+    const_pointer                                        p_begin;
+    const_pointer                                        p_end;
+    const_pointer                                        p_delimiters;
+    size_type                                            delimiters_length;
+    etl::private_string_search::character_set<char_type> delimiter_set;
+    bool                                                 ignore_empty_tokens;
+    token_delimiter                                      delimiter_type;
+    char_type                                            quote;
+  };
+
+  //***************************************************************************
+  /// tokenize
+  /// Returns a tokenizer for the input.
+  //***************************************************************************
+  template <typename TStringView>
+  etl::tokenizer<TStringView> tokenize(const TStringView&                  input,
+                                       typename TStringView::const_pointer delimiters,
+                                       bool                                ignore_empty_tokens = true,
+                                       token_delimiter                     delimiter_type      = token_delimiter::ANY_OF,
+                                       typename TStringView::value_type    quote               = typename TStringView::value_type(0))
+  {
+    return etl::tokenizer<TStringView>(input, delimiters, ignore_empty_tokens, delimiter_type, quote);
+  }
+
+  //***************************************************************************
+  /// get_tokens
+  /// Adds the tokens in the range to the container until either the tokens
+  /// run out or the container is full.
+  /// Returns an iterator to the first token not added, so that the next batch
+  /// may be taken from there.
+  //***************************************************************************
+  template <typename TIterator, typename TContainer>
+  TIterator get_tokens(TIterator first, TIterator last, TContainer& tokens)
+  {
+    while ((first != last) && !tokens.full())
+    {
+      tokens.push_back(*first);
+      ++first;
+    }
+
+    return first;
+  }
+
   //***************************************************************************
   /// pad_left
   //***************************************************************************
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "hash.h"
 #include "basic_string.h"
 #include "algorithm.h"
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 #include <stdint.h>
@@ -479,26 +480,26 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if ((size() < view.size()) || (position > size()))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      const_pointer p = etl::private_string_search::search<etl::private_string_search::portable_char_finder>(mbegin + position, mend, view.begin(), view.end());
 
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return (p != mend) ? static_cast<size_type>(p - mbegin) : npos;
     }
 
     ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const
     {
-      return find(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      if (position >= size())
+      {
+        return npos;
+      }
+
+      const_pointer p = etl::private_string_search::portable_char_finder::find(mbegin + position, mend, c);
+
+      return (p != mend) ? static_cast<size_type>(p - mbegin) : npos;
     }
 
     ETL_CONSTEXPR14 size_type find(const T* text, size_type position, size_type count) const
@@ -523,19 +524,15 @@ namespace etl
 
       position = etl::min(position, size());
 
-      const_iterator iposition = etl::find_end(begin(),
-        begin() + position,
-        view.begin(),
-        view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
+      if (view.empty())
       {
-        return etl::distance(begin(), iposition);
+        return position;
       }
+
+      const_pointer p_end = mbegin + position;
+      const_pointer p     = etl::private_string_search::rsearch(mbegin, p_end, view.begin(), view.end());
+
+      return (p != p_end) ? static_cast<size_type>(p - mbegin) : npos;
     }
 
     ETL_CONSTEXPR14 size_type rfind(T c, size_type position = npos) const
@@ -558,20 +555,22 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
+      if (view.size() == 1U)
+      {
+        return find(view[0], position);
+      }
+
       const size_t lengthtext = size();
 
       if (position < lengthtext)
       {
+        const etl::private_string_search::character_set<T> set(view.begin(), view.end());
+
         for (size_t i = position; i < lengthtext; ++i)
         {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
+          if (set.contains(mbegin[i]))
           {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
+            return i;
           }
         }
       }
@@ -581,7 +580,7 @@ namespace etl
 
     ETL_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const
     {
-      return find_first_of(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      return find(c, position);
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(const T* text, size_type position, size_type count) const
@@ -606,23 +605,15 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const etl::private_string_search::character_set<T> set(view.begin(), view.end());
 
-      while (it != rend())
+      do
       {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
+        if (set.contains(mbegin[position]))
         {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
+          return position;
         }
-
-        ++it;
-        --position;
-      }
+      } while (position-- != 0U);
 
       return npos;
     }
@@ -651,22 +642,11 @@ namespace etl
 
       if (position < lengthtext)
       {
+        const etl::private_string_search::character_set<T> set(view.begin(), view.end());
+
         for (size_t i = position; i < lengthtext; ++i)
         {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-              break;
-            }
-          }
-
-          if (!found)
+          if (!set.contains(mbegin[i]))
           {
             return i;
           }
@@ -703,31 +683,15 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const etl::private_string_search::character_set<T> set(view.begin(), view.end());
 
-      while (it != rend())
+      do
       {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-            break;
-          }
-        }
-
-        if (!found)
+        if (!set.contains(mbegin[position]))
         {
           return position;
         }
-
-        ++it;
-        --position;
-      }
+      } while (position-- != 0U);
 
       return npos;
     }
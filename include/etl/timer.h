@@ -95,6 +95,19 @@ namespace etl
       typedef uint_least8_t type;
     };
 
+    // Timer wheel id.
+    // Allows more timers than etl::timer::id.
+    struct wheel_id
+    {
+      enum
+      {
+        NO_TIMER = 0xFFFF,
+        No_Timer = 0xFFFF
+      };
+
+      typedef uint_least16_t type;
+    };
+
     // Timer state.
     struct state
     {
@@ -366,6 +366,76 @@ namespace etl
              (radix == etl::radix::hexadecimal);
     }
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Loads 8 characters into a word, the first in the least significant byte.
+    /// Written as shifts so that it is constexpr and independent of endianness;
+    /// compilers merge it into a single load.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint64_t load_8_chars(const TChar* p)
+    {
+      return (static_cast<uint64_t>(static_cast<unsigned char>(p[0])))        |
+             (static_cast<uint64_t>(static_cast<unsigned char>(p[1])) << 8U)  |
+             (static_cast<uint64_t>(static_cast<unsigned char>(p[2])) << 16U) |
+             (static_cast<uint64_t>(static_cast<unsigned char>(p[3])) << 24U) |
+             (static_cast<uint64_t>(static_cast<unsigned char>(p[4])) << 32U) |
+             (static_cast<uint64_t>(static_cast<unsigned char>(p[5])) << 40U) |
+             (static_cast<uint64_t>(static_cast<unsigned char>(p[6])) << 48U) |
+             (static_cast<uint64_t>(static_cast<unsigned char>(p[7])) << 56U);
+    }
+
+    //***************************************************************************
+    /// Returns true if all 8 characters in the word are decimal digits.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    bool is_8_decimal_digits(const uint64_t word)
+    {
+      return (((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) == 0x3333333333333333ULL);
+    }
+
+    //***************************************************************************
+    /// Converts 8 decimal digit characters to their value.
+    /// Combines pairs, then quads, then the two halves, with three multiplies.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    uint32_t parse_8_decimal_digits(uint64_t word)
+    {
+      const uint64_t Mask        = 0x000000FF000000FFULL;
+      const uint64_t Multiplier1 = 100ULL + (1000000ULL << 32U);
+      const uint64_t Multiplier2 = 1ULL   + (10000ULL << 32U);
+
+      word -= 0x3030303030303030ULL;
+      word  = (word * 10U) + (word >> 8U);
+      word  = (((word & Mask) * Multiplier1) + (((word >> 16U) & Mask) * Multiplier2)) >> 32U;
+
+      return static_cast<uint32_t>(word);
+    }
+#endif
+
+    //***************************************************************************
+    /// Divides by a valid radix, with a constant divisor for each.
+    //***************************************************************************
+    template <typename TValue>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    TValue divide_by_radix(const TValue value, const etl::radix::value_type radix)
+    {
+      switch (radix)
+      {
+        case etl::radix::binary:      return value / 2U;
+        case etl::radix::octal:       return value / 8U;
+        case etl::radix::hexadecimal: return value / 16U;
+        default:                      return value / 10U;
+      }
+    }
+
     //***************************************************************************
     /// Accumulate integrals
     //***************************************************************************
@@ -377,6 +447,7 @@ namespace etl
       integral_accumulator(etl::radix::value_type radix_, TValue maximum_)
         : radix(radix_)
         , maximum(maximum_)
+        , maximum_before_multiply(divide_by_radix(maximum_, radix_))
         , integral_value(0)
         , conversion_status(to_arithmetic_status::Valid)
       {
@@ -394,14 +465,13 @@ namespace etl
 
         if (is_valid_char)
         {
-          TValue old_value = integral_value;
-          integral_value *= radix;
-
           // No multiplication overflow?
-          is_not_overflow = ((integral_value / radix) == old_value);
+          is_not_overflow = (integral_value <= maximum_before_multiply);
 
           if (is_not_overflow)
           {
+            integral_value *= radix;
+
             const char digit = digit_value(c, radix);
 
             // No addition overflow?
@@ -428,6 +498,27 @@ namespace etl
         return is_success;
       }
 
+      //*********************************
+      /// Adds the value of 8 decimal digits.
+      //*********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      bool add_8_decimal_digits(const uint32_t digits)
+      {
+        const TValue chunk = digits;
+
+        // No overflow?
+        if ((chunk > maximum) || (integral_value > ((maximum - chunk) / 100000000U)))
+        {
+          conversion_status = to_arithmetic_status::Overflow;
+          return false;
+        }
+
+        integral_value = (integral_value * 100000000U) + chunk;
+
+        return true;
+      }
+
       //*********************************
       ETL_NODISCARD
       ETL_CONSTEXPR14
@@ -456,6 +547,7 @@ namespace etl
 
       etl::radix::value_type radix;
       TValue maximum;
+      TValue maximum_before_multiply;
       TValue integral_value;
       to_arithmetic_status conversion_status;
     };
@@ -695,7 +787,28 @@ namespace etl
 
       integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
 
-      while ((itr != itr_end) && accumulator.add(convert(*itr)))
+      bool is_overflow = false;
+
+#if ETL_USING_64BIT_TYPES
+      // Consume decimal digits 8 at a time. Anything else is left for the per character loop.
+      if ((sizeof(TChar) == 1U) && (radix == etl::radix::decimal))
+      {
+        while (!is_overflow && ((itr_end - itr) >= 8))
+        {
+          const uint64_t word = load_8_chars(itr);
+
+          if (!is_8_decimal_digits(word))
+          {
+            break;
+          }
+
+          is_overflow = !accumulator.add_8_decimal_digits(parse_8_decimal_digits(word));
+          itr += 8;
+        }
+      }
+#endif
+
+      while (!is_overflow && (itr != itr_end) && accumulator.add(convert(*itr)))
       {
         // Keep looping until done or an error occurs.
         ++itr;
@@ -712,6 +825,248 @@ namespace etl
 
       return accumulator_result;
     }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Powers of 10 that are exact as a double.
+    //***************************************************************************
+    template <typename T = void>
+    struct powers_of_10
+    {
+      static const double exact_double[23];
+    };
+
+    template <typename T>
+    const double powers_of_10<T>::exact_double[23] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                       1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                       1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    //***************************************************************************
+    /// Limits for the exact floating point path.
+    /// A mantissa that fits in the type's digits, multiplied or divided by an
+    /// exact power of 10, gives a correctly rounded result (Clinger's fast path).
+    /// Each type is calculated in its own precision, as rounding a double
+    /// result again to float could give a different result.
+    //***************************************************************************
+    template <typename TValue>
+    struct floating_point_fast_path
+    {
+      typedef TValue calculation_type;
+
+      static ETL_CONSTANT int Digits       = etl::numeric_limits<calculation_type>::digits;
+      static ETL_CONSTANT int Max_Digits   = 19; // Always fits in a uint64_t.
+      static ETL_CONSTANT int Max_Exponent = (Digits >= 53) ? 22 : (Digits >= 24) ? 10 : -1;
+
+      static ETL_CONSTEXPR14 uint64_t max_mantissa()
+      {
+        return (Digits >= 64) ? etl::integral_limits<uint64_t>::max : (uint64_t(1U) << Digits);
+      }
+    };
+
+    template <typename TValue>
+    ETL_CONSTANT int floating_point_fast_path<TValue>::Digits;
+
+    template <typename TValue>
+    ETL_CONSTANT int floating_point_fast_path<TValue>::Max_Digits;
+
+    template <typename TValue>
+    ETL_CONSTANT int floating_point_fast_path<TValue>::Max_Exponent;
+
+    //***************************************************************************
+    /// Accumulates significant decimal digits into the mantissa, 8 at a time where possible.
+    /// Returns false if there are more than max_digits.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    bool accumulate_decimal_digits(const TChar*& p, const TChar* end, uint64_t& mantissa, int& digits, const int max_digits)
+    {
+      if (sizeof(TChar) == 1U)
+      {
+        while (((end - p) >= 8) && ((digits + 8) <= max_digits))
+        {
+          const uint64_t word = load_8_chars(p);
+
+          if (!is_8_decimal_digits(word))
+          {
+            break;
+          }
+
+          mantissa = (mantissa * 100000000U) + parse_8_decimal_digits(word);
+          digits  += 8;
+          p       += 8;
+        }
+      }
+
+      while ((p != end) && is_valid(convert(*p), etl::radix::decimal))
+      {
+        if (digits == max_digits)
+        {
+          return false;
+        }
+
+        mantissa = (mantissa * 10U) + static_cast<uint64_t>(digit_value(convert(*p), etl::radix::decimal));
+        ++digits;
+        ++p;
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Text to floating point for the common case of a short, well formed mantissa
+    /// and a small exponent, where the result can be calculated exactly.
+    /// Returns false if the text must be handled by the general accumulator,
+    /// including all cases where the text is invalid.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    bool to_floating_point_fast(const etl::basic_string_view<TChar>& view, TValue& value)
+    {
+      typedef floating_point_fast_path<TValue> limits;
+
+      if (limits::Max_Exponent < 0)
+      {
+        return false;
+      }
+
+      const TChar* p   = view.data();
+      const TChar* end = p + view.size();
+
+      const bool is_negative = (convert(*p) == char_constant::Negative_Char);
+
+      if (is_negative || (convert(*p) == char_constant::Positive_Char))
+      {
+        ++p;
+      }
+
+      uint64_t mantissa     = 0U;
+      int      digits       = 0;
+      int      exponent     = 0;
+      bool     has_mantissa = false;
+
+      // Integral part. Leading zeros are not significant.
+      const TChar* start = p;
+
+      while ((p != end) && (convert(*p) == '0'))
+      {
+        ++p;
+      }
+
+      if (!accumulate_decimal_digits(p, end, mantissa, digits, limits::Max_Digits))
+      {
+        return false;
+      }
+
+      has_mantissa = (p != start);
+
+      // Fractional part.
+      if ((p != end) && ((convert(*p) == char_constant::Radix_Point1_Char) || (convert(*p) == char_constant::Radix_Point2_Char)))
+      {
+        ++p;
+        start = p;
+
+        if (mantissa == 0U)
+        {
+          while ((p != end) && (convert(*p) == '0'))
+          {
+            ++p;
+          }
+        }
+
+        if (!accumulate_decimal_digits(p, end, mantissa, digits, limits::Max_Digits))
+        {
+          return false;
+        }
+
+        exponent     -= static_cast<int>(p - start);
+        has_mantissa  = has_mantissa || (p != start);
+      }
+
+      if (!has_mantissa)
+      {
+        return false;
+      }
+
+      // Exponent.
+      if ((p != end) && (convert(*p) == char_constant::Exponential_Char))
+      {
+        ++p;
+
+        const bool is_negative_exponent = (p != end) && (convert(*p) == char_constant::Negative_Char);
+
+        if ((p != end) && (is_negative_exponent || (convert(*p) == char_constant::Positive_Char)))
+        {
+          ++p;
+        }
+
+        start = p;
+
+        int exponent_value = 0;
+
+        while ((p != end) && is_valid(convert(*p), etl::radix::decimal))
+        {
+          // Large exponents are left to the accumulator.
+          if (exponent_value > 1000)
+          {
+            return false;
+          }
+
+          exponent_value = (exponent_value * 10) + digit_value(convert(*p), etl::radix::decimal);
+          ++p;
+        }
+
+        if (p == start)
+        {
+          return false;
+        }
+
+        exponent += is_negative_exponent ? -exponent_value : exponent_value;
+      }
+
+      // Trailing characters are left to the accumulator to report.
+      if (p != end)
+      {
+        return false;
+      }
+
+      if (mantissa == 0U)
+      {
+        value = is_negative ? -TValue(0) : TValue(0);
+        return true;
+      }
+
+      // Move any excess positive exponent into the mantissa, while it stays exact.
+      while ((exponent > limits::Max_Exponent) && (mantissa <= (limits::max_mantissa() / 10U)))
+      {
+        mantissa *= 10U;
+        --exponent;
+      }
+
+      if ((mantissa > limits::max_mantissa()) || (exponent < -limits::Max_Exponent) || (exponent > limits::Max_Exponent))
+      {
+        return false;
+      }
+
+      typedef typename limits::calculation_type calculation_type;
+
+      calculation_type result = static_cast<calculation_type>(mantissa);
+
+      if (exponent < 0)
+      {
+        result /= static_cast<calculation_type>(powers_of_10<>::exact_double[-exponent]);
+      }
+      else
+      {
+        result *= static_cast<calculation_type>(powers_of_10<>::exact_double[exponent]);
+      }
+
+      value = static_cast<TValue>(is_negative ? -result : result);
+
+      return true;
+    }
+#endif
   }
 
   //***************************************************************************
@@ -894,11 +1249,20 @@ namespace etl
     typedef typename result_type::unexpected_type unexpected_type;
 
     result_type result;
+#if ETL_USING_64BIT_TYPES
+    TValue fast_value = 0;
+#endif
 
     if (view.empty())
     {
       result = unexpected_type(to_arithmetic_status::Invalid_Format);
     }
+#if ETL_USING_64BIT_TYPES
+    else if (to_floating_point_fast(view, fast_value))
+    {
+      result = fast_value;
+    }
+#endif
     else
     {
       floating_point_accumulator accumulator;
@@ -0,0 +1,1627 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_MAP_INCLUDED
+#define ETL_UNORDERED_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "power.h"
+#include "binary.h"
+#include "endianness.h"
+#include "nth_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+#include "private/unordered_bucket_policy.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_SSE2
+  #include <emmintrin.h>
+#endif
+
+//*****************************************************************************
+///\defgroup unordered_flat_map unordered_flat_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// The elements are stored in a single contiguous array of slots, with a parallel
+/// array of control bytes holding 7 bits of each element's hash.
+/// Lookups test a group of 16 control bytes at a time, using SSE2 if enabled.
+/// Iterators and references remain valid after an erase, but an insert that
+/// has to reclaim erased slots may move the elements.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_full : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:full", ETL_UNORDERED_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_out_of_range : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:range", ETL_UNORDERED_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_unordered_flat_map
+  {
+    //*************************************************************************
+    /// A group of control bytes.
+    /// Each of the 'match' functions returns a bit mask, with bit 'n' set if
+    /// control byte 'n' of the group matches.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      enum
+      {
+        Size = 16
+      };
+
+      enum
+      {
+        Empty   = -128, // 0b10000000
+        Deleted = -2    // 0b11111110
+      };
+
+      //*******************************
+      explicit group(const int8_t* p_control_)
+#if ETL_USING_SSE2
+        : control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_control_)))
+#elif ETL_USING_64BIT_TYPES
+        : low(load(p_control_))
+        , high(load(p_control_ + 8))
+#else
+        : p_control(p_control_)
+#endif
+      {
+      }
+
+      //*******************************
+      /// Matches the 7 bit hash.
+      /// The 64 bit version may report false positives, which are rejected by the key comparison.
+      //*******************************
+      uint32_t match(int8_t h2) const
+      {
+#if ETL_USING_SSE2
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), control)));
+#elif ETL_USING_64BIT_TYPES
+        const uint64_t pattern = Lsbs * static_cast<uint8_t>(h2);
+
+        return compress(has_zero_byte(low ^ pattern)) | (compress(has_zero_byte(high ^ pattern)) << 8U);
+#else
+        uint32_t mask = 0U;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          mask |= (p_control[i] == h2) ? (uint32_t(1) << i) : 0U;
+        }
+
+        return mask;
+#endif
+      }
+
+      //*******************************
+      /// Matches empty slots.
+      //*******************************
+      uint32_t match_empty() const
+      {
+#if ETL_USING_SSE2
+        return match(Empty);
+#elif ETL_USING_64BIT_TYPES
+        // Empty is the only control value with bit 7 set and bit 1 clear.
+        return compress(low & ~(low << 6U) & Msbs) | (compress(high & ~(high << 6U) & Msbs) << 8U);
+#else
+        return match(Empty);
+#endif
+      }
+
+      //*******************************
+      /// Matches slots that are empty or have been erased.
+      //*******************************
+      uint32_t match_empty_or_deleted() const
+      {
+#if ETL_USING_SSE2
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(-1)), control)));
+#elif ETL_USING_64BIT_TYPES
+        // Empty and deleted are the only control values with bit 7 set.
+        return compress(low & Msbs) | (compress(high & Msbs) << 8U);
+#else
+        uint32_t mask = 0U;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          mask |= (p_control[i] < int8_t(-1)) ? (uint32_t(1) << i) : 0U;
+        }
+
+        return mask;
+#endif
+      }
+
+    private:
+
+#if ETL_USING_SSE2
+      __m128i control;
+#elif ETL_USING_64BIT_TYPES
+      static ETL_CONSTANT uint64_t Lsbs = 0x0101010101010101ULL;
+      static ETL_CONSTANT uint64_t Msbs = 0x8080808080808080ULL;
+
+      //*******************************
+      /// Loads 8 control bytes, with the first in the least significant byte.
+      //*******************************
+      static uint64_t load(const int8_t* p)
+      {
+        uint64_t value;
+        memcpy(&value, p, sizeof(value));
+
+        if (etl::endianness::value() == etl::endian::big)
+        {
+          value = etl::reverse_bytes(value);
+        }
+
+        return value;
+      }
+
+      //*******************************
+      /// Sets bit 7 of each byte that is zero.
+      //*******************************
+      static uint64_t has_zero_byte(uint64_t value)
+      {
+        return (value - Lsbs) & ~value & Msbs;
+      }
+
+      //*******************************
+      /// Packs bit 7 of each byte in to the low 8 bits.
+      //*******************************
+      static uint32_t compress(uint64_t value)
+      {
+        return static_cast<uint32_t>(((value >> 7U) * 0x0102040810204080ULL) >> 56U);
+      }
+
+      uint64_t low;
+      uint64_t high;
+#else
+      const int8_t* p_control;
+#endif
+    };
+
+    //*************************************************************************
+    /// The number of slots for a maximum size.
+    /// A power of 2, no smaller than a group, with a maximum load of 7/8.
+    //*************************************************************************
+    template <size_t Max_Size>
+    struct slot_count
+    {
+      static ETL_CONSTANT size_t Minimum = ((Max_Size * 8U) + 6U) / 7U;
+      static ETL_CONSTANT size_t value   = (Minimum <= group::Size) ? size_t(group::Size) : size_t(etl::power_of_2_round_up<Minimum>::value);
+    };
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t slot_count<Max_Size>::Minimum;
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t slot_count<Max_Size>::value;
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_map.
+  /// Can be used as a reference type for all unordered_flat_map containing a specific type.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+  protected:
+
+    typedef private_unordered_flat_map::group group_t;
+
+  public:
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, T>::value_type value_type;
+      typedef typename iunordered_flat_map::key_type        key_type;
+      typedef typename iunordered_flat_map::mapped_type     mapped_type;
+      typedef typename iunordered_flat_map::hasher          hasher;
+      typedef typename iunordered_flat_map::key_equal       key_equal;
+      typedef typename iunordered_flat_map::reference       reference;
+      typedef typename iunordered_flat_map::const_reference const_reference;
+      typedef typename iunordered_flat_map::pointer         pointer;
+      typedef typename iunordered_flat_map::const_pointer   const_pointer;
+      typedef typename iunordered_flat_map::size_type       size_type;
+
+      friend class iunordered_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : p_control(ETL_NULLPTR)
+        , p_control_end(ETL_NULLPTR)
+        , p_slot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : p_control(other.p_control)
+        , p_control_end(other.p_control_end)
+        , p_slot(other.p_slot)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        ++p_control;
+        ++p_slot;
+        skip_to_full();
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        p_control     = other.p_control;
+        p_control_end = other.p_control_end;
+        p_slot        = other.p_slot;
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return *p_slot;
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return p_slot;
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return p_slot;
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_control == rhs.p_control;
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(const int8_t* p_control_, const int8_t* p_control_end_, pointer p_slot_)
+        : p_control(p_control_)
+        , p_control_end(p_control_end_)
+        , p_slot(p_slot_)
+      {
+      }
+
+      //*********************************
+      void skip_to_full()
+      {
+        while ((p_control != p_control_end) && (*p_control < 0))
+        {
+          ++p_control;
+          ++p_slot;
+        }
+      }
+
+      const int8_t* p_control;
+      const int8_t* p_control_end;
+      pointer       p_slot;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>::value_type value_type;
+      typedef typename iunordered_flat_map::key_type        key_type;
+      typedef typename iunordered_flat_map::mapped_type     mapped_type;
+      typedef typename iunordered_flat_map::hasher          hasher;
+      typedef typename iunordered_flat_map::key_equal       key_equal;
+      typedef typename iunordered_flat_map::reference       reference;
+      typedef typename iunordered_flat_map::const_reference const_reference;
+      typedef typename iunordered_flat_map::pointer         pointer;
+      typedef typename iunordered_flat_map::const_pointer   const_pointer;
+      typedef typename iunordered_flat_map::size_type       size_type;
+
+      friend class iunordered_flat_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : p_control(ETL_NULLPTR)
+        , p_control_end(ETL_NULLPTR)
+        , p_slot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_map::iterator& other)
+        : p_control(other.p_control)
+        , p_control_end(other.p_control_end)
+        , p_slot(other.p_slot)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : p_control(other.p_control)
+        , p_control_end(other.p_control_end)
+        , p_slot(other.p_slot)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        ++p_control;
+        ++p_slot;
+        skip_to_full();
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_control     = other.p_control;
+        p_control_end = other.p_control_end;
+        p_slot        = other.p_slot;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return *p_slot;
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return p_slot;
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return p_slot;
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_control == rhs.p_control;
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const int8_t* p_control_, const int8_t* p_control_end_, const_pointer p_slot_)
+        : p_control(p_control_)
+        , p_control_end(p_control_end_)
+        , p_slot(p_slot_)
+      {
+      }
+
+      //*********************************
+      void skip_to_full()
+      {
+        while ((p_control != p_control_end) && (*p_control < 0))
+        {
+          ++p_control;
+          ++p_slot;
+        }
+      }
+
+      const int8_t* p_control;
+      const int8_t* p_control_end;
+      const_pointer p_slot;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_map.
+    ///\return An iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      iterator itr(p_control, p_control + number_of_slots, p_slots);
+      itr.skip_to_full();
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      const_iterator itr(p_control, p_control + number_of_slots, p_slots);
+      itr.skip_to_full();
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_map.
+    ///\return An iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(p_control + number_of_slots, p_control + number_of_slots, p_slots + number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(p_control + number_of_slots, p_control + number_of_slots, p_slots + number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots in the table.
+    /// Each slot acts as a bucket of one.
+    ///\return The number of slots in the table.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of slots in the table.
+    ///\return The maximum number of slots in the table.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      const size_t hash  = get_hash(key);
+      size_t       index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        // Doesn't exist, so add a new one.
+        ETL_ASSERT(!full(), ETL_ERROR(unordered_flat_map_full));
+
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(p_slots[index])) value_type(etl::move(key), mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return p_slots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      const size_t hash  = get_hash(key);
+      size_t       index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        // Doesn't exist, so add a new one.
+        ETL_ASSERT(!full(), ETL_ERROR(unordered_flat_map_full));
+
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(p_slots[index])) value_type(key, mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return p_slots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      const size_t index = find_index(key, get_hash(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return p_slots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const size_t index = find_index(key, get_hash(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return p_slots[index].second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      const size_t hash  = get_hash(key_value_pair.first);
+      size_t       index = find_index(key_value_pair.first, hash);
+
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result(end(), false);
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(unordered_flat_map_full), result);
+
+      index = prepare_insert(hash);
+      ::new ((void*)etl::addressof(p_slots[index])) value_type(key_value_pair);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      result.first  = make_iterator(index);
+      result.second = true;
+
+      return result;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      const size_t hash  = get_hash(key_value_pair.first);
+      size_t       index = find_index(key_value_pair.first, hash);
+
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result(end(), false);
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(unordered_flat_map_full), result);
+
+      index = prepare_insert(hash);
+      ::new ((void*)etl::addressof(p_slots[index])) value_type(etl::move(key_value_pair));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      result.first  = make_iterator(index);
+      result.second = true;
+
+      return result;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      const size_t index = find_index(key, get_hash(key));
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      erase_slot(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the next element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      const size_t index = static_cast<size_t>(ielement.p_control - p_control);
+
+      erase_slot(index);
+
+      iterator itr = make_iterator(index);
+      itr.skip_to_full();
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing does not move the other elements, so the iterators remain valid.
+      while (first_ != last_)
+      {
+        const size_t index = static_cast<size_t>(first_.p_control - p_control);
+        ++first_;
+        erase_slot(index);
+      }
+
+      return make_iterator(static_cast<size_t>(last_.p_control - p_control));
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key, get_hash(key)) == number_of_slots) ? 0U : 1U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return make_iterator(find_index(key, get_hash(key)));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return make_iterator(find_index(key, get_hash(key)));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator = (const iunordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator = (iunordered_flat_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_flat_map(int8_t* p_control_, value_type* p_slots_, size_t number_of_slots_, size_t maximum_size_, hasher key_hash_function_, key_equal key_equal_function_)
+      : p_control(p_control_)
+      , p_slots(p_slots_)
+      , number_of_slots(number_of_slots_)
+      , maximum_size(maximum_size_)
+      , maximum_load(number_of_slots_ - (number_of_slots_ / 8U))
+      , current_size(0U)
+      , number_deleted(0U)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      reset_control();
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (p_control[i] >= 0)
+          {
+            p_slots[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+      }
+
+      reset_control();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        insert(etl::move(*b));
+        ++b;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Sets all of the control bytes to empty.
+    //*********************************************************************
+    void reset_control()
+    {
+      etl::fill_n(p_control, number_of_slots + group_t::Size - 1U, static_cast<int8_t>(group_t::Empty));
+      current_size   = 0U;
+      number_deleted = 0U;
+    }
+
+    //*********************************************************************
+    /// Gets the mixed hash of a key.
+    //*********************************************************************
+    size_t get_hash(const_key_reference key) const
+    {
+      return private_unordered::mix_hash(key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// The start of the probe sequence.
+    //*********************************************************************
+    size_t get_h1(size_t hash) const
+    {
+      return (hash >> 7U) & (number_of_slots - 1U);
+    }
+
+    //*********************************************************************
+    /// The 7 bit hash stored in the control byte.
+    //*********************************************************************
+    static int8_t get_h2(size_t hash)
+    {
+      return static_cast<int8_t>(hash & 0x7FU);
+    }
+
+    //*********************************************************************
+    /// Sets a control byte.
+    /// The first group of control bytes are duplicated after the last slot, so
+    /// that a group may be loaded from any slot without wrapping.
+    //*********************************************************************
+    void set_control(size_t index, int8_t value)
+    {
+      p_control[index] = value;
+
+      if (index < (group_t::Size - 1U))
+      {
+        p_control[number_of_slots + index] = value;
+      }
+    }
+
+    //*********************************************************************
+    /// Gets an iterator to a slot.
+    //*********************************************************************
+    iterator make_iterator(size_t index)
+    {
+      return iterator(p_control + index, p_control + number_of_slots, p_slots + index);
+    }
+
+    //*********************************************************************
+    /// Gets a const_iterator to a slot.
+    //*********************************************************************
+    const_iterator make_iterator(size_t index) const
+    {
+      return const_iterator(p_control + index, p_control + number_of_slots, p_slots + index);
+    }
+
+    //*********************************************************************
+    /// Finds the slot containing the key.
+    /// Returns number_of_slots if not found.
+    /// Probes a group of slots at a time, stepping by increasing multiples of
+    /// the group size. This visits every group as number_of_slots is a power of 2.
+    //*********************************************************************
+    size_t find_index(const_key_reference key, size_t hash) const
+    {
+      const size_t mask = number_of_slots - 1U;
+      const int8_t h2   = get_h2(hash);
+
+      size_t position = get_h1(hash);
+      size_t step     = 0U;
+
+      while (true)
+      {
+        const group_t group(p_control + position);
+
+        uint32_t matches = group.match(h2);
+
+        while (matches != 0U)
+        {
+          const size_t index = (position + static_cast<size_t>(etl::count_trailing_zeros(matches))) & mask;
+
+          if (key_equal_function(p_slots[index].first, key))
+          {
+            return index;
+          }
+
+          matches &= matches - 1U;
+        }
+
+        if (group.match_empty() != 0U)
+        {
+          return number_of_slots;
+        }
+
+        step    += group_t::Size;
+        position = (position + step) & mask;
+      }
+    }
+
+    //*********************************************************************
+    /// Finds the first empty or deleted slot in the probe sequence for the hash.
+    //*********************************************************************
+    size_t find_first_non_full(size_t hash) const
+    {
+      const size_t mask = number_of_slots - 1U;
+
+      size_t position = get_h1(hash);
+      size_t step     = 0U;
+
+      while (true)
+      {
+        const uint32_t matches = group_t(p_control + position).match_empty_or_deleted();
+
+        if (matches != 0U)
+        {
+          return (position + static_cast<size_t>(etl::count_trailing_zeros(matches))) & mask;
+        }
+
+        step    += group_t::Size;
+        position = (position + step) & mask;
+      }
+    }
+
+    //*********************************************************************
+    /// Finds a slot for a new element and marks it as used.
+    /// If the new element would take the table beyond its maximum load then
+    /// the erased slots are reclaimed first.
+    //*********************************************************************
+    size_t prepare_insert(size_t hash)
+    {
+      size_t index = find_first_non_full(hash);
+
+      if ((p_control[index] == group_t::Empty) && ((current_size + number_deleted) >= maximum_load))
+      {
+        drop_deleted();
+        index = find_first_non_full(hash);
+      }
+
+      if (p_control[index] == group_t::Deleted)
+      {
+        --number_deleted;
+      }
+
+      set_control(index, get_h2(hash));
+      ++current_size;
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Erases the element in a slot.
+    /// The slot can be marked as empty if no probe sequence could have passed
+    /// through it while searching for another element, otherwise it is marked as deleted.
+    //*********************************************************************
+    void erase_slot(size_t index)
+    {
+      const size_t index_before = (index - group_t::Size) & (number_of_slots - 1U);
+
+      const uint32_t empty_after  = group_t(p_control + index).match_empty();
+      const uint32_t empty_before = group_t(p_control + index_before).match_empty();
+
+      // The number of consecutive full or deleted slots that include this one.
+      const bool was_never_full = (empty_before != 0U) &&
+                                  (empty_after  != 0U) &&
+                                  ((static_cast<size_t>(etl::count_trailing_zeros(empty_after)) + static_cast<size_t>(etl::count_leading_zeros(uint16_t(empty_before)))) < group_t::Size);
+
+      p_slots[index].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      if (was_never_full)
+      {
+        set_control(index, group_t::Empty);
+      }
+      else
+      {
+        set_control(index, group_t::Deleted);
+        ++number_deleted;
+      }
+
+      --current_size;
+    }
+
+    //*********************************************************************
+    /// Reclaims the deleted slots by rehashing the elements in place.
+    /// Full slots are first marked as deleted and deleted slots as empty.
+    /// Each element is then moved to the first free slot in its probe sequence.
+    //*********************************************************************
+    void drop_deleted()
+    {
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        p_control[i] = (p_control[i] >= 0) ? group_t::Deleted : group_t::Empty;
+      }
+
+      for (size_t i = 0U; i < (group_t::Size - 1U); ++i)
+      {
+        p_control[number_of_slots + i] = p_control[i];
+      }
+
+      const size_t mask = number_of_slots - 1U;
+
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        if (p_control[i] != group_t::Deleted)
+        {
+          continue;
+        }
+
+        const size_t hash   = get_hash(p_slots[i].first);
+        const size_t target = find_first_non_full(hash);
+        const size_t start  = get_h1(hash);
+        const int8_t h2     = get_h2(hash);
+
+        // Already in the best group?
+        if ((((i - start) & mask) / group_t::Size) == (((target - start) & mask) / group_t::Size))
+        {
+          set_control(i, h2);
+        }
+        else if (p_control[target] == group_t::Empty)
+        {
+          // Move to the empty slot.
+          ::new ((void*)etl::addressof(p_slots[target])) value_type(ETL_MOVE(p_slots[i]));
+          p_slots[i].~value_type();
+          set_control(target, h2);
+          set_control(i, group_t::Empty);
+        }
+        else
+        {
+          // The target holds an element not yet processed. Swap and process this slot again.
+          typename etl::aligned_storage<sizeof(value_type), etl::alignment_of<value_type>::value>::type temp_buffer;
+          value_type* p_temp = reinterpret_cast<value_type*>(&temp_buffer);
+
+          ::new ((void*)p_temp) value_type(ETL_MOVE(p_slots[i]));
+          p_slots[i].~value_type();
+          ::new ((void*)etl::addressof(p_slots[i])) value_type(ETL_MOVE(p_slots[target]));
+          p_slots[target].~value_type();
+          ::new ((void*)etl::addressof(p_slots[target])) value_type(ETL_MOVE(*p_temp));
+          p_temp->~value_type();
+
+          set_control(target, h2);
+          --i;
+        }
+      }
+
+      number_deleted = 0U;
+    }
+
+    // Disable copy construction.
+    iunordered_flat_map(const iunordered_flat_map&);
+
+    /// The control bytes.
+    int8_t* p_control;
+
+    /// The slots.
+    value_type* p_slots;
+
+    /// The number of slots. Always a power of 2.
+    const size_t number_of_slots;
+
+    /// The maximum number of elements.
+    const size_t maximum_size;
+
+    /// The maximum number of full and deleted slots.
+    const size_t maximum_load;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// The number of deleted slots.
+    size_t number_deleted;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunordered_flat_map()
+    {
+    }
+#else
+  protected:
+    ~iunordered_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the containers are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+
+    itr_t l_begin = lhs.begin();
+    itr_t l_end   = lhs.end();
+
+    while (l_begin != l_end)
+    {
+      // See if the lhs key exists in the rhs.
+      itr_t r_itr = rhs.find(l_begin->first);
+
+      if ((r_itr == rhs.end()) || !(r_itr->second == l_begin->second))
+      {
+        return false;
+      }
+
+      ++l_begin;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the containers are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_SLOTS = private_unordered_flat_map::slot_count<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map(const unordered_flat_map& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_map(unordered_flat_map&& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator = (const unordered_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator = (unordered_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The control bytes, with a copy of the first group appended.
+    int8_t control[MAX_SLOTS + private_unordered_flat_map::group::Size - 1U];
+
+    /// The slots that store the elements.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * MAX_SLOTS, etl::alignment_of<typename base::value_type>::value>::type slots;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SLOTS;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  unordered_flat_map(TPairs...) -> unordered_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                      typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                      sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_unordered_flat_map(TPairs&&... pairs) -> etl::unordered_flat_map<TKey, T, sizeof...(TPairs), THash, TKeyEqual>
+  {
+    return { etl::forward<TPairs>(pairs)... };
+  }
+#endif
+}
+
+#endif
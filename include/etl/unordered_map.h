@@ -51,6 +51,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "private/unordered_bucket_policy.h"
 
 #include <stddef.h>
 
@@ -122,7 +123,7 @@ namespace etl
   /// Can be used as a reference type for all unordered_map containing a specific type.
   ///\ingroup unordered_map
   //***************************************************************************
-  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TBucketPolicy = etl::unordered_bucket_modulo>
   class iunordered_map
   {
   public:
@@ -596,7 +597,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(const_key_reference key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return TBucketPolicy::get_bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -605,7 +606,7 @@ namespace etl
     //*********************************************************************
     size_type bucket_size(const_key_reference key) const
     {
-      size_t index = bucket(key);
+      size_t index = get_bucket_index(key);
 
       return etl::distance(pbuckets[index].begin(), pbuckets[index].end());
     }
@@ -1569,14 +1570,14 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_map
   //***************************************************************************
-  template <typename TKey, typename T, typename THash, typename TKeyEqual>
-  bool operator ==(const etl::iunordered_map<TKey, T, THash, TKeyEqual>& lhs, 
-                   const etl::iunordered_map<TKey, T, THash, TKeyEqual>& rhs)
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  bool operator ==(const etl::iunordered_map<TKey, T, THash, TKeyEqual, TBucketPolicy>& lhs, 
+                   const etl::iunordered_map<TKey, T, THash, TKeyEqual, TBucketPolicy>& rhs)
   {
     const bool sizes_match = (lhs.size() == rhs.size());
     bool elements_match = true;
 
-    typedef typename etl::iunordered_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+    typedef typename etl::iunordered_map<TKey, T, THash, TKeyEqual, TBucketPolicy>::const_iterator itr_t;
     
     if (sizes_match)
     {
@@ -1617,9 +1618,9 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_map
   //***************************************************************************
-  template <typename TKey, typename T, typename THash, typename TKeyEqual>
-  bool operator !=(const etl::iunordered_map<TKey, T, THash, TKeyEqual>& lhs, 
-                   const etl::iunordered_map<TKey, T, THash, TKeyEqual>& rhs)
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  bool operator !=(const etl::iunordered_map<TKey, T, THash, TKeyEqual, TBucketPolicy>& lhs, 
+                   const etl::iunordered_map<TKey, T, THash, TKeyEqual, TBucketPolicy>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1627,23 +1628,23 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_map implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_map : public etl::iunordered_map<TKey, TValue, THash, TKeyEqual>
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TBucketPolicy = etl::unordered_bucket_modulo>
+  class unordered_map : public etl::iunordered_map<TKey, TValue, THash, TKeyEqual, TBucketPolicy>
   {
   private:
 
-    typedef iunordered_map<TKey, TValue, THash, TKeyEqual> base;
+    typedef iunordered_map<TKey, TValue, THash, TKeyEqual, TBucketPolicy> base;
 
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = TBucketPolicy::template bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
     }
 
@@ -1651,7 +1652,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_map(const unordered_map& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
     {
       base::assign(other.cbegin(), other.cend());
     }
@@ -1661,7 +1662,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_map(unordered_map&& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
     {
       if (this != &other)
       {
@@ -1678,7 +1679,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(first_, last_);
     }
@@ -1688,7 +1689,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1728,9 +1729,15 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  ETL_CONSTANT size_t unordered_map<TKey, TValue, MAX_SIZE_, MAX_BUCKETS_, THash, TKeyEqual, TBucketPolicy>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  ETL_CONSTANT size_t unordered_map<TKey, TValue, MAX_SIZE_, MAX_BUCKETS_, THash, TKeyEqual, TBucketPolicy>::MAX_BUCKETS;
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
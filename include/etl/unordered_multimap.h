@@ -51,6 +51,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "private/unordered_bucket_policy.h"
 
 #include <stddef.h>
 
@@ -122,7 +123,7 @@ namespace etl
   /// Can be used as a reference type for all unordered_multimap containing a specific type.
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TBucketPolicy = etl::unordered_bucket_modulo>
   class iunordered_multimap
   {
   public:
@@ -594,7 +595,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(const_key_reference key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return TBucketPolicy::get_bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -603,7 +604,7 @@ namespace etl
     //*********************************************************************
     size_type bucket_size(const_key_reference key) const
     {
-      size_t index = bucket(key);
+      size_t index = get_bucket_index(key);
 
       return etl::distance(pbuckets[index].begin(), pbuckets[index].end());
     }
@@ -1423,14 +1424,14 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename T, typename THash, typename TKeyEqual>
-  bool operator ==(const etl::iunordered_multimap<TKey, T, THash, TKeyEqual>& lhs, 
-                   const etl::iunordered_multimap<TKey, T, THash, TKeyEqual>& rhs)
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  bool operator ==(const etl::iunordered_multimap<TKey, T, THash, TKeyEqual, TBucketPolicy>& lhs, 
+                   const etl::iunordered_multimap<TKey, T, THash, TKeyEqual, TBucketPolicy>& rhs)
   {
     const bool sizes_match = (lhs.size() == rhs.size());
     bool elements_match = true;
 
-    typedef typename etl::iunordered_multimap<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+    typedef typename etl::iunordered_multimap<TKey, T, THash, TKeyEqual, TBucketPolicy>::const_iterator itr_t;
 
     if (sizes_match)
     {
@@ -1439,8 +1440,7 @@ namespace etl
 
       while ((l_begin != l_end) && elements_match)
       {
-        const TKey key     = l_begin->first;
-        const T    l_value = l_begin->second;
+        const TKey key = l_begin->first;
 
         // See if the lhs keys exist in the rhs.
         ETL_OR_STD::pair<itr_t, itr_t> l_range = lhs.equal_range(key);
@@ -1478,9 +1478,9 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename T, typename THash, typename TKeyEqual>
-  bool operator !=(const etl::iunordered_multimap<TKey, T, THash, TKeyEqual>& lhs, 
-                   const etl::iunordered_multimap<TKey, T, THash, TKeyEqual>& rhs)
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  bool operator !=(const etl::iunordered_multimap<TKey, T, THash, TKeyEqual, TBucketPolicy>& lhs, 
+                   const etl::iunordered_multimap<TKey, T, THash, TKeyEqual, TBucketPolicy>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1488,17 +1488,17 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_multimap implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_multimap : public etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual>
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TBucketPolicy = etl::unordered_bucket_modulo>
+  class unordered_multimap : public etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual, TBucketPolicy>
   {
   private:
 
-    typedef etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual> base;
+    typedef etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual, TBucketPolicy> base;
 
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = TBucketPolicy::template bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
@@ -1554,7 +1554,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_multimap(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1596,9 +1596,15 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  ETL_CONSTANT size_t unordered_multimap<TKey, TValue, MAX_SIZE_, MAX_BUCKETS_, THash, TKeyEqual, TBucketPolicy>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  ETL_CONSTANT size_t unordered_multimap<TKey, TValue, MAX_SIZE_, MAX_BUCKETS_, THash, TKeyEqual, TBucketPolicy>::MAX_BUCKETS;
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
@@ -50,6 +50,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "private/unordered_bucket_policy.h"
 
 #include <stddef.h>
 
@@ -121,7 +122,7 @@ namespace etl
   /// Can be used as a reference type for all unordered_multiset containing a specific type.
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TBucketPolicy = etl::unordered_bucket_modulo>
   class iunordered_multiset
   {
   public:
@@ -585,7 +586,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return TBucketPolicy::get_bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -594,7 +595,7 @@ namespace etl
     //*********************************************************************
     size_type bucket_size(key_parameter_t key) const
     {
-      size_t index = bucket(key);
+      size_t index = get_bucket_index(key);
 
       return etl::distance(pbuckets[index].begin(), pbuckets[index].end());
     }
@@ -1401,14 +1402,14 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename THash, typename TKeyEqual>
-  bool operator ==(const etl::iunordered_multiset<TKey, THash, TKeyEqual>& lhs, 
-                   const etl::iunordered_multiset<TKey, THash, TKeyEqual>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  bool operator ==(const etl::iunordered_multiset<TKey, THash, TKeyEqual, TBucketPolicy>& lhs, 
+                   const etl::iunordered_multiset<TKey, THash, TKeyEqual, TBucketPolicy>& rhs)
   {
     const bool sizes_match = (lhs.size() == rhs.size());
     bool elements_match = true;
 
-    typedef typename etl::iunordered_multiset<TKey, THash, TKeyEqual>::const_iterator itr_t;
+    typedef typename etl::iunordered_multiset<TKey, THash, TKeyEqual, TBucketPolicy>::const_iterator itr_t;
 
     if (sizes_match)
     {
@@ -1455,9 +1456,9 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename THash, typename TKeyEqual>
-  bool operator !=(const etl::iunordered_multiset<TKey, THash, TKeyEqual>& lhs, 
-                   const etl::iunordered_multiset<TKey, THash, TKeyEqual>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  bool operator !=(const etl::iunordered_multiset<TKey, THash, TKeyEqual, TBucketPolicy>& lhs, 
+                   const etl::iunordered_multiset<TKey, THash, TKeyEqual, TBucketPolicy>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1465,17 +1466,17 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_multiset implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_multiset : public etl::iunordered_multiset<TKey, THash, TKeyEqual>
+  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TBucketPolicy = etl::unordered_bucket_modulo>
+  class unordered_multiset : public etl::iunordered_multiset<TKey, THash, TKeyEqual, TBucketPolicy>
   {
   private:
 
-    typedef etl::iunordered_multiset<TKey, THash, TKeyEqual> base;
+    typedef etl::iunordered_multiset<TKey, THash, TKeyEqual, TBucketPolicy> base;
 
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = TBucketPolicy::template bucket_count<MAX_BUCKETS_>::value;
 
 
     //*************************************************************************
@@ -1575,9 +1576,15 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
+  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  ETL_CONSTANT size_t unordered_multiset<TKey, MAX_SIZE_, MAX_BUCKETS_, THash, TKeyEqual, TBucketPolicy>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_, typename THash, typename TKeyEqual, typename TBucketPolicy>
+  ETL_CONSTANT size_t unordered_multiset<TKey, MAX_SIZE_, MAX_BUCKETS_, THash, TKeyEqual, TBucketPolicy>::MAX_BUCKETS;
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
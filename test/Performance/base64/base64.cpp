@@ -0,0 +1,172 @@
+//*****************************************************************************
+// Benchmark of the etl::base64 encoders and decoders.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include base64.cpp -o base64
+//
+// Encodes and decodes a block of random data, one value at a time and as a
+// range, with and without a callback, reporting MB/s of unencoded data.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <vector>
+
+#include "etl/base64_encoder.h"
+#include "etl/base64_decoder.h"
+#include "etl/span.h"
+
+static const size_t SIZE   = 48UL * 1024UL;
+static const size_t ROUNDS = 200UL;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double mb_per_s(size_t n) const
+  {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (double(n) / 1.0E6) / elapsed.count();
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+volatile size_t sink;
+
+void encoded_callback(const etl::span<const char>& s)
+{
+  sink = sink + s.size();
+}
+
+void decoded_callback(const etl::span<const unsigned char>& s)
+{
+  sink = sink + s.size();
+}
+
+//*****************************************************************************
+template <template <size_t> class TEncoder, template <size_t> class TDecoder>
+void run(const char* name)
+{
+  typedef TEncoder<((SIZE + 2U) / 3U) * 4U> encoder_type;
+  typedef TDecoder<SIZE>                    decoder_type;
+  typedef TEncoder<1024U>                   streaming_encoder_type;
+  typedef TDecoder<768U>                    streaming_decoder_type;
+
+  std::vector<unsigned char> data(SIZE);
+
+  uint32_t seed = 12345UL;
+
+  for (size_t i = 0U; i < SIZE; ++i)
+  {
+    seed = (seed * 1103515245UL) + 12345UL;
+    data[i] = static_cast<unsigned char>(seed >> 16U);
+  }
+
+  // Whole buffers, no callback.
+  static encoder_type encoder;
+  static decoder_type decoder;
+
+  encoder.encode_final(data.begin(), data.end());
+  std::vector<char> text(encoder.begin(), encoder.end());
+
+  Timer encode_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    encoder.restart();
+    encoder.encode_final(data.data(), data.size());
+    sink = encoder.size();
+  }
+
+  double encode_range = encode_timer.mb_per_s(SIZE * ROUNDS);
+
+  Timer encode_char_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    encoder.restart();
+
+    for (size_t i = 0U; i < data.size(); ++i)
+    {
+      encoder.encode(data[i]);
+    }
+
+    encoder.flush();
+    sink = encoder.size();
+  }
+
+  double encode_char = encode_char_timer.mb_per_s(SIZE * ROUNDS);
+
+  Timer decode_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    decoder.restart();
+    decoder.decode_final(text.data(), text.size());
+    sink = decoder.size();
+  }
+
+  double decode_range = decode_timer.mb_per_s(SIZE * ROUNDS);
+
+  Timer decode_char_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    decoder.restart();
+
+    for (size_t i = 0U; i < text.size(); ++i)
+    {
+      decoder.decode(text[i]);
+    }
+
+    decoder.flush();
+    sink = decoder.size();
+  }
+
+  double decode_char = decode_char_timer.mb_per_s(SIZE * ROUNDS);
+
+  // Streamed through a 1K callback buffer.
+  static streaming_encoder_type streaming_encoder(streaming_encoder_type::callback_type::template create<encoded_callback>());
+  static streaming_decoder_type streaming_decoder(streaming_decoder_type::callback_type::template create<decoded_callback>());
+
+  Timer encode_stream_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    streaming_encoder.encode_final(data.data(), data.size());
+  }
+
+  double encode_stream = encode_stream_timer.mb_per_s(SIZE * ROUNDS);
+
+  Timer decode_stream_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    streaming_decoder.decode_final(text.data(), text.size());
+  }
+
+  double decode_stream = decode_stream_timer.mb_per_s(SIZE * ROUNDS);
+
+  printf("%-26s encode %7.1f (char %6.1f, stream %7.1f)   decode %7.1f (char %6.1f, stream %7.1f) MB/s\n",
+         name, encode_range, encode_char, encode_stream, decode_range, decode_char, decode_stream);
+}
+
+//*****************************************************************************
+int main()
+{
+  run<etl::base64_rfc2152_encoder,             etl::base64_rfc2152_decoder>("rfc2152");
+  run<etl::base64_rfc3501_encoder,             etl::base64_rfc3501_decoder>("rfc3501");
+  run<etl::base64_rfc4648_encoder,             etl::base64_rfc4648_decoder>("rfc4648");
+  run<etl::base64_rfc4648_padding_encoder,     etl::base64_rfc4648_padding_decoder>("rfc4648_padding");
+  run<etl::base64_rfc4648_url_encoder,         etl::base64_rfc4648_url_decoder>("rfc4648_url");
+  run<etl::base64_rfc4648_url_padding_encoder, etl::base64_rfc4648_url_padding_decoder>("rfc4648_url_padding");
+
+  return 0;
+}
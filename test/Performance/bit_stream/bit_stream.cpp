@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Benchmark of etl::bit_stream_writer and etl::bit_stream_reader.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include bit_stream.cpp -o bit_stream
+//
+// Writes and reads fields of mixed and fixed widths, in both endiannesses,
+// reporting nanoseconds per field.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "etl/bit_stream.h"
+#include "etl/span.h"
+
+static const size_t SIZE   = 100000UL;
+static const size_t ROUNDS = 20UL;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double ns_per(size_t n) const
+  {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / double(n);
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+volatile uint64_t sink;
+
+//*****************************************************************************
+void run(const char* name, etl::endian endianness, std::vector<char>& buffer, const std::vector<uint64_t>& values, const std::vector<uint_least8_t>& widths)
+{
+  size_t used = 0U;
+
+  Timer write_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::bit_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      writer.write_unchecked(values[i], widths[i]);
+    }
+
+    used = writer.used_data().size();
+  }
+
+  double write_ns = write_timer.ns_per(values.size() * ROUNDS);
+
+  Timer read_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::bit_stream_reader reader(buffer.data(), used, endianness);
+    uint64_t sum = 0U;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      sum += reader.read_unchecked<uint64_t>(widths[i]);
+    }
+
+    sink = sum;
+  }
+
+  double read_ns = read_timer.ns_per(values.size() * ROUNDS);
+
+  printf("%-24s %-6s write %6.2f ns  read %6.2f ns\n", name, (endianness == etl::endian::big) ? "big" : "little", write_ns, read_ns);
+}
+
+//*****************************************************************************
+void run_span(etl::endian endianness, std::vector<char>& buffer, const std::vector<uint16_t>& values)
+{
+  std::vector<uint16_t> results(values.size());
+
+  Timer write_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::bit_stream_writer writer(buffer.data(), buffer.size(), endianness);
+    writer.write(etl::span<const uint16_t>(values.data(), values.size()), 12U);
+  }
+
+  double write_ns = write_timer.ns_per(values.size() * ROUNDS);
+
+  Timer read_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::bit_stream_reader reader(buffer.data(), buffer.size(), endianness);
+    reader.read(etl::span<uint16_t>(results.data(), results.size()), 12U);
+    sink = results[round];
+  }
+
+  double read_ns = read_timer.ns_per(values.size() * ROUNDS);
+
+  printf("%-24s %-6s write %6.2f ns  read %6.2f ns\n", "span 12 bit", (endianness == etl::endian::big) ? "big" : "little", write_ns, read_ns);
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937_64 generator(1);
+
+  std::vector<uint64_t>      values(SIZE);
+  std::vector<uint16_t>      shorts(SIZE);
+  std::vector<uint_least8_t> mixed(SIZE);
+  std::vector<uint_least8_t> five(SIZE, 5U);
+  std::vector<uint_least8_t> sixty_four(SIZE, 64U);
+
+  for (size_t i = 0U; i < SIZE; ++i)
+  {
+    values[i] = generator();
+    shorts[i] = uint16_t(values[i]);
+    mixed[i]  = uint_least8_t(1U + (values[i] >> 58));
+  }
+
+  std::vector<char> buffer((SIZE * 64U) / CHAR_BIT);
+
+  const etl::endian endiannesses[] = { etl::endian::big, etl::endian::little };
+
+  for (size_t e = 0U; e < 2U; ++e)
+  {
+    run("mixed 1 to 64 bits", endiannesses[e], buffer, values, mixed);
+    run("5 bits",             endiannesses[e], buffer, values, five);
+    run("64 bits",            endiannesses[e], buffer, values, sixty_four);
+    run_span(endiannesses[e], buffer, shorts);
+  }
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+//*****************************************************************************
+// Benchmark of etl::btree_map against the red/black tree etl::map.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include btree_map.cpp -o btree_map
+//
+// For each container the time for random inserts, random finds, a full in
+// order scan and random erases is reported in nanoseconds per element.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "etl/btree_map.h"
+#include "etl/map.h"
+
+static const size_t SIZE   = 100000UL;
+static const size_t ROUNDS = 5UL;
+
+typedef etl::map<uint32_t, uint32_t, SIZE>       Map;
+typedef etl::btree_map<uint32_t, uint32_t, SIZE> BTreeMap;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double ns_per(size_t n) const
+  {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / double(n);
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+//*****************************************************************************
+template <typename TMap>
+void run(const char* name, TMap& map, const std::vector<uint32_t>& keys, const std::vector<uint32_t>& lookups)
+{
+  double insert_ns = 0.0;
+  double find_ns   = 0.0;
+  double scan_ns   = 0.0;
+  double erase_ns  = 0.0;
+
+  volatile uint32_t sink = 0U;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    {
+      Timer timer;
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        map.insert(typename TMap::value_type(keys[i], uint32_t(i)));
+      }
+
+      insert_ns += timer.ns_per(keys.size());
+    }
+
+    {
+      Timer timer;
+      uint32_t sum = 0U;
+
+      for (size_t i = 0U; i < lookups.size(); ++i)
+      {
+        typename TMap::const_iterator itr = map.find(lookups[i]);
+        sum += itr->second;
+      }
+
+      find_ns += timer.ns_per(lookups.size());
+      sink = sink + sum;
+    }
+
+    {
+      Timer timer;
+      uint32_t sum = 0U;
+
+      for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        sum += itr->second;
+      }
+
+      scan_ns += timer.ns_per(map.size());
+      sink = sink + sum;
+    }
+
+    {
+      Timer timer;
+
+      for (size_t i = 0U; i < lookups.size(); ++i)
+      {
+        map.erase(lookups[i]);
+      }
+
+      erase_ns += timer.ns_per(lookups.size());
+    }
+  }
+
+  printf("%-10s insert %7.1f  find %7.1f  scan %6.2f  erase %7.1f  ns/element\n",
+         name, insert_ns / ROUNDS, find_ns / ROUNDS, scan_ns / ROUNDS, erase_ns / ROUNDS);
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 generator(1U);
+
+  std::vector<uint32_t> keys(SIZE);
+
+  for (size_t i = 0U; i < SIZE; ++i)
+  {
+    keys[i] = uint32_t(i * 7U);
+  }
+
+  std::shuffle(keys.begin(), keys.end(), generator);
+
+  std::vector<uint32_t> lookups(keys);
+  std::shuffle(lookups.begin(), lookups.end(), generator);
+
+  static Map      map;
+  static BTreeMap btree_map;
+
+  printf("%u elements, %u rounds\n", unsigned(SIZE), unsigned(ROUNDS));
+
+  run("map", map, keys, lookups);
+  run("btree_map", btree_map, keys, lookups);
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Benchmark of etl::byte_stream_writer and etl::byte_stream_reader.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include byte_stream.cpp -o byte_stream
+//
+// Writes and reads arrays of values, one at a time and as a single span, in
+// native and swapped byte order, reporting nanoseconds per value.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <vector>
+
+#include "etl/byte_stream.h"
+#include "etl/endianness.h"
+#include "etl/span.h"
+
+static const size_t SIZE   = 4096UL;
+static const size_t ROUNDS = 1000UL;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double ns_per(size_t n) const
+  {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / double(n);
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+volatile uint64_t sink;
+
+//*****************************************************************************
+template <typename T>
+void run(const char* name, etl::endian endianness)
+{
+  std::vector<T>    values(SIZE);
+  std::vector<T>    results(SIZE);
+  std::vector<char> buffer(SIZE * sizeof(T));
+
+  for (size_t i = 0U; i < SIZE; ++i)
+  {
+    values[i] = T(i * 2654435761UL);
+  }
+
+  Timer write_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::byte_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      writer.write_unchecked(values[i]);
+    }
+  }
+
+  double write_ns = write_timer.ns_per(SIZE * ROUNDS);
+
+  Timer write_span_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::byte_stream_writer writer(buffer.data(), buffer.size(), endianness);
+    writer.write_unchecked(etl::span<T>(values.data(), values.size()));
+  }
+
+  double write_span_ns = write_span_timer.ns_per(SIZE * ROUNDS);
+
+  Timer read_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::byte_stream_reader reader(buffer.data(), buffer.size(), endianness);
+    T sum = T(0);
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      sum += reader.read_unchecked<T>();
+    }
+
+    sink = uint64_t(sum);
+  }
+
+  double read_ns = read_timer.ns_per(SIZE * ROUNDS);
+
+  Timer read_span_timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    etl::byte_stream_reader reader(buffer.data(), buffer.size(), endianness);
+    reader.read_unchecked<T>(etl::span<T>(results.data(), results.size()));
+    sink = uint64_t(results[round % SIZE]);
+  }
+
+  double read_span_ns = read_span_timer.ns_per(SIZE * ROUNDS);
+
+  const char* order = (endianness == etl::endianness::value()) ? "native" : "swapped";
+
+  printf("%-8s %-7s write %5.2f ns  span %5.2f ns  read %5.2f ns  span %5.2f ns\n", name, order, write_ns, write_span_ns, read_ns, read_span_ns);
+}
+
+//*****************************************************************************
+int main()
+{
+  const etl::endian endiannesses[] = { etl::endian::little, etl::endian::big };
+
+  for (size_t e = 0U; e < 2U; ++e)
+  {
+    run<uint16_t>("uint16_t", endiannesses[e]);
+    run<int32_t>("int32_t",   endiannesses[e]);
+    run<uint64_t>("uint64_t", endiannesses[e]);
+    run<double>("double",     endiannesses[e]);
+  }
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Range benchmark for etl::histogram and etl::sparse_histogram.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include histogram.cpp -o histogram
+//
+// SAMPLES keys are counted REPEATS times, once by adding the keys one at a
+// time and once by adding the whole range. 'skewed' keys are mostly the same
+// value, as in a latency distribution, and 'uniform' keys are spread evenly.
+// The best time of RUNS is reported, followed by the cost of merging
+// per-thread histograms and of a percentile query.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <vector>
+
+#include "etl/histogram.h"
+
+static const size_t SAMPLES = 65536UL;
+static const size_t REPEATS = 100UL;
+static const size_t BINS    = 64UL;
+static const int    RUNS    = 5;
+
+typedef etl::histogram<uint8_t, uint32_t, BINS, 0>     Histogram;
+typedef etl::sparse_histogram<uint32_t, uint32_t, BINS> SparseHistogram;
+
+//*****************************************************************************
+template <typename TFunction>
+static double time_best(TFunction function)
+{
+  double best = 1e30;
+
+  for (int run = 0; run < RUNS; ++run)
+  {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (ms < best)
+    {
+      best = ms;
+    }
+  }
+
+  return best;
+}
+
+//*****************************************************************************
+template <typename THistogram, typename TKey>
+static void run(const char* name, const std::vector<TKey>& keys)
+{
+  volatile size_t sink = 0U;
+
+  double single = time_best([&]()
+  {
+    THistogram histogram;
+
+    for (size_t r = 0UL; r < REPEATS; ++r)
+    {
+      for (size_t i = 0UL; i < keys.size(); ++i)
+      {
+        histogram.add(keys[i]);
+      }
+    }
+
+    sink = histogram.count();
+  });
+
+  double range = time_best([&]()
+  {
+    THistogram histogram;
+
+    for (size_t r = 0UL; r < REPEATS; ++r)
+    {
+      histogram.add(keys.begin(), keys.end());
+    }
+
+    sink = histogram.count();
+  });
+
+  printf("%-24s single %7.2f ms   range %7.2f ms\n", name, single, range);
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<uint8_t>  skewed(SAMPLES);
+  std::vector<uint8_t>  uniform(SAMPLES);
+  std::vector<uint32_t> skewed_sparse(SAMPLES);
+
+  uint32_t random = 12345U;
+
+  for (size_t i = 0UL; i < SAMPLES; ++i)
+  {
+    random = (random * 1664525U) + 1013904223U;
+
+    skewed[i]        = uint8_t((((random >> 24) % 4U) == 0U) ? ((random >> 8) % BINS) : 5U);
+    uniform[i]       = uint8_t((random >> 8) % BINS);
+    skewed_sparse[i] = uint32_t(skewed[i]) * 1000U;
+  }
+
+  run<Histogram>("histogram skewed", skewed);
+  run<Histogram>("histogram uniform", uniform);
+  run<SparseHistogram>("sparse_histogram skewed", skewed_sparse);
+
+  // Merge eight per-thread histograms and query the 99th percentile.
+  Histogram parts[8];
+
+  for (size_t p = 0UL; p < 8UL; ++p)
+  {
+    parts[p].add(skewed.begin() + (p * (SAMPLES / 8UL)), skewed.begin() + ((p + 1UL) * (SAMPLES / 8UL)));
+  }
+
+  volatile uint32_t sink = 0U;
+
+  double merge = time_best([&]()
+  {
+    for (size_t r = 0UL; r < 10000UL; ++r)
+    {
+      Histogram total;
+
+      for (size_t p = 0UL; p < 8UL; ++p)
+      {
+        total += parts[p];
+      }
+
+      sink = total.percentile(99.0);
+    }
+  });
+
+  printf("merge 8 + percentile     %7.3f us\n", merge * 1000.0 / 10000.0);
+
+  return 0;
+}
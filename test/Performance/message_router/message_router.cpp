@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Micro-benchmark for etl::message_router::receive across router sizes.
+//
+// Build and run with and without the dispatch table (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include message_router.cpp -o message_router_table
+//   g++ -std=c++17 -O2 -I../../../include -DETL_MESSAGE_ROUTER_DISABLE_DISPATCH_TABLE message_router.cpp -o message_router_fold
+//
+// Each router handles N message types with consecutive ids.
+// The messages are received through an etl::imessage_router reference in a
+// pseudo random order, so that the id is not known at compile time.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "etl/message_router.h"
+
+static const size_t ITERATIONS = 20000000UL;
+
+//*****************************************************************************
+template <etl::message_id_t Id>
+struct Message : public etl::message<Id>
+{
+};
+
+//*****************************************************************************
+template <typename TIndices>
+class Router;
+
+template <size_t... Index>
+class Router<std::index_sequence<Index...>>
+  : public etl::message_router<Router<std::index_sequence<Index...>>, Message<etl::message_id_t(Index)>...>
+{
+public:
+
+  template <etl::message_id_t Id>
+  void on_receive(const Message<Id>&)
+  {
+    sum += Id;
+  }
+
+  void on_receive_unknown(const etl::imessage&)
+  {
+  }
+
+  uint64_t sum = 0U;
+};
+
+//*****************************************************************************
+template <size_t... Index>
+std::vector<const etl::imessage*> make_messages(std::index_sequence<Index...>)
+{
+  static const std::tuple<Message<etl::message_id_t(Index)>...> messages;
+  static const etl::imessage* pointers[] = { &std::get<Index>(messages)... };
+
+  std::vector<const etl::imessage*> result;
+  uint32_t seed = 12345U;
+
+  for (size_t i = 0U; i < 4096U; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    result.push_back(pointers[(seed >> 16U) % sizeof...(Index)]);
+  }
+
+  return result;
+}
+
+//*****************************************************************************
+template <size_t N>
+void run()
+{
+  typedef std::make_index_sequence<N> indices;
+
+  static Router<indices> router;
+  etl::imessage_router& irouter = router;
+
+  std::vector<const etl::imessage*> messages = make_messages(indices());
+
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+  for (size_t i = 0U; i < ITERATIONS; ++i)
+  {
+    irouter.receive(*messages[i & 4095U]);
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(end - begin).count() / ITERATIONS;
+
+  printf("%5u types : %6.2f ns/message (%llu)\n", unsigned(N), ns, static_cast<unsigned long long>(router.sum));
+}
+
+//*****************************************************************************
+int main()
+{
+  run<4>();
+  run<8>();
+  run<16>();
+  run<32>();
+  run<64>();
+
+  return 0;
+}
@@ -0,0 +1,192 @@
+//*****************************************************************************
+// Multi-threaded allocate/release benchmark for etl::pool_atomic, with and
+// without etl::pool_atomic_cache, against etl::pool guarded by a mutex.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -pthread -I../../../include pool_atomic.cpp -o pool_atomic
+//
+// For each thread count, every thread repeatedly allocates HELD items and
+// then releases them, until TOTAL_OPERATIONS allocations have been made in
+// all. The time taken is reported.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "etl/pool.h"
+#include "etl/pool_atomic.h"
+
+static const size_t MAX_THREADS      = 32UL;
+static const size_t HELD             = 16UL;
+static const size_t CACHE_SIZE       = 32UL;
+static const size_t POOL_SIZE        = MAX_THREADS * (HELD + CACHE_SIZE);
+static const size_t TOTAL_OPERATIONS = 8000000UL;
+
+struct Item
+{
+  uint32_t data[4];
+};
+
+//*****************************************************************************
+// etl::pool with a mutex around every call.
+//*****************************************************************************
+struct MutexPool
+{
+  struct Thread
+  {
+    Thread(MutexPool& owner_)
+      : owner(owner_)
+    {
+    }
+
+    Item* allocate()
+    {
+      std::lock_guard<std::mutex> lock(owner.mutex);
+      return owner.pool.allocate();
+    }
+
+    void release(Item* p)
+    {
+      std::lock_guard<std::mutex> lock(owner.mutex);
+      owner.pool.release(p);
+    }
+
+    MutexPool& owner;
+  };
+
+  etl::pool<Item, POOL_SIZE> pool;
+  std::mutex                 mutex;
+};
+
+//*****************************************************************************
+// etl::pool_atomic, used directly by every thread.
+//*****************************************************************************
+struct AtomicPool
+{
+  struct Thread
+  {
+    Thread(AtomicPool& owner_)
+      : owner(owner_)
+    {
+    }
+
+    Item* allocate()
+    {
+      return owner.pool.allocate();
+    }
+
+    void release(Item* p)
+    {
+      owner.pool.release(p);
+    }
+
+    AtomicPool& owner;
+  };
+
+  etl::pool_atomic<Item, POOL_SIZE> pool;
+};
+
+//*****************************************************************************
+// etl::pool_atomic, used through a cache per thread.
+//*****************************************************************************
+struct CachedPool
+{
+  struct Thread
+  {
+    Thread(CachedPool& owner_)
+      : cache(owner_.pool)
+    {
+    }
+
+    Item* allocate()
+    {
+      return cache.allocate<Item>();
+    }
+
+    void release(Item* p)
+    {
+      cache.release(p);
+    }
+
+    etl::pool_atomic_cache<CACHE_SIZE> cache;
+  };
+
+  etl::pool_atomic<Item, POOL_SIZE> pool;
+};
+
+//*****************************************************************************
+template <typename TPool>
+double run(TPool& pool, size_t n_threads)
+{
+  const size_t rounds = TOTAL_OPERATIONS / (n_threads * HELD);
+
+  std::atomic<bool> start(false);
+
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0U; t < n_threads; ++t)
+  {
+    threads.push_back(std::thread([&]()
+    {
+      typename TPool::Thread user(pool);
+      Item* held[HELD];
+
+      while (!start.load()) {}
+
+      for (size_t r = 0U; r < rounds; ++r)
+      {
+        for (size_t h = 0U; h < HELD; ++h)
+        {
+          held[h] = user.allocate();
+          held[h]->data[0] = uint32_t(h);
+        }
+
+        for (size_t h = 0U; h < HELD; ++h)
+        {
+          user.release(held[h]);
+        }
+      }
+    }));
+  }
+
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  start.store(true);
+
+  for (size_t t = 0U; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+//*****************************************************************************
+int main()
+{
+  static MutexPool  mutex_pool;
+  static AtomicPool atomic_pool;
+  static CachedPool cached_pool;
+
+  const size_t thread_counts[] = { 1U, 2U, 4U, 8U, 16U, 32U };
+
+  printf("Threads   Mutex(ms)   Atomic(ms)   Cached(ms)\n");
+
+  for (size_t i = 0U; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i)
+  {
+    double mutex_time  = run(mutex_pool,  thread_counts[i]);
+    double atomic_time = run(atomic_pool, thread_counts[i]);
+    double cached_time = run(cached_pool, thread_counts[i]);
+
+    printf("%7u   %9.1f   %10.1f   %10.1f\n", unsigned(thread_counts[i]), mutex_time, atomic_time, cached_time);
+  }
+
+  return 0;
+}
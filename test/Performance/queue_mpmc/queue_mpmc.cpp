@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Contention benchmark for etl::queue_mpmc_atomic and etl::queue_mpmc_mutex.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -pthread -I../../../include queue_mpmc.cpp -o queue_mpmc
+//
+// For each thread count, half of the threads push and half pop a fixed total
+// number of items through a queue of QUEUE_SIZE. The time to transfer all of
+// the items is reported.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+
+static const size_t QUEUE_SIZE  = 1024UL;
+static const size_t TOTAL_ITEMS = 4000000UL;
+
+typedef etl::queue_mpmc_atomic<uint32_t, QUEUE_SIZE> AtomicQueue;
+typedef etl::queue_mpmc_mutex<uint32_t, QUEUE_SIZE>  MutexQueue;
+
+//*****************************************************************************
+template <typename TQueue>
+double run(TQueue& queue, size_t n_threads)
+{
+  const size_t n_producers = (n_threads + 1U) / 2U;
+  const size_t n_consumers = (n_threads / 2U) == 0U ? 1U : (n_threads / 2U);
+  const size_t per_producer = TOTAL_ITEMS / n_producers;
+  const size_t total = per_producer * n_producers;
+
+  std::atomic<size_t> consumed(0);
+  std::atomic<bool>   start(false);
+
+  std::vector<std::thread> threads;
+
+  for (size_t p = 0U; p < n_producers; ++p)
+  {
+    threads.push_back(std::thread([&]()
+    {
+      while (!start.load()) {}
+
+      for (size_t i = 0U; i < per_producer; ++i)
+      {
+        while (!queue.push(uint32_t(i)))
+        {
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+
+  for (size_t c = 0U; c < n_consumers; ++c)
+  {
+    threads.push_back(std::thread([&]()
+    {
+      while (!start.load()) {}
+
+      uint32_t value;
+
+      while (consumed.load(std::memory_order_relaxed) < total)
+      {
+        if (queue.pop(value))
+        {
+          consumed.fetch_add(1U, std::memory_order_relaxed);
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  start.store(true);
+
+  for (size_t t = 0U; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+//*****************************************************************************
+int main()
+{
+  static AtomicQueue atomic_queue;
+  static MutexQueue  mutex_queue;
+
+  const size_t thread_counts[] = { 1U, 2U, 4U, 8U, 16U, 32U };
+
+  printf("Threads   Atomic(ms)   Mutex(ms)\n");
+
+  for (size_t i = 0U; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i)
+  {
+    double atomic_time = run(atomic_queue, thread_counts[i]);
+    double mutex_time  = run(mutex_queue, thread_counts[i]);
+
+    printf("%7u   %10.1f   %9.1f\n", unsigned(thread_counts[i]), atomic_time, mutex_time);
+  }
+
+  return 0;
+}
@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Multi-threaded shared_message benchmark for
+// etl::reference_counted_message_pool_atomic, against
+// etl::reference_counted_message_pool with lock()/unlock() overridden to take
+// a mutex.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -pthread -I../../../include reference_counted_message_pool.cpp -o reference_counted_message_pool
+//
+// For each thread count, every thread creates shared messages and sends them
+// through its own message_bus to SUBSCRIBERS routers. Each router keeps the
+// last HELD messages that it received, so the messages are released some time
+// after they are created. TOTAL_MESSAGES messages are created in all. The
+// time taken is reported.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/message.h"
+#include "etl/message_bus.h"
+#include "etl/message_router.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/reference_counted_message_pool_atomic.h"
+#include "etl/shared_message.h"
+
+static const size_t MAX_THREADS    = 32UL;
+static const size_t SUBSCRIBERS    = 4UL;
+static const size_t HELD           = 4UL;
+static const size_t POOL_SIZE      = MAX_THREADS * (SUBSCRIBERS * HELD + 1UL);
+static const size_t TOTAL_MESSAGES = 4000000UL;
+
+//*****************************************************************************
+struct Message : public etl::message<1>
+{
+  Message(uint32_t value_)
+    : value(value_)
+  {
+  }
+
+  uint32_t value;
+};
+
+//*****************************************************************************
+// Keeps the last HELD messages that it received.
+//*****************************************************************************
+struct Router : public etl::message_router<Router, Message>
+{
+  using etl::message_router<Router, Message>::receive;
+
+  Router()
+    : message_router(1)
+    , index(0)
+    , sum(0)
+  {
+  }
+
+  void receive(etl::shared_message shared_msg) override
+  {
+    sum += static_cast<const Message&>(shared_msg.get_message()).value;
+    held[index % HELD].emplace(shared_msg);
+    ++index;
+  }
+
+  void on_receive(const Message&)
+  {
+  }
+
+  void on_receive_unknown(const etl::imessage&)
+  {
+  }
+
+  std::optional<etl::shared_message> held[HELD];
+  size_t   index;
+  uint32_t sum;
+};
+
+//*****************************************************************************
+// etl::reference_counted_message_pool with a mutex in the lock hooks.
+//*****************************************************************************
+struct MutexPool : public etl::reference_counted_message_pool<etl::atomic_int32_t>
+{
+  typedef pool_message_parameters<Message> parameters;
+
+  MutexPool()
+    : reference_counted_message_pool(allocator)
+  {
+  }
+
+  void lock() override
+  {
+    mutex.lock();
+  }
+
+  void unlock() override
+  {
+    mutex.unlock();
+  }
+
+  etl::fixed_sized_memory_block_allocator<parameters::max_size, parameters::max_alignment, POOL_SIZE> allocator;
+  std::mutex mutex;
+};
+
+typedef etl::reference_counted_message_pool_atomic<POOL_SIZE, Message> AtomicPool;
+
+//*****************************************************************************
+// Runs the benchmark for a pool, returning the time in ms.
+//*****************************************************************************
+template <typename TPool>
+static double run(TPool& pool, size_t n_threads)
+{
+  std::atomic<bool> start(false);
+  std::vector<std::thread> threads;
+
+  const size_t per_thread = TOTAL_MESSAGES / n_threads;
+
+  for (size_t t = 0UL; t < n_threads; ++t)
+  {
+    threads.push_back(std::thread([&pool, &start, per_thread]()
+    {
+      etl::message_bus<SUBSCRIBERS> bus;
+      Router routers[SUBSCRIBERS];
+
+      for (size_t s = 0UL; s < SUBSCRIBERS; ++s)
+      {
+        bus.subscribe(routers[s]);
+      }
+
+      while (!start.load())
+      {
+        std::this_thread::yield();
+      }
+
+      for (size_t i = 0UL; i < per_thread; ++i)
+      {
+        bus.receive(etl::shared_message(pool, Message(uint32_t(i))));
+      }
+    }));
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  start.store(true);
+
+  for (size_t i = 0UL; i < threads.size(); ++i)
+  {
+    threads[i].join();
+  }
+
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+//*****************************************************************************
+int main()
+{
+  static MutexPool  mutex_pool;
+  static AtomicPool atomic_pool;
+
+  printf("threads   mutex lock hooks   pool_atomic\n");
+
+  for (size_t n_threads = 1UL; n_threads <= MAX_THREADS; n_threads *= 2UL)
+  {
+    double mutex_time  = run(mutex_pool,  n_threads);
+    double atomic_time = run(atomic_pool, n_threads);
+
+    printf("%7u   %13.1f ms   %8.1f ms\n", unsigned(n_threads), mutex_time, atomic_time);
+  }
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Allocate/release benchmark for etl::size_class_memory_block_allocator
+// against a successor chain of etl::fixed_sized_memory_block_allocator.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include size_class_memory_block_allocator.cpp -o size_class_memory_block_allocator
+//
+// Blocks of pseudo-random sizes are allocated and released in a sliding
+// window, so that every size class is in use. The time taken is reported.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/size_class_memory_block_allocator.h"
+
+static const size_t ALIGNMENT  = alignof(uint64_t);
+static const size_t BLOCKS     = 64UL;
+static const size_t HELD       = 32UL;
+static const size_t OPERATIONS = 20000000UL;
+
+using Chain16  = etl::fixed_sized_memory_block_allocator<16,  ALIGNMENT, BLOCKS>;
+using Chain32  = etl::fixed_sized_memory_block_allocator<32,  ALIGNMENT, BLOCKS>;
+using Chain64  = etl::fixed_sized_memory_block_allocator<64,  ALIGNMENT, BLOCKS>;
+using Chain128 = etl::fixed_sized_memory_block_allocator<128, ALIGNMENT, BLOCKS>;
+using Chain256 = etl::fixed_sized_memory_block_allocator<256, ALIGNMENT, BLOCKS>;
+
+using SizeClass = etl::size_class_memory_block_allocator<ALIGNMENT,
+                                                         etl::memory_block_class<16,  BLOCKS>,
+                                                         etl::memory_block_class<32,  BLOCKS>,
+                                                         etl::memory_block_class<64,  BLOCKS>,
+                                                         etl::memory_block_class<128, BLOCKS>,
+                                                         etl::memory_block_class<256, BLOCKS>>;
+
+//*****************************************************************************
+// Allocates and releases blocks through the allocator, returning the time in ms.
+//*****************************************************************************
+static double run(etl::imemory_block_allocator& allocator)
+{
+  void*    held[HELD] = {};
+  uint32_t random     = 12345U;
+  uint32_t failures   = 0U;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (size_t i = 0UL; i < OPERATIONS; ++i)
+  {
+    random = (random * 1664525U) + 1013904223U;
+
+    size_t size  = 1U + ((random >> 8) & 0xFFU);
+    size_t index = i % HELD;
+
+    if (held[index] != nullptr)
+    {
+      allocator.release(held[index]);
+    }
+
+    held[index] = allocator.allocate(size, ALIGNMENT);
+    failures += (held[index] == nullptr) ? 1U : 0U;
+  }
+
+  auto finish = std::chrono::steady_clock::now();
+
+  for (size_t i = 0UL; i < HELD; ++i)
+  {
+    if (held[i] != nullptr)
+    {
+      allocator.release(held[i]);
+    }
+  }
+
+  if (failures != 0U)
+  {
+    printf("  %u allocations failed\n", static_cast<unsigned>(failures));
+  }
+
+  return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+//*****************************************************************************
+int main()
+{
+  static Chain16  chain16;
+  static Chain32  chain32;
+  static Chain64  chain64;
+  static Chain128 chain128;
+  static Chain256 chain256;
+
+  chain16.set_successor(chain32);
+  chain32.set_successor(chain64);
+  chain64.set_successor(chain128);
+  chain128.set_successor(chain256);
+
+  static SizeClass size_class;
+
+  printf("successor chain           : %8.1f ms\n", run(chain16));
+  printf("size_class_memory_block   : %8.1f ms\n", run(size_class));
+
+  for (size_t i = 0U; i < size_class.number_of_classes(); ++i)
+  {
+    printf("  class %u (%3u bytes) high water mark %u\n",
+           static_cast<unsigned>(i),
+           static_cast<unsigned>(size_class.block_size(i)),
+           static_cast<unsigned>(size_class.high_water_mark(i)));
+  }
+
+  return 0;
+}
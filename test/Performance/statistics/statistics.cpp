@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Range benchmark for etl::mean, etl::variance and etl::correlation.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include statistics.cpp -o statistics
+//
+// Each statistic is calculated REPEATS times over SAMPLES values, once by
+// adding the values one at a time and once by adding the whole range, for
+// int16_t samples with int64_t sums and for float samples. The samples fit in
+// the cache, so that the calculation rather than the memory is timed. The
+// best time of RUNS is reported, with the results of both.
+// The parts of a range calculated on separate threads may be combined with
+// merge(), which costs the same as adding one value.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <vector>
+
+#include "etl/mean.h"
+#include "etl/variance.h"
+#include "etl/correlation.h"
+
+static const size_t SAMPLES = 16384UL;
+static const size_t REPEATS = 500UL;
+static const int    RUNS    = 5;
+
+//*****************************************************************************
+template <typename TFunction>
+static double time_best(TFunction function, double& result)
+{
+  double best = 1e30;
+
+  for (int run = 0; run < RUNS; ++run)
+  {
+    auto start = std::chrono::steady_clock::now();
+    result = function();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (ms < best)
+    {
+      best = ms;
+    }
+  }
+
+  return best;
+}
+
+//*****************************************************************************
+template <typename TInput, typename TCalc>
+static void run(const char* name, const std::vector<TInput>& x, const std::vector<TInput>& y)
+{
+  double r1;
+  double r2;
+  double t1;
+  double t2;
+
+  t1 = time_best([&]() { etl::mean<TInput, TCalc> s; for (size_t r = 0; r < REPEATS; ++r) { for (size_t i = 0; i < x.size(); ++i) { s.add(x[i]); } } return s.get_mean(); }, r1);
+  t2 = time_best([&]() { etl::mean<TInput, TCalc> s; for (size_t r = 0; r < REPEATS; ++r) { s.add(x.begin(), x.end()); } return s.get_mean(); }, r2);
+  printf("%-8s mean         single %7.2f ms   range %7.2f ms   (%g, %g)\n", name, t1, t2, r1, r2);
+
+  t1 = time_best([&]() { etl::variance<etl::variance_type::Sample, TInput, TCalc> s; for (size_t r = 0; r < REPEATS; ++r) { for (size_t i = 0; i < x.size(); ++i) { s.add(x[i]); } } return s.get_variance(); }, r1);
+  t2 = time_best([&]() { etl::variance<etl::variance_type::Sample, TInput, TCalc> s; for (size_t r = 0; r < REPEATS; ++r) { s.add(x.begin(), x.end()); } return s.get_variance(); }, r2);
+  printf("%-8s variance     single %7.2f ms   range %7.2f ms   (%g, %g)\n", name, t1, t2, r1, r2);
+
+  t1 = time_best([&]() { etl::correlation<etl::correlation_type::Sample, TInput, TCalc> s; for (size_t r = 0; r < REPEATS; ++r) { for (size_t i = 0; i < x.size(); ++i) { s.add(x[i], y[i]); } } return s.get_correlation(); }, r1);
+  t2 = time_best([&]() { etl::correlation<etl::correlation_type::Sample, TInput, TCalc> s; for (size_t r = 0; r < REPEATS; ++r) { s.add(x.begin(), x.end(), y.begin()); } return s.get_correlation(); }, r2);
+  printf("%-8s correlation  single %7.2f ms   range %7.2f ms   (%g, %g)\n", name, t1, t2, r1, r2);
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<int16_t> xi(SAMPLES);
+  std::vector<int16_t> yi(SAMPLES);
+  std::vector<float>   xf(SAMPLES);
+  std::vector<float>   yf(SAMPLES);
+
+  uint32_t random = 12345U;
+
+  for (size_t i = 0UL; i < SAMPLES; ++i)
+  {
+    random = (random * 1664525U) + 1013904223U;
+    xi[i] = int16_t((random >> 16) & 0x3FFU);
+    yi[i] = int16_t((xi[i] / 2) + ((random >> 8) & 0xFFU));
+    xf[i] = float(xi[i]) / 1024.0f;
+    yf[i] = float(yi[i]) / 1024.0f;
+  }
+
+  run<int16_t, int64_t>("int16_t", xi, yi);
+  run<float, float>("float", xf, yf);
+
+  return 0;
+}
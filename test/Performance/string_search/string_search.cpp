@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Benchmark of etl::string, etl::string_view and etl::string_utilities search.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include string_search.cpp -o string_search
+//
+// Searches a 4K string of text for a character, a substring and sets of
+// characters, reporting nanoseconds per search.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/string_utilities.h"
+
+static const size_t SIZE   = 4096UL;
+static const size_t ROUNDS = 20000UL;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double ns_per(size_t n) const
+  {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / double(n);
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+volatile size_t sink;
+
+//*****************************************************************************
+template <typename TFunction>
+void run(const char* name, TFunction function)
+{
+  Timer timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    sink = function();
+  }
+
+  printf("%-40s %9.1f ns\n", name, timer.ns_per(ROUNDS));
+}
+
+//*****************************************************************************
+int main()
+{
+  static etl::string<SIZE> text;
+
+  // Lower case words, with the searched for text at the end.
+  uint32_t seed = 12345UL;
+
+  while (text.size() < (SIZE - 32U))
+  {
+    seed = (seed * 1103515245UL) + 12345UL;
+    text.push_back(((seed >> 16U) % 8U) == 0U ? ' ' : char('a' + ((seed >> 16U) % 26U)));
+  }
+
+  text.append("#needle in a haystack!");
+
+  const etl::string_view view(text.data(), text.size());
+
+  run("string::find(char)",                   [&]() { return text.find('#'); });
+  run("string::find(const char*)",            [&]() { return text.find("needle"); });
+  run("string::rfind(const char*)",           [&]() { return text.rfind("zzzq"); });
+  run("string::find_first_of(5 chars)",       [&]() { return text.find_first_of("#!?.;"); });
+  run("string::find_first_not_of(27 chars)",  [&]() { return text.find_first_not_of(" abcdefghijklmnopqrstuvwxyz"); });
+  run("string::find_last_of(3 chars)",        [&]() { return text.find_last_of("#?0", SIZE - 40U); });
+  run("string_view::find(char)",              [&]() { return view.find('#'); });
+  run("string_view::find(const char*)",       [&]() { return view.find("needle"); });
+  run("string_view::find_first_of(5 chars)",  [&]() { return view.find_first_of("#!?.;"); });
+  run("string_utilities find_first_of(5)",    [&]() { return size_t(etl::find_first_of(text, "#!?.;") - text.begin()); });
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Benchmark of etl::to_string for floating point values.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include to_string_float.cpp -o to_string_float
+//
+// Compares the default fixed precision formatting with the shortest round
+// trip formatting, reporting nanoseconds per conversion.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "etl/to_string.h"
+#include "etl/string.h"
+#include "etl/format_spec.h"
+
+static const size_t SIZE   = 100000UL;
+static const size_t ROUNDS = 5UL;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double ns_per(size_t n) const
+  {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / double(n);
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+//*****************************************************************************
+template <typename T>
+void run(const char* name, const std::vector<T>& values, const etl::format_spec& format)
+{
+  etl::string<64> str;
+  size_t length = 0U;
+
+  Timer timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      etl::to_string(values[i], str, format);
+      length += str.size();
+    }
+  }
+
+  printf("%-28s %8.1f ns (average length %.1f)\n", name, timer.ns_per(values.size() * ROUNDS), double(length) / double(values.size() * ROUNDS));
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937_64 generator(1);
+  std::uniform_real_distribution<double> exponent(-30.0, 30.0);
+  std::uniform_real_distribution<double> mantissa(1.0, 10.0);
+
+  std::vector<double> doubles;
+  std::vector<float>  floats;
+
+  for (size_t i = 0U; i < SIZE; ++i)
+  {
+    double value = mantissa(generator) * pow(10.0, exponent(generator));
+    doubles.push_back(value);
+    floats.push_back(float(value));
+  }
+
+  run("double precision(6)",  doubles, etl::format_spec().precision(6));
+  run("double precision(17)", doubles, etl::format_spec().precision(17));
+  run("double shortest",      doubles, etl::format_spec().shortest(true));
+  run("float precision(6)",   floats,  etl::format_spec().precision(6));
+  run("float precision(9)",   floats,  etl::format_spec().precision(9));
+  run("float shortest",       floats,  etl::format_spec().shortest(true));
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+//*****************************************************************************
+// Benchmark of etl::get_token and etl::tokenize.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include tokenizer.cpp -o tokenizer
+//
+// Splits a 4K line of comma and space separated fields, with two and with
+// seven delimiters, reporting nanoseconds per complete split.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <chrono>
+
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/string_utilities.h"
+#include "etl/vector.h"
+
+static const size_t SIZE   = 4096UL;
+static const size_t ROUNDS = 20000UL;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double ns_per(size_t n) const
+  {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / double(n);
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+volatile size_t sink;
+
+//*****************************************************************************
+template <typename TFunction>
+void run(const char* name, TFunction function)
+{
+  Timer timer;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    sink = function();
+  }
+
+  printf("%-40s %9.1f ns\n", name, timer.ns_per(ROUNDS));
+}
+
+//*****************************************************************************
+int main()
+{
+  static etl::string<SIZE> text;
+
+  // Short lower case fields separated by ", ".
+  uint32_t seed = 12345UL;
+
+  while (text.size() < (SIZE - 16U))
+  {
+    seed = (seed * 1103515245UL) + 12345UL;
+    text.push_back(((seed >> 16U) % 6U) == 0U ? ',' : char('a' + ((seed >> 16U) % 26U)));
+
+    if (text.back() == ',')
+    {
+      text.push_back(' ');
+    }
+  }
+
+  const etl::string_view view(text.data(), text.size());
+
+  const char* const delimiter_sets[] = { ", ", " \t\n\r\f\v," };
+  const char* const get_token_names[] = { "get_token (2 delimiters)", "get_token (7 delimiters)" };
+  const char* const tokenize_names[]  = { "tokenize (2 delimiters)",  "tokenize (7 delimiters)" };
+
+  for (size_t i = 0U; i < 2U; ++i)
+  {
+    const char* delimiters = delimiter_sets[i];
+
+    run(get_token_names[i],
+        [&]()
+        {
+          size_t count = 0U;
+          etl::optional<etl::string_view> token;
+
+          while ((token = etl::get_token(view, delimiters, token, true)))
+          {
+            count += token.value().size();
+          }
+
+          return count;
+        });
+
+    run(tokenize_names[i],
+        [&]()
+        {
+          size_t count = 0U;
+
+          for (const etl::string_view& token : etl::tokenize(view, delimiters))
+          {
+            count += token.size();
+          }
+
+          return count;
+        });
+  }
+
+  run("tokenize (sequence)",
+      [&]()
+      {
+        size_t count = 0U;
+
+        for (const etl::string_view& token : etl::tokenize(view, ", ", true, etl::token_delimiter::SEQUENCE))
+        {
+          count += token.size();
+        }
+
+        return count;
+      });
+
+  run("get_tokens (batches of 64)",
+      [&]()
+      {
+        size_t count = 0U;
+        etl::vector<etl::string_view, 64> tokens;
+        etl::tokenizer<etl::string_view> tokenizer = etl::tokenize(view, ", ");
+        etl::tokenizer<etl::string_view>::const_iterator itr = tokenizer.begin();
+
+        while (itr != tokenizer.end())
+        {
+          tokens.clear();
+          itr = etl::get_tokens(itr, tokenizer.end(), tokens);
+          count += tokens.size();
+        }
+
+        return count;
+      });
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Benchmark of etl::unordered_flat_map against the chained etl::unordered_map.
+//
+// Build (from this directory):
+//   g++ -std=c++17 -O2 -I../../../include unordered_flat_map.cpp -o unordered_flat_map
+//
+// Both containers have 65536 slots or buckets and are filled to loads of 50%
+// to 87.5%, the maximum load of unordered_flat_map. For each load the time for
+// random inserts, successful finds and unsuccessful finds is reported in
+// nanoseconds per element.
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "etl/unordered_flat_map.h"
+#include "etl/unordered_map.h"
+
+static const size_t SLOTS  = 65536UL;
+static const size_t SIZE   = (SLOTS * 7UL) / 8UL;
+static const size_t ROUNDS = 5UL;
+
+typedef etl::unordered_map<uint32_t, uint32_t, SIZE, SLOTS> Map;
+typedef etl::unordered_flat_map<uint32_t, uint32_t, SIZE>   FlatMap;
+
+//*****************************************************************************
+struct Timer
+{
+  Timer()
+    : start(std::chrono::steady_clock::now())
+  {
+  }
+
+  double ns_per(size_t n) const
+  {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / double(n);
+  }
+
+  std::chrono::steady_clock::time_point start;
+};
+
+//*****************************************************************************
+template <typename TMap>
+void run(const char* name, TMap& map, size_t count, const std::vector<uint32_t>& keys, const std::vector<uint32_t>& misses)
+{
+  double insert_ns = 0.0;
+  double hit_ns    = 0.0;
+  double miss_ns   = 0.0;
+
+  volatile uint32_t sink = 0U;
+
+  for (size_t round = 0U; round < ROUNDS; ++round)
+  {
+    map.clear();
+
+    {
+      Timer timer;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        map.insert(typename TMap::value_type(keys[i], uint32_t(i)));
+      }
+
+      insert_ns += timer.ns_per(count);
+    }
+
+    {
+      Timer timer;
+      uint32_t sum = 0U;
+
+      for (size_t i = count; i != 0U; --i)
+      {
+        typename TMap::const_iterator itr = map.find(keys[i - 1U]);
+        sum += itr->second;
+      }
+
+      hit_ns += timer.ns_per(count);
+      sink = sink + sum;
+    }
+
+    {
+      Timer timer;
+      uint32_t found = 0U;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        found += (map.find(misses[i]) != map.end()) ? 1U : 0U;
+      }
+
+      miss_ns += timer.ns_per(count);
+      sink = sink + found;
+    }
+  }
+
+  printf("  %-18s insert %6.1f  find hit %6.1f  find miss %6.1f  ns/element\n",
+         name, insert_ns / ROUNDS, hit_ns / ROUNDS, miss_ns / ROUNDS);
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 generator(1U);
+
+  // Even keys are inserted, odd keys are looked up and never found.
+  std::vector<uint32_t> keys;
+  std::vector<uint32_t> misses;
+
+  while (keys.size() < SIZE)
+  {
+    const uint32_t key = uint32_t(generator());
+
+    if ((key & 1U) == 0U)
+    {
+      keys.push_back(key);
+    }
+    else
+    {
+      misses.push_back(key);
+    }
+  }
+
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  std::shuffle(keys.begin(), keys.end(), generator);
+
+  while (misses.size() < SIZE)
+  {
+    misses.push_back(uint32_t(generator()) | 1U);
+  }
+
+  static Map     map;
+  static FlatMap flat_map;
+
+  // Loads in tenths of a percent.
+  const size_t loads[] = { 500U, 600U, 700U, 800U, 875U };
+
+  for (size_t i = 0U; i < (sizeof(loads) / sizeof(loads[0])); ++i)
+  {
+    const size_t permille = loads[i];
+    const size_t count    = std::min((SLOTS * permille) / 1000U, keys.size());
+
+    printf("load %4.1f%%, %u elements, %u rounds\n", double(permille) / 10.0, unsigned(count), unsigned(ROUNDS));
+
+    run("unordered_map", map, count, keys, misses);
+    run("unordered_flat_map", flat_map, count, keys, misses);
+  }
+
+  return 0;
+}
@@ -48,6 +48,8 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_RANDOM
 
 #define ETL_POLYMORPHIC_BITSET
+#define ETL_POLYMORPHIC_BTREE_MAP
+#define ETL_POLYMORPHIC_BTREE_SET
 #define ETL_POLYMORPHIC_DEQUE
 #define ETL_POLYMORPHIC_FLAT_MAP
 #define ETL_POLYMORPHIC_FLAT_MULTIMAP
@@ -65,6 +67,7 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_MULTIMAP
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_SET
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_MULTISET
+#define ETL_POLYMORPHIC_UNORDERED_FLAT_MAP
 #define ETL_POLYMORPHIC_UNORDERED_MAP
 #define ETL_POLYMORPHIC_UNORDERED_MULTIMAP
 #define ETL_POLYMORPHIC_UNORDERED_SET
@@ -82,6 +85,7 @@ SOFTWARE.
   #define ETL_VECTOR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_MPMC_MUTEX_FORCE_CPP03_IMPLEMENTATION
+  #define ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_ISR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION
   #define ETL_OPTIONAL_FORCE_CPP03_IMPLEMENTATION
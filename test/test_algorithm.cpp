@@ -2086,6 +2086,278 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(intro_sort_default)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_patterns)
+    {
+      const size_t Size = 2000;
+
+      std::vector<std::vector<int>> patterns;
+
+      std::vector<int> data(Size, 0);
+
+      // Sorted.
+      std::iota(data.begin(), data.end(), 0);
+      patterns.push_back(data);
+
+      // Reversed.
+      std::reverse(data.begin(), data.end());
+      patterns.push_back(data);
+
+      // All equal.
+      std::fill(data.begin(), data.end(), 42);
+      patterns.push_back(data);
+
+      // Many duplicates.
+      for (size_t i = 0; i < Size; ++i)
+      {
+        data[i] = int(urng() % 4);
+      }
+      patterns.push_back(data);
+
+      // Organ pipe.
+      for (size_t i = 0; i < Size; ++i)
+      {
+        data[i] = int((i < (Size / 2)) ? i : (Size - i));
+      }
+      patterns.push_back(data);
+
+      // Sawtooth.
+      for (size_t i = 0; i < Size; ++i)
+      {
+        data[i] = int(i % 64);
+      }
+      patterns.push_back(data);
+
+      // Sorted with a few swaps.
+      std::iota(data.begin(), data.end(), 0);
+      for (size_t i = 0; i < 10; ++i)
+      {
+        std::swap(data[urng() % Size], data[urng() % Size]);
+      }
+      patterns.push_back(data);
+
+      for (size_t i = 0; i < patterns.size(); ++i)
+      {
+        std::vector<int> data1 = patterns[i];
+        std::vector<int> data2 = patterns[i];
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_small_ranges)
+    {
+      for (int size = 0; size < 40; ++size)
+      {
+        std::vector<int> data(size_t(size), 0);
+        std::iota(data.begin(), data.end(), 0);
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_default)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::merge_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_greater)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::merge_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_large_stability)
+    {
+      const size_t Size = 1000;
+
+      std::vector<NDC> initial_data;
+
+      for (size_t i = 0; i < Size; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 20), int(i)));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::stable_sort(data1.begin(), data1.end());
+
+      // In place.
+      std::vector<NDC> data2(initial_data);
+      etl::merge_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+
+      // Full buffer.
+      std::vector<NDC> data3(initial_data);
+      std::vector<NDC> buffer(Size / 2, NDC(0));
+      etl::merge_sort(data3.begin(), data3.end(), buffer.begin(), buffer.end());
+
+      is_same = std::equal(data1.begin(), data1.end(), data3.begin(), NDC::are_identical);
+      CHECK(is_same);
+
+      // Buffer too small for the largest merges.
+      std::vector<NDC> data4(initial_data);
+      std::vector<NDC> small_buffer(Size / 16, NDC(0));
+      etl::merge_sort(data4.begin(), data4.end(), small_buffer.begin(), small_buffer.end());
+
+      is_same = std::equal(data1.begin(), data1.end(), data4.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_buffer_greater)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      std::vector<int> buffer(data.size() / 2);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::stable_sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::merge_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_forward_iterators)
+    {
+      std::vector<NDC> initial_data;
+
+      for (size_t i = 0; i < 200; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 10), int(i)));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::forward_list<NDC> data2(initial_data.begin(), initial_data.end());
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::merge_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
+    //*************************************************************************
+    constexpr std::array<int, 32> MakeIntroSorted()
+    {
+      std::array<int, 32> data = { 31, 5, 12, 0, 27, 8, 19, 3, 22, 14, 1, 30, 9, 17, 25, 6,
+                                   11, 28, 2, 20, 15, 24, 7, 29, 4, 18, 13, 26, 10, 23, 16, 21 };
+
+      etl::intro_sort(data.begin(), data.end());
+
+      return data;
+    }
+
+    constexpr std::array<int, 32> MakeMergeSorted()
+    {
+      std::array<int, 32> data = { 31, 5, 12, 0, 27, 8, 19, 3, 22, 14, 1, 30, 9, 17, 25, 6,
+                                   11, 28, 2, 20, 15, 24, 7, 29, 4, 18, 13, 26, 10, 23, 16, 21 };
+
+      etl::merge_sort(data.begin(), data.end());
+
+      return data;
+    }
+
+    TEST(constexpr_intro_sort_and_merge_sort)
+    {
+      constexpr std::array<int, 32> intro_sorted = MakeIntroSorted();
+      constexpr std::array<int, 32> merge_sorted = MakeMergeSorted();
+
+      for (int i = 0; i < 32; ++i)
+      {
+        CHECK_EQUAL(i, intro_sorted[size_t(i)]);
+        CHECK_EQUAL(i, merge_sorted[size_t(i)]);
+      }
+    }
+#endif
+
     //*************************************************************************
     TEST(multimax)
     {
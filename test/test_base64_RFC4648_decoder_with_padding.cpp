@@ -762,6 +762,21 @@ namespace
 
       std::string invalid_chararacter("OycDQ#37KA");
 
+#if ETL_USING_EXCEPTIONS
+      CHECK_THROW((b64.decode(invalid_chararacter.data(), invalid_chararacter.size())), etl::base64_invalid_data);
+#else
+      CHECK_FALSE(b64.decode(invalid_chararacter.data(), invalid_chararacter.size()));
+      CHECK_TRUE(b64.error());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_decode_invalid_character_from_another_character_set)
+    {
+      codec_larger_buffer b64;
+
+      std::string invalid_chararacter("OycD-y37KA==");
+
 #if ETL_USING_EXCEPTIONS
       CHECK_THROW((b64.decode(invalid_chararacter.data(), invalid_chararacter.size())), etl::base64_invalid_data);
 #else
@@ -602,6 +602,44 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_encode_pointer_size_multi_pass_odd_blocks_with_callback_larger_buffer)
+    {
+      codec_larger_buffer b64(callback);
+
+      for (size_t i = 0; i < 256; ++i)
+      {
+        encoded_output.clear();
+        received_final_block = false;
+
+        auto start = input_data.data();
+        auto length = i;
+
+        // Blocks that are not a multiple of 3 leave data in the input buffer.
+        while (length >= 7)
+        {
+          b64.encode(start, 7);
+          length -= 7;
+          start += 7;
+        }
+
+        if (length > 0)
+        {
+          b64.encode(start, length);
+        }
+
+        CHECK_FALSE(received_final_block);
+        b64.flush();
+        CHECK_TRUE(received_final_block);
+
+        std::string expected(encoded[i]);
+        std::string actual(encoded_output);
+
+        CHECK_EQUAL(expected, actual);
+        CHECK_TRUE(codec::safe_output_buffer_size(i) >= encoded_output.size());
+      }
+    }
+
     //*************************************************************************
     TEST(test_encode_multi_pass_by_char_with_callback)
     {
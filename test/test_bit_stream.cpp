@@ -1072,6 +1072,75 @@ namespace
       CHECK(bit_stream.get(rd));
       CHECK_CLOSE(f, rd, 0.1f);
     }
+
+    //*************************************************************************
+    TEST(put_get_zero_width)
+    {
+      std::array<unsigned char, 16> storage;
+      storage.fill(0xFF);
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      // Zero width fields at and between char boundaries.
+      CHECK(bit_stream.put(uint32_t(1), 0U));
+      CHECK(bit_stream.put(uint8_t(0xA5)));
+      CHECK(bit_stream.put(uint64_t(1), 0U));
+      CHECK(bit_stream.put(uint8_t(0x0C), 4U));
+      CHECK(bit_stream.put(uint32_t(1), 0U));
+      CHECK(bit_stream.put(uint8_t(0x03), 4U));
+
+      CHECK_EQUAL(2U, bit_stream.size());
+      CHECK_EQUAL(0xA5, int(storage[0]));
+      CHECK_EQUAL(0xC3, int(storage[1]));
+      CHECK_EQUAL(0xFF, int(storage[2]));
+
+      bit_stream.restart();
+
+      uint32_t zero32 = 1U;
+      uint64_t zero64 = 1U;
+      uint8_t  value  = 0U;
+
+      CHECK(bit_stream.get(zero32, 0U));
+      CHECK_EQUAL(0U, zero32);
+      CHECK(bit_stream.get(value));
+      CHECK_EQUAL(0xA5, int(value));
+      CHECK(bit_stream.get(zero64, 0U));
+      CHECK_EQUAL(0U, zero64);
+      CHECK(bit_stream.get(value, 4U));
+      CHECK_EQUAL(0x0C, int(value));
+      CHECK(bit_stream.get(zero32, 0U));
+      CHECK_EQUAL(0U, zero32);
+      CHECK(bit_stream.get(value, 4U));
+      CHECK_EQUAL(0x03, int(value));
+    }
+
+    //*************************************************************************
+    TEST(put_patch_in_place)
+    {
+      std::array<unsigned char, 16> storage;
+      std::array<unsigned char, 16> expected = { 0x11, 0xA1, 0xA2, 0xA3, 0xAB, 0xCD, 0xA6, 0xA7,
+                                                 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF };
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      for (size_t i = 0U; i < storage.size(); ++i)
+      {
+        CHECK(bit_stream.put(uint8_t(0xA0 + i)));
+      }
+
+      // Patch the first char.
+      bit_stream.restart();
+      CHECK(bit_stream.put(uint8_t(0x11)));
+
+      // Patch a 12 bit field that starts half way through a char.
+      uint32_t skipped1;
+      uint8_t  skipped2;
+      CHECK(bit_stream.get(skipped1, 24U));
+      CHECK(bit_stream.get(skipped2, 4U));
+      CHECK(bit_stream.put(uint16_t(0x0BCD), 12U));
+
+      CHECK_ARRAY_EQUAL(expected.data(), storage.data(), storage.size());
+    }
   };
 }
 
@@ -1450,6 +1450,81 @@ namespace
       CHECK_EQUAL(int8_t(0x25), result_c2.value());
     }
 
+    //*************************************************************************
+    TEST(test_read_span_int8_t_5bits)
+    {
+      std::array<char, 3U>   storage  = { char(0x0E), char(0x8B), char(0xF0) };
+      std::array<int8_t, 4U> expected = { int8_t(0x01), int8_t(0xFA), int8_t(0x05), int8_t(0xFF) };
+      std::array<int8_t, 4U> result   = { 0, 0, 0, 0 };
+
+      etl::bit_stream_reader bit_stream(storage.data(), storage.size(), etl::endian::big);
+
+      // Not enough bits for all of them.
+      CHECK_FALSE(bit_stream.read(etl::span<int8_t>(result.data(), result.size()), 7U));
+
+      CHECK(bit_stream.read(etl::span<int8_t>(result.data(), result.size()), 5U));
+
+      CHECK_EQUAL(int(expected[0]), int(result[0]));
+      CHECK_EQUAL(int(expected[1]), int(result[1]));
+      CHECK_EQUAL(int(expected[2]), int(result[2]));
+      CHECK_EQUAL(int(expected[3]), int(result[3]));
+
+      // One too many.
+      CHECK_FALSE(bit_stream.read(etl::span<int8_t>(result.data(), 1U), 5U));
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_round_trip_variable_sizes)
+    {
+      // Widths of 1 to 64 bits, crossing every char alignment.
+      std::array<uint64_t, 64U> write_data;
+      std::array<int64_t, 64U>  signed_data;
+      std::array<char, 520U>    storage;
+
+      uint64_t seed = 0x0123456789ABCDEFULL;
+
+      for (size_t i = 0U; i < write_data.size(); ++i)
+      {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+        write_data[i]  = seed;
+        signed_data[i] = int64_t(seed);
+      }
+
+      etl::bit_stream_writer writer(storage.data(), storage.size(), etl::endian::big);
+
+      for (size_t i = 0U; i < write_data.size(); ++i)
+      {
+        CHECK(writer.write(write_data[i], uint_least8_t(i + 1U)));
+      }
+
+      for (size_t i = 0U; i < signed_data.size(); ++i)
+      {
+        CHECK(writer.write(signed_data[i], uint_least8_t(64U - i)));
+      }
+
+      etl::bit_stream_reader reader(storage.data(), writer.used_data().size(), etl::endian::big);
+
+      for (size_t i = 0U; i < write_data.size(); ++i)
+      {
+        const uint_least8_t nbits = uint_least8_t(i + 1U);
+        const uint64_t      mask  = (nbits == 64U) ? ~uint64_t(0U) : ((uint64_t(1U) << nbits) - 1U);
+
+        auto result = reader.read<uint64_t>(nbits);
+        CHECK(result.has_value());
+        CHECK_EQUAL(write_data[i] & mask, result.value());
+      }
+
+      for (size_t i = 0U; i < signed_data.size(); ++i)
+      {
+        const uint_least8_t nbits = uint_least8_t(64U - i);
+        const int64_t       value = (nbits == 64U) ? signed_data[i] : etl::sign_extend<int64_t, int64_t>(signed_data[i], nbits);
+
+        auto result = reader.read<int64_t>(nbits);
+        CHECK(result.has_value());
+        CHECK_EQUAL(value, result.value());
+      }
+    }
+
     //*************************************************************************
     TEST(test_read_checked_object)
     {
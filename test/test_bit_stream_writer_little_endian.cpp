@@ -572,6 +572,32 @@ namespace
       // 12th to 16th to bytes not used.
     }
 
+    //*************************************************************************
+    TEST(test_write_span_int16_t_10bits)
+    {
+      std::array<char, 5U>                  storage;
+      storage.fill(0x5A);
+      std::array<int16_t, 4>                write_data = { int16_t(0x0001), int16_t(0xA55A), int16_t(0x5AA5), int16_t(0xFFFF) };
+      std::array<char, 5U>                  expected   = { char(0x80), char(0x16), char(0xAA), char(0x57),
+                                                          char(0xFF) };
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      // Not enough space for all of them.
+      CHECK_FALSE(bit_stream.write(etl::span<const int16_t>(write_data.data(), write_data.size()), 11));
+      CHECK_EQUAL(0, bit_stream.used_data().size());
+
+      // Insert into the stream
+      CHECK(bit_stream.write(etl::span<const int16_t>(write_data.data(), write_data.size()), 10));
+      CHECK_EQUAL(5, bit_stream.used_data().size());
+
+      CHECK_EQUAL((int)expected[0], (int)storage[0]);
+      CHECK_EQUAL((int)expected[1], (int)storage[1]);
+      CHECK_EQUAL((int)expected[2], (int)storage[2]);
+      CHECK_EQUAL((int)expected[3], (int)storage[3]);
+      CHECK_EQUAL((int)expected[4], (int)storage[4]);
+    }
+
     //*************************************************************************
     TEST(test_write_uint32_t_22bits)
     {
@@ -0,0 +1,682 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "etl/btree_map.h"
+#include "etl/map.h"
+
+namespace
+{
+  static const size_t SIZE = 10U;
+
+  typedef etl::btree_map<std::string, int, SIZE>          Data;
+  typedef etl::ibtree_map<std::string, int>               IData;
+  typedef std::map<std::string, int>                      Compare_Data;
+  typedef etl::btree_map<int, int, 1000U>                 DataInt;
+  typedef etl::btree_map<int, int, 100U, std::greater<int> > DataGreater;
+
+  //***************************************************************************
+  // A value large enough to force the smallest leaves and a deep tree.
+  struct Large
+  {
+    Large()
+      : value(0)
+    {
+    }
+
+    Large(int value_)
+      : value(value_)
+    {
+    }
+
+    bool operator ==(const Large& other) const
+    {
+      return value == other.value;
+    }
+
+    int  value;
+    char padding[252];
+  };
+
+  //***************************************************************************
+  // A key large enough to force the smallest inner nodes.
+  struct LargeKey
+  {
+    LargeKey(int key_)
+      : key(key_)
+    {
+    }
+
+    bool operator <(const LargeKey& other) const
+    {
+      return key < other.key;
+    }
+
+    int  key;
+    char padding[124];
+  };
+
+  //***************************************************************************
+  struct Key
+  {
+    Key(const char* k_)
+      : k(k_)
+    {
+    }
+
+    std::string k;
+  };
+
+  bool operator <(const Key& lhs, const std::string& rhs)
+  {
+    return (lhs.k < rhs);
+  }
+
+  bool operator <(const std::string& lhs, const Key& rhs)
+  {
+    return (lhs < rhs.k);
+  }
+
+  //***************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  // A simple repeatable pseudo random sequence.
+  struct Random
+  {
+    Random()
+      : state(12345U)
+    {
+    }
+
+    uint32_t operator ()(uint32_t range)
+    {
+      state = (state * 1103515245U) + 12345U;
+      return (state >> 8U) % range;
+    }
+
+    uint32_t state;
+  };
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      std::vector<std::pair<std::string, int>> initial_data;
+      std::vector<std::pair<std::string, int>> excess_data;
+
+      SetupFixture()
+      {
+        for (int i = 0; i < 10; ++i)
+        {
+          initial_data.push_back(std::make_pair(std::to_string(i), i));
+        }
+
+        for (int i = 0; i < 11; ++i)
+        {
+          excess_data.push_back(std::make_pair(std::to_string(i), i));
+        }
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      Data data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(data.full());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      Data data = { { "2", 2 }, { "0", 0 }, { "1", 1 } };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, data["0"]);
+      CHECK_EQUAL(1, data["1"]);
+      CHECK_EQUAL(2, data["2"]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data data2(data);
+
+      CHECK(data2 == data);
+      CHECK_EQUAL(data.size(), data2.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data data2(std::move(data));
+
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.empty());
+      CHECK_EQUAL(compare_data.size(), data2.size());
+      CHECK(Check_Equal(data2.begin(), data2.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data other = { { "x", 1 } };
+
+      other = data;
+
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      Data data1(initial_data.begin(), initial_data.end());
+      Data data2;
+
+      IData& idata1 = data1;
+      IData& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_assignment)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data other;
+
+      other = std::move(data);
+
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.empty());
+      CHECK(Check_Equal(other.begin(), other.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_operator)
+    {
+      Data data;
+
+      data["5"] = 5;
+      data["3"] = 3;
+      data["5"] = 50;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(50, data["5"]);
+      CHECK_EQUAL(3, data["3"]);
+      CHECK_EQUAL(0, data["7"]);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_operator_full)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK_NO_THROW(data["0"] = 1);
+      CHECK_THROW(data["10"] = 10, etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      CHECK_EQUAL(3, data.at("3"));
+      CHECK_EQUAL(4, cdata.at("4"));
+      CHECK_THROW(data.at("10"), etl::btree_map_out_of_bounds);
+      CHECK_THROW(cdata.at("10"), etl::btree_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert)
+    {
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.insert(std::make_pair(std::string("1"), 1));
+      CHECK(result.second);
+      CHECK_EQUAL("1", result.first->first);
+      CHECK_EQUAL(1, result.first->second);
+
+      result = data.insert(std::make_pair(std::string("1"), 2));
+      CHECK(!result.second);
+      CHECK_EQUAL(1, result.first->second);
+
+      Data::iterator itr = data.insert(data.begin(), std::make_pair(std::string("0"), 0));
+      CHECK_EQUAL("0", itr->first);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      Data data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_emplace)
+    {
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.emplace("1", 1);
+      CHECK(result.second);
+      CHECK_EQUAL(1, result.first->second);
+
+      result = data.emplace("1", 2);
+      CHECK(!result.second);
+      CHECK_EQUAL(1, data["1"]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      CHECK_EQUAL(5, data.find("5")->second);
+      CHECK_EQUAL(6, cdata.find("6")->second);
+      CHECK(data.find("A") == data.end());
+      CHECK(cdata.find("A") == cdata.end());
+      CHECK(data.contains("7"));
+      CHECK(!data.contains("A"));
+      CHECK_EQUAL(1U, data.count("7"));
+      CHECK_EQUAL(0U, data.count("A"));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_using_transparent_comparator)
+    {
+      etl::btree_map<std::string, int, SIZE, etl::less<>> data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(5, data.find(Key("5"))->second);
+      CHECK(data.find(Key("A")) == data.end());
+      CHECK(data.contains(Key("7")));
+      CHECK_EQUAL(7, data.at(Key("7")));
+      CHECK_EQUAL(1U, data.count(Key("7")));
+      CHECK(data.lower_bound(Key("3")) == data.find("3"));
+      CHECK(data.upper_bound(Key("3")) == data.find("4"));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_bounds)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        data[i * 2] = i;
+      }
+
+      for (int i = -1; i < 1001; ++i)
+      {
+        DataInt::iterator lower = data.lower_bound(i);
+        DataInt::iterator upper = data.upper_bound(i);
+
+        int expected_lower = (i < 0) ? 0 : ((i + 1) / 2) * 2;
+        int expected_upper = (i < 0) ? 0 : ((i / 2) + 1) * 2;
+
+        if (expected_lower >= 1000)
+        {
+          CHECK(lower == data.end());
+        }
+        else
+        {
+          CHECK_EQUAL(expected_lower, lower->first);
+        }
+
+        if (expected_upper >= 1000)
+        {
+          CHECK(upper == data.end());
+        }
+        else
+        {
+          CHECK_EQUAL(expected_upper, upper->first);
+        }
+
+        std::pair<DataInt::iterator, DataInt::iterator> range = data.equal_range(i);
+        CHECK(range.first == lower);
+        CHECK(range.second == upper);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase("5"));
+      CHECK_EQUAL(0U, data.erase("5"));
+      CHECK_EQUAL(9U, data.size());
+      CHECK(data.find("5") == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_iterator)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data[i] = i;
+      }
+
+      // Erase every other element, using the returned iterator.
+      DataInt::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        itr = data.erase(itr);
+
+        if (itr != data.end())
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(100U, data.size());
+
+      int expected = 1;
+
+      for (itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first);
+        expected += 2;
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data[i] = i;
+      }
+
+      DataInt::iterator itr = data.erase(data.find(50), data.find(150));
+
+      CHECK_EQUAL(150, itr->first);
+      CHECK_EQUAL(100U, data.size());
+      CHECK(data.find(49) != data.end());
+      CHECK(data.find(50) == data.end());
+      CHECK(data.find(149) == data.end());
+
+      itr = data.erase(data.begin(), data.end());
+
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK(data.full());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      // All of the nodes are available again.
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[999 - i] = i;
+      }
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterators)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[(i * 7) % 1000] = i;
+      }
+
+      int expected = 0;
+
+      for (DataInt::const_iterator itr = data.cbegin(); itr != data.cend(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first);
+        ++expected;
+      }
+
+      CHECK_EQUAL(1000, expected);
+
+      for (DataInt::reverse_iterator itr = data.rbegin(); itr != data.rend(); ++itr)
+      {
+        --expected;
+        CHECK_EQUAL(expected, itr->first);
+      }
+
+      CHECK_EQUAL(0, expected);
+
+      DataInt::iterator itr = data.end();
+      --itr;
+      CHECK_EQUAL(999, itr->first);
+
+      // Modify through the iterator.
+      itr->second = -1;
+      CHECK_EQUAL(-1, data[999]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_compare_functor)
+    {
+      DataGreater data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i;
+      }
+
+      int expected = 99;
+
+      for (DataGreater::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first);
+        --expected;
+      }
+
+      CHECK_EQUAL(40, data.lower_bound(40)->first);
+      CHECK_EQUAL(39, data.upper_bound(40)->first);
+      CHECK(data.value_comp()(*data.find(2), *data.find(1)));
+      CHECK(data.key_comp()(2, 1));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_comparisons)
+    {
+      Data data1 = { { "1", 1 }, { "2", 2 } };
+      Data data2 = { { "1", 1 }, { "2", 2 } };
+      Data data3 = { { "1", 1 }, { "3", 3 } };
+
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+      CHECK(data1 < data3);
+      CHECK(data1 <= data2);
+      CHECK(data3 > data1);
+      CHECK(data3 >= data1);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_random_operations_against_std_map)
+    {
+      // Small nodes and a capacity limit exercise every split, borrow and merge path.
+      static const size_t Capacity = 500U;
+
+      etl::btree_map<int, Large, Capacity> data;
+      std::map<int, Large> compare_data;
+
+      Random random;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int key = static_cast<int>(random(1000U));
+
+        if ((random(3U) != 0U) && !data.full())
+        {
+          bool inserted = data.insert(std::make_pair(key, Large(i))).second;
+          CHECK_EQUAL(compare_data.insert(std::make_pair(key, Large(i))).second, inserted);
+        }
+        else
+        {
+          CHECK_EQUAL(compare_data.erase(key), data.erase(key));
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+      }
+
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      // Drain in key order.
+      while (!data.empty())
+      {
+        data.erase(data.begin());
+        compare_data.erase(compare_data.begin());
+
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_fill_and_drain_large_keys)
+    {
+      // Small leaves and small inner nodes, for the deepest tree.
+      static const size_t Capacity = 300U;
+
+      etl::btree_map<LargeKey, Large, Capacity> data;
+
+      for (int i = 0; i < int(Capacity); ++i)
+      {
+        data.insert(std::make_pair(LargeKey((i * 37) % int(Capacity)), Large(i)));
+      }
+
+      CHECK(data.full());
+
+      int expected = 0;
+
+      for (etl::btree_map<LargeKey, Large, Capacity>::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first.key);
+        ++expected;
+      }
+
+      for (int i = 0; i < int(Capacity); ++i)
+      {
+        CHECK_EQUAL(1U, data.erase(LargeKey((i * 11) % int(Capacity))));
+      }
+
+      CHECK(data.empty());
+
+      // Refill in descending order.
+      for (int i = int(Capacity) - 1; i >= 0; --i)
+      {
+        data.insert(std::make_pair(LargeKey(i), Large(i)));
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(0, data.begin()->first.key);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_node_sizes)
+    {
+      // Leaf and inner nodes each span several cache lines, within bounds.
+      CHECK(DataInt::Leaf_Capacity >= 4U);
+      CHECK(DataInt::Leaf_Capacity <= 64U);
+      CHECK(DataInt::Inner_Capacity >= 4U);
+      CHECK(DataInt::Inner_Capacity <= 64U);
+      CHECK_EQUAL(4U, (etl::btree_map<int, Large, 10>::Leaf_Capacity));
+      CHECK_EQUAL(4U, (etl::btree_map<LargeKey, int, 10>::Inner_Capacity));
+    }
+  };
+}
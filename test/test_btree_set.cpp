@@ -0,0 +1,333 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "etl/btree_set.h"
+
+namespace
+{
+  static const size_t SIZE = 10U;
+
+  typedef etl::btree_set<int, SIZE>                         Data;
+  typedef etl::ibtree_set<int>                              IData;
+  typedef std::set<int>                                     Compare_Data;
+  typedef etl::btree_set<int, 1000U>                        DataLarge;
+  typedef etl::btree_set<int, 100U, std::greater<int> >     DataGreater;
+
+  //***************************************************************************
+  // A key large enough to force the smallest nodes and a deep tree.
+  struct LargeKey
+  {
+    LargeKey(int key_)
+      : key(key_)
+    {
+    }
+
+    bool operator <(const LargeKey& other) const
+    {
+      return key < other.key;
+    }
+
+    bool operator ==(const LargeKey& other) const
+    {
+      return key == other.key;
+    }
+
+    int  key;
+    char padding[252];
+  };
+
+  //***************************************************************************
+  // A simple repeatable pseudo random sequence.
+  struct Random
+  {
+    Random()
+      : state(54321U)
+    {
+    }
+
+    uint32_t operator ()(uint32_t range)
+    {
+      state = (state * 1103515245U) + 12345U;
+      return (state >> 8U) % range;
+    }
+
+    uint32_t state;
+  };
+
+  SUITE(test_btree_set)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      std::vector<int> initial_data;
+      std::vector<int> excess_data;
+
+      SetupFixture()
+      {
+        int data[] = { 5, 2, 7, 0, 9, 1, 8, 3, 6, 4 };
+
+        initial_data.assign(std::begin(data), std::end(data));
+        excess_data = initial_data;
+        excess_data.push_back(10);
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      Data data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      Data data = { 3, 1, 2, 1 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, *data.begin());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_and_move)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data copy(data);
+
+      CHECK(copy == data);
+
+      Data moved(std::move(copy));
+
+      CHECK(copy.empty());
+      CHECK(moved == data);
+
+      Data assigned;
+      assigned = data;
+      CHECK(assigned == data);
+
+      Data move_assigned;
+      move_assigned = std::move(assigned);
+      CHECK(assigned.empty());
+      CHECK(move_assigned == data);
+
+      IData& idata = move_assigned;
+      idata = Data{ 1, 2 };
+      CHECK_EQUAL(2U, move_assigned.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert)
+    {
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.insert(1);
+      CHECK(result.second);
+      CHECK_EQUAL(1, *result.first);
+
+      result = data.insert(1);
+      CHECK(!result.second);
+
+      Data::iterator itr = data.insert(data.end(), 0);
+      CHECK_EQUAL(0, *itr);
+
+      result = data.emplace(2);
+      CHECK(result.second);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_excess)
+    {
+      Data data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::btree_set_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_and_bounds)
+    {
+      DataLarge data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.insert(i * 3);
+      }
+
+      for (int i = -1; i < 3001; ++i)
+      {
+        Compare_Data::size_type expected_count = ((i >= 0) && (i < 3000) && ((i % 3) == 0)) ? 1U : 0U;
+
+        CHECK_EQUAL(expected_count, data.count(i));
+        CHECK_EQUAL(expected_count == 1U, data.find(i) != data.end());
+
+        int expected_lower = (i < 0) ? 0 : ((i + 2) / 3) * 3;
+        int expected_upper = (i < 0) ? 0 : ((i / 3) + 1) * 3;
+
+        DataLarge::const_iterator lower = data.lower_bound(i);
+        DataLarge::const_iterator upper = data.upper_bound(i);
+
+        CHECK((expected_lower >= 3000) ? (lower == data.end()) : (*lower == expected_lower));
+        CHECK((expected_upper >= 3000) ? (upper == data.end()) : (*upper == expected_upper));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase)
+    {
+      DataLarge data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.insert(i);
+      }
+
+      CHECK_EQUAL(1U, data.erase(500));
+      CHECK_EQUAL(0U, data.erase(500));
+
+      DataLarge::iterator itr = data.erase(data.find(499));
+      CHECK_EQUAL(501, *itr);
+
+      itr = data.erase(data.lower_bound(100), data.lower_bound(200));
+      CHECK_EQUAL(200, *itr);
+      CHECK_EQUAL(898U, data.size());
+
+      itr = data.erase(data.find(999));
+      CHECK(itr == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterators)
+    {
+      DataLarge data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.insert((i * 13) % 1000);
+      }
+
+      std::vector<int> forward(data.begin(), data.end());
+      std::vector<int> reverse(data.rbegin(), data.rend());
+
+      CHECK_EQUAL(1000U, forward.size());
+      CHECK(std::is_sorted(forward.begin(), forward.end()));
+      std::reverse(reverse.begin(), reverse.end());
+      CHECK(forward == reverse);
+
+      DataLarge::const_iterator itr = data.cend();
+      --itr;
+      CHECK_EQUAL(999, *itr);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_compare_functor)
+    {
+      DataGreater data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(i);
+      }
+
+      CHECK_EQUAL(99, *data.begin());
+      CHECK_EQUAL(0, *data.rbegin());
+      CHECK_EQUAL(39, *data.upper_bound(40));
+      CHECK(data.value_comp()(2, 1));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_comparisons)
+    {
+      Data data1 = { 1, 2 };
+      Data data2 = { 1, 2 };
+      Data data3 = { 1, 3 };
+
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+      CHECK(data1 < data3);
+      CHECK(data1 <= data2);
+      CHECK(data3 > data1);
+      CHECK(data3 >= data1);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_random_operations_against_std_set)
+    {
+      static const size_t Capacity = 300U;
+
+      etl::btree_set<LargeKey, Capacity> data;
+      std::set<LargeKey> compare_data;
+
+      Random random;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        LargeKey key(static_cast<int>(random(500U)));
+
+        if ((random(2U) != 0U) && !data.full())
+        {
+          CHECK_EQUAL(compare_data.insert(key).second, data.insert(key).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare_data.erase(key), data.erase(key));
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+      }
+
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+  };
+}
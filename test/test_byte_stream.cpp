@@ -36,6 +36,7 @@ SOFTWARE.
 #include <array>
 #include <numeric>
 #include <vector>
+#include <cstring>
 
 #include "etl/private/diagnostic_useless_cast_push.h"
 
@@ -1003,6 +1004,74 @@ namespace
       CHECK_EQUAL(0x12345678, i.value());
     }
 
+    //*************************************************************************
+    TEST(write_read_span_range_byte_order)
+    {
+      std::array<char, 4 * sizeof(uint16_t)> storage16;
+      std::array<char, 2 * sizeof(uint64_t)> storage64;
+      std::array<uint16_t, 4> put_data16 = { uint16_t(0x0102), uint16_t(0x0304), uint16_t(0x0506), uint16_t(0x0708) };
+      std::array<uint64_t, 2> put_data64 = { uint64_t(0x0102030405060708ULL), uint64_t(0x1112131415161718ULL) };
+      std::array<uint16_t, 4> get_data16 = { 0, 0, 0, 0 };
+      std::array<uint64_t, 2> get_data64 = { 0, 0 };
+
+      const etl::endian endians[] = { etl::endian::big, etl::endian::little };
+
+      for (size_t e = 0U; e < 2U; ++e)
+      {
+        const bool is_big = (endians[e] == etl::endian::big);
+
+        etl::byte_stream_writer writer16(storage16.data(), storage16.size(), endians[e]);
+        CHECK(writer16.write(etl::span<uint16_t>(put_data16.data(), put_data16.size())));
+
+        CHECK_EQUAL(is_big ? 0x01 : 0x02, int(storage16[0]));
+        CHECK_EQUAL(is_big ? 0x02 : 0x01, int(storage16[1]));
+        CHECK_EQUAL(is_big ? 0x07 : 0x08, int(storage16[6]));
+        CHECK_EQUAL(is_big ? 0x08 : 0x07, int(storage16[7]));
+
+        etl::byte_stream_writer writer64(storage64.data(), storage64.size(), endians[e]);
+        CHECK(writer64.write(put_data64.data(), put_data64.size()));
+
+        for (size_t i = 0U; i < sizeof(uint64_t); ++i)
+        {
+          CHECK_EQUAL(int(is_big ? (0x01 + i) : (0x08 - i)), int(storage64[i]));
+          CHECK_EQUAL(int(is_big ? (0x11 + i) : (0x18 - i)), int(storage64[i + sizeof(uint64_t)]));
+        }
+
+        etl::byte_stream_reader reader16(storage16.data(), storage16.size(), endians[e]);
+        CHECK(reader16.read<uint16_t>(etl::span<uint16_t>(get_data16.data(), get_data16.size())).has_value());
+        CHECK(put_data16 == get_data16);
+        CHECK(reader16.empty());
+
+        etl::byte_stream_reader reader64(storage64.data(), storage64.size(), endians[e]);
+        CHECK(reader64.read<uint64_t>(get_data64.data(), get_data64.size()).has_value());
+        CHECK(put_data64 == get_data64);
+        CHECK(reader64.empty());
+      }
+    }
+
+    //*************************************************************************
+    TEST(write_read_float_span_range)
+    {
+      std::array<char, 3 * sizeof(double)> storage;
+      std::array<double, 3> put_data = { 3.1415927, -1.0e300, 2.5e-300 };
+      std::array<double, 3> get_data = { 0.0, 0.0, 0.0 };
+
+      const etl::endian endians[] = { etl::endian::big, etl::endian::little };
+
+      for (size_t e = 0U; e < 2U; ++e)
+      {
+        etl::byte_stream_writer writer(storage.data(), storage.size(), endians[e]);
+        CHECK(writer.write(etl::span<double>(put_data.data(), put_data.size())));
+        CHECK_FALSE(writer.write(put_data[0]));
+
+        etl::byte_stream_reader reader(storage.data(), storage.size(), endians[e]);
+        CHECK(reader.read<double>(etl::span<double>(get_data.data(), get_data.size())).has_value());
+
+        // Bit exact.
+        CHECK(memcmp(put_data.data(), get_data.data(), sizeof(put_data)) == 0);
+      }
+    }
+
     //*************************************************************************
     TEST(write_read_multiple_big_endian)
     {
@@ -1336,6 +1405,82 @@ namespace
         CHECK_EQUAL(expected[i], result[i]);
       }
     }
+    //*************************************************************************
+    TEST(write_byte_stream_callback_once_per_range_value)
+    {
+      std::array<char, 8 * sizeof(int32_t)> storage;
+      std::array<int32_t, 4> put_data = { int32_t(0x00000001), int32_t(0xA55AA55A), int32_t(0x5AA55AA5), int32_t(0xFFFFFFFF) };
+      std::vector<char> expected = { char(0x00), char(0x00), char(0x00), char(0x01),
+                                     char(0xA5), char(0x5A), char(0xA5), char(0x5A),
+                                     char(0x5A), char(0xA5), char(0x5A), char(0xA5),
+                                     char(0xFF), char(0xFF), char(0xFF), char(0xFF) };
+
+      static std::vector<char> result;
+      static std::vector<size_t> sizes;
+
+      result.clear();
+      sizes.clear();
+
+      etl::byte_stream_writer::callback_type callback([&](etl::byte_stream_writer::callback_parameter_type sp)
+                                                      {
+                                                        sizes.push_back(sp.size());
+                                                        std::copy(sp.begin(), sp.end(), std::back_inserter(result));
+                                                      });
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+
+      CHECK(writer.write(etl::span<int32_t>(put_data.data(), put_data.size())));
+      CHECK(writer.write(put_data.data(), put_data.size()));
+
+      CHECK_EQUAL(8U, sizes.size());
+
+      for (size_t i = 0U; i < sizes.size(); ++i)
+      {
+        CHECK_EQUAL(sizeof(int32_t), sizes[i]);
+      }
+
+      CHECK_EQUAL(2U * expected.size(), result.size());
+      CHECK(std::equal(expected.begin(), expected.end(), result.begin()));
+      CHECK(std::equal(expected.begin(), expected.end(), result.begin() + expected.size()));
+    }
+
+    //*************************************************************************
+    TEST(write_byte_stream_callback_once_per_batch)
+    {
+      std::array<char, 8 * sizeof(int32_t)> storage;
+      std::array<int32_t, 4> put_data = { int32_t(0x00000001), int32_t(0xA55AA55A), int32_t(0x5AA55AA5), int32_t(0xFFFFFFFF) };
+      std::vector<char> expected = { char(0x00), char(0x00), char(0x00), char(0x01),
+                                     char(0xA5), char(0x5A), char(0xA5), char(0x5A),
+                                     char(0x5A), char(0xA5), char(0x5A), char(0xA5),
+                                     char(0xFF), char(0xFF), char(0xFF), char(0xFF) };
+
+      static std::vector<char> result;
+      static std::vector<size_t> sizes;
+
+      result.clear();
+      sizes.clear();
+
+      etl::byte_stream_writer::callback_type callback([&](etl::byte_stream_writer::callback_parameter_type sp)
+                                                      {
+                                                        sizes.push_back(sp.size());
+                                                        std::copy(sp.begin(), sp.end(), std::back_inserter(result));
+                                                      });
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+
+      CHECK(writer.write_batch(etl::span<int32_t>(put_data.data(), put_data.size())));
+      CHECK(writer.write_batch(put_data.data(), put_data.size()));
+      CHECK(!writer.write_batch(put_data.data(), put_data.size()));
+
+      CHECK_EQUAL(2U, sizes.size());
+      CHECK_EQUAL(4U * sizeof(int32_t), sizes[0]);
+      CHECK_EQUAL(4U * sizeof(int32_t), sizes[1]);
+
+      CHECK_EQUAL(2U * expected.size(), result.size());
+      CHECK(std::equal(expected.begin(), expected.end(), result.begin()));
+      CHECK(std::equal(expected.begin(), expected.end(), result.begin() + expected.size()));
+    }
+
     //*************************************************************************
     TEST(read_byte_stream_skip)
     {
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/correlation.h"
 
 #include <array>
+#include <list>
 
 namespace
 {
@@ -280,5 +281,30 @@ namespace
       covariance_result = correlation3.get_covariance();
       CHECK_CLOSE(9.17, covariance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_correlation_merge)
+    {
+      std::list<float> tail1(input_f.begin() + 4, input_f.end());
+      std::list<float> tail2(input_f_inv.begin() + 4, input_f_inv.end());
+
+      etl::correlation<etl::correlation_type::Sample, float> expected;
+
+      for (size_t i = 0; i < input_f.size(); ++i)
+      {
+        expected.add(input_f[i], input_f_inv[i]);
+      }
+
+      etl::correlation<etl::correlation_type::Sample, float> from_array(input_f.begin(), input_f.end(), input_f_inv.begin());
+      etl::correlation<etl::correlation_type::Sample, float> part1(input_f.begin(), input_f.begin() + 4, input_f_inv.begin());
+      etl::correlation<etl::correlation_type::Sample, float> part2(tail1.begin(), tail1.end(), tail2.begin());
+
+      part1.merge(part2);
+
+      CHECK_EQUAL(input_f.size(), from_array.count());
+      CHECK_EQUAL(input_f.size(), part1.count());
+      CHECK_CLOSE(expected.get_correlation(), from_array.get_correlation(), 0.0001);
+      CHECK_CLOSE(expected.get_correlation(), part1.get_correlation(), 0.0001);
+    }
   };
 }
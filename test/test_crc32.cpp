@@ -29,6 +29,7 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include <iterator>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -258,6 +259,351 @@ namespace
       uint32_t crc3 = etl::crc32_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table size 1024
+    //*************************************************************************
+    TEST(test_crc32_1024)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_t1024(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_1024_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t1024 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_1024_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t1024 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_1024_matches_table_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint32_t expected = etl::crc32_t256(data.begin(), data.begin() + length);
+
+        uint32_t crc_pointer  = etl::crc32_t1024(data.data(), data.data() + length);
+        uint32_t crc_iterator = etl::crc32_t1024(data.begin(), data.begin() + length);
+        uint32_t crc_reverse  = etl::crc32_t1024(data.rbegin() + (data.size() - length), data.rend());
+        uint32_t expected_reverse = etl::crc32_t256(data.rbegin() + (data.size() - length), data.rend());
+
+        CHECK_EQUAL(expected, crc_pointer);
+        CHECK_EQUAL(expected, crc_iterator);
+        CHECK_EQUAL(expected_reverse, crc_reverse);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_1024_add_range_in_parts)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint32_t expected = etl::crc32_t256(data.begin(), data.end());
+
+      etl::crc32_t1024 crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + 13);
+      crc_calculator.add(data[13]);
+      crc_calculator.add(data.data() + 14, data.data() + data.size());
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    // Table size 2048
+    //*************************************************************************
+    TEST(test_crc32_2048)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t2048 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t2048 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_matches_table_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint32_t expected = etl::crc32_t256(data.begin(), data.begin() + length);
+
+        uint32_t crc_pointer  = etl::crc32_t2048(data.data(), data.data() + length);
+        uint32_t crc_iterator = etl::crc32_t2048(data.begin(), data.begin() + length);
+        uint32_t crc_reverse  = etl::crc32_t2048(data.rbegin() + (data.size() - length), data.rend());
+        uint32_t expected_reverse = etl::crc32_t256(data.rbegin() + (data.size() - length), data.rend());
+
+        CHECK_EQUAL(expected, crc_pointer);
+        CHECK_EQUAL(expected, crc_iterator);
+        CHECK_EQUAL(expected_reverse, crc_reverse);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range_in_parts)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint32_t expected = etl::crc32_t256(data.begin(), data.end());
+
+      etl::crc32_t2048 crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + 13);
+      crc_calculator.add(data[13]);
+      crc_calculator.add(data.data() + 14, data.data() + data.size());
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    // Table size 4096
+    //*************************************************************************
+    TEST(test_crc32_4096)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t4096 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t4096 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_matches_table_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint32_t expected = etl::crc32_t256(data.begin(), data.begin() + length);
+
+        uint32_t crc_pointer  = etl::crc32_t4096(data.data(), data.data() + length);
+        uint32_t crc_iterator = etl::crc32_t4096(data.begin(), data.begin() + length);
+        uint32_t crc_reverse  = etl::crc32_t4096(data.rbegin() + (data.size() - length), data.rend());
+        uint32_t expected_reverse = etl::crc32_t256(data.rbegin() + (data.size() - length), data.rend());
+
+        CHECK_EQUAL(expected, crc_pointer);
+        CHECK_EQUAL(expected, crc_iterator);
+        CHECK_EQUAL(expected_reverse, crc_reverse);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range_in_parts)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint32_t expected = etl::crc32_t256(data.begin(), data.end());
+
+      etl::crc32_t4096 crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + 13);
+      crc_calculator.add(data[13]);
+      crc_calculator.add(data.data() + 14, data.data() + data.size());
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    // Combine
+    //*************************************************************************
+    TEST(test_crc32_combine)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      for (size_t split = 0UL; split <= data.size(); ++split)
+      {
+        uint32_t crc_a = etl::crc32(data.begin(), data.begin() + split);
+        uint32_t crc_b = etl::crc32(data.begin() + split, data.end());
+
+        uint32_t crc = etl::crc32::combine(crc_a, crc_b, data.size() - split);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_append)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      etl::crc32 crc_calculator;
+
+      crc_calculator.add(data.begin(), data.begin() + 10);
+      crc_calculator.append(etl::crc32(data.begin() + 10, data.begin() + 50), 40U);
+      crc_calculator.add(data.begin() + 50, data.begin() + 60);
+      crc_calculator.append(etl::crc32(data.begin() + 60, data.end()), 40U);
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_combine_chunks)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 1000UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      const size_t Chunk_Size = 64U;
+      const size_t N_Chunks   = (data.size() + Chunk_Size - 1U) / Chunk_Size;
+
+      std::vector<uint32_t> chunk_crcs(N_Chunks);
+
+      // Calculate the chunks in reverse order, as they are independent.
+      for (size_t i = N_Chunks; i > 0U; --i)
+      {
+        size_t chunk_begin = (i - 1U) * Chunk_Size;
+        size_t chunk_end   = std::min(chunk_begin + Chunk_Size, data.size());
+
+        chunk_crcs[i - 1U] = etl::crc32_t4096(data.data() + chunk_begin, data.data() + chunk_end);
+      }
+
+      uint32_t crc = etl::crc32::combine_chunks(chunk_crcs.data(), N_Chunks, Chunk_Size, data.size());
+
+      CHECK_EQUAL(expected, crc);
+    }
   };
 }
 
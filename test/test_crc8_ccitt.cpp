@@ -258,6 +258,210 @@ namespace
       uint8_t crc3 = etl::crc8_ccitt(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(crc1), int(crc3));
     }
+
+    //*************************************************************************
+    // Table size 1024
+    //*************************************************************************
+    TEST(test_crc8_ccitt_1024)
+    {
+      std::string data("123456789");
+
+      uint8_t crc = etl::crc8_ccitt_t1024(data.begin(), data.end());
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_1024_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc8_ccitt_t1024 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint8_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_1024_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc8_ccitt_t1024 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint8_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_1024_matches_table_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint8_t expected = etl::crc8_ccitt_t256(data.begin(), data.begin() + length);
+
+        uint8_t crc_pointer  = etl::crc8_ccitt_t1024(data.data(), data.data() + length);
+        uint8_t crc_iterator = etl::crc8_ccitt_t1024(data.begin(), data.begin() + length);
+        uint8_t crc_reverse  = etl::crc8_ccitt_t1024(data.rbegin() + (data.size() - length), data.rend());
+        uint8_t expected_reverse = etl::crc8_ccitt_t256(data.rbegin() + (data.size() - length), data.rend());
+
+        CHECK_EQUAL(int(expected), int(crc_pointer));
+        CHECK_EQUAL(int(expected), int(crc_iterator));
+        CHECK_EQUAL(int(expected_reverse), int(crc_reverse));
+      }
+    }
+
+    //*************************************************************************
+    // Table size 2048
+    //*************************************************************************
+    TEST(test_crc8_ccitt_2048)
+    {
+      std::string data("123456789");
+
+      uint8_t crc = etl::crc8_ccitt_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_2048_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc8_ccitt_t2048 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint8_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_2048_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc8_ccitt_t2048 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint8_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_2048_matches_table_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint8_t expected = etl::crc8_ccitt_t256(data.begin(), data.begin() + length);
+
+        uint8_t crc_pointer  = etl::crc8_ccitt_t2048(data.data(), data.data() + length);
+        uint8_t crc_iterator = etl::crc8_ccitt_t2048(data.begin(), data.begin() + length);
+        uint8_t crc_reverse  = etl::crc8_ccitt_t2048(data.rbegin() + (data.size() - length), data.rend());
+        uint8_t expected_reverse = etl::crc8_ccitt_t256(data.rbegin() + (data.size() - length), data.rend());
+
+        CHECK_EQUAL(int(expected), int(crc_pointer));
+        CHECK_EQUAL(int(expected), int(crc_iterator));
+        CHECK_EQUAL(int(expected_reverse), int(crc_reverse));
+      }
+    }
+
+    //*************************************************************************
+    // Table size 4096
+    //*************************************************************************
+    TEST(test_crc8_ccitt_4096)
+    {
+      std::string data("123456789");
+
+      uint8_t crc = etl::crc8_ccitt_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_4096_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc8_ccitt_t4096 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint8_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_4096_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc8_ccitt_t4096 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint8_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xF4U, int(crc));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_4096_matches_table_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint8_t expected = etl::crc8_ccitt_t256(data.begin(), data.begin() + length);
+
+        uint8_t crc_pointer  = etl::crc8_ccitt_t4096(data.data(), data.data() + length);
+        uint8_t crc_iterator = etl::crc8_ccitt_t4096(data.begin(), data.begin() + length);
+        uint8_t crc_reverse  = etl::crc8_ccitt_t4096(data.rbegin() + (data.size() - length), data.rend());
+        uint8_t expected_reverse = etl::crc8_ccitt_t256(data.rbegin() + (data.size() - length), data.rend());
+
+        CHECK_EQUAL(int(expected), int(crc_pointer));
+        CHECK_EQUAL(int(expected), int(crc_iterator));
+        CHECK_EQUAL(int(expected_reverse), int(crc_reverse));
+      }
+    }
   };
 }
 
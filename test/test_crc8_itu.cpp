@@ -29,6 +29,7 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include <iterator>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -258,6 +259,84 @@ namespace
       uint8_t crc3 = etl::crc8_itu(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(crc1), int(crc3));
     }
+
+    //*************************************************************************
+    // Combine
+    //*************************************************************************
+    TEST(test_crc8_itu_combine)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint8_t expected = etl::crc8_itu(data.begin(), data.end());
+
+      for (size_t split = 0UL; split <= data.size(); ++split)
+      {
+        uint8_t crc_a = etl::crc8_itu(data.begin(), data.begin() + split);
+        uint8_t crc_b = etl::crc8_itu(data.begin() + split, data.end());
+
+        uint8_t crc = etl::crc8_itu::combine(crc_a, crc_b, data.size() - split);
+
+        CHECK_EQUAL(int(expected), int(crc));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_itu_append)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 100UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint8_t expected = etl::crc8_itu(data.begin(), data.end());
+
+      etl::crc8_itu crc_calculator;
+
+      crc_calculator.add(data.begin(), data.begin() + 10);
+      crc_calculator.append(etl::crc8_itu(data.begin() + 10, data.begin() + 50), 40U);
+      crc_calculator.add(data.begin() + 50, data.begin() + 60);
+      crc_calculator.append(etl::crc8_itu(data.begin() + 60, data.end()), 40U);
+
+      CHECK_EQUAL(int(expected), int(crc_calculator.value()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_itu_combine_chunks)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 1000UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      uint8_t expected = etl::crc8_itu(data.begin(), data.end());
+
+      const size_t Chunk_Size = 64U;
+      const size_t N_Chunks   = (data.size() + Chunk_Size - 1U) / Chunk_Size;
+
+      std::vector<uint8_t> chunk_crcs(N_Chunks);
+
+      // Calculate the chunks in reverse order, as they are independent.
+      for (size_t i = N_Chunks; i > 0U; --i)
+      {
+        size_t chunk_begin = (i - 1U) * Chunk_Size;
+        size_t chunk_end   = std::min(chunk_begin + Chunk_Size, data.size());
+
+        chunk_crcs[i - 1U] = etl::crc8_itu_t4096(data.data() + chunk_begin, data.data() + chunk_end);
+      }
+
+      uint8_t crc = etl::crc8_itu::combine_chunks(chunk_crcs.data(), N_Chunks, Chunk_Size, data.size());
+
+      CHECK_EQUAL(int(expected), int(crc));
+    }
   };
 }
 
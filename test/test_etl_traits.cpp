@@ -48,6 +48,9 @@ namespace
       CHECK_EQUAL((ETL_USING_CPP17 == 1),                      etl::traits::using_cpp17);
       CHECK_EQUAL((ETL_USING_CPP20 == 1),                      etl::traits::using_cpp20);
       CHECK_EQUAL((ETL_USING_EXCEPTIONS == 1),                 etl::traits::using_exceptions);
+      CHECK_EQUAL((ETL_USING_SSE2 == 1),                       etl::traits::using_sse2);
+      CHECK_EQUAL((ETL_USING_SSE42 == 1),                      etl::traits::using_sse42);
+      CHECK_EQUAL((ETL_USING_AVX2 == 1),                       etl::traits::using_avx2);
       CHECK_EQUAL((ETL_USING_GCC_COMPILER == 1),               etl::traits::using_gcc_compiler);
       CHECK_EQUAL((ETL_USING_MICROSOFT_COMPILER == 1),         etl::traits::using_microsoft_compiler);
       CHECK_EQUAL((ETL_USING_ARM5_COMPILER == 1),              etl::traits::using_arm5_compiler);
@@ -35,6 +35,7 @@ SOFTWARE.
 #include <array>
 #include <algorithm>
 #include <map>
+#include <vector>
 
 namespace
 {
@@ -376,5 +377,132 @@ namespace
       isEqual = std::equal(output2.begin(), output2.end(), histogram.begin());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_int_histogram_range_matches_single_values)
+    {
+      // Mostly one key, as in a latency distribution.
+      std::vector<int32_t> input;
+
+      for (int32_t i = 0; i < 1001; ++i)
+      {
+        input.push_back(((i % 4) == 0) ? ((i * 37) % 64) : 5);
+      }
+
+      // Small enough to be counted in interleaved sub-histograms.
+      etl::histogram<int32_t, uint32_t, 64, 0> small_expected;
+      etl::histogram<int32_t, uint32_t, 64, 0> small(input.begin(), input.end());
+
+      // Too large for interleaved sub-histograms.
+      etl::histogram<int32_t, uint32_t, 1000> large_expected(-500);
+      etl::histogram<int32_t, uint32_t, 1000> large(-500, input.begin(), input.end());
+
+      for (size_t i = 0; i < input.size(); ++i)
+      {
+        small_expected.add(input[i]);
+        large_expected.add(input[i]);
+      }
+
+      CHECK_EQUAL(input.size(), small.count());
+      CHECK(std::equal(small_expected.begin(), small_expected.end(), small.begin()));
+
+      CHECK_EQUAL(input.size(), large.count());
+      CHECK(std::equal(large_expected.begin(), large_expected.end(), large.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_int_histogram_merge)
+    {
+      IntOffsetminus4Histogram histogram1(input2.begin(), input2.begin() + 20);
+      IntOffsetminus4Histogram histogram2(input2.begin() + 20, input2.end());
+
+      histogram1.merge(histogram2);
+
+      CHECK_EQUAL(55U, histogram1.count());
+      CHECK(std::equal(output1.begin(), output1.end(), histogram1.begin()));
+
+      IntRuntimeOffsetHistogram histogram3(Start, input2.begin(), input2.begin() + 30);
+      IntRuntimeOffsetHistogram histogram4(Start, input2.begin() + 30, input2.end());
+
+      histogram3 += histogram4;
+
+      CHECK_EQUAL(55U, histogram3.count());
+      CHECK(std::equal(output1.begin(), output1.end(), histogram3.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_int_runtime_offset_histogram_copy)
+    {
+      IntRuntimeOffsetHistogram histogram1(Start, input2.begin(), input2.end());
+      IntRuntimeOffsetHistogram histogram2(histogram1);
+      IntRuntimeOffsetHistogram histogram3(0);
+
+      histogram3 = histogram1;
+
+      for (int i = Start; i < int(Start + Size); ++i)
+      {
+        CHECK_EQUAL(int(histogram1[i]), int(histogram2[i]));
+        CHECK_EQUAL(int(histogram1[i]), int(histogram3[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_int_histogram_quantile)
+    {
+      // Key k has a count of k + 1, for 55 in all.
+      IntOffset0Histogram histogram(input1.begin(), input1.end());
+
+      CHECK_EQUAL(0, histogram.quantile(0.0));
+      CHECK_EQUAL(0, histogram.quantile(1.0 / 55.0));
+      CHECK_EQUAL(1, histogram.quantile(2.0 / 55.0));
+      CHECK_EQUAL(6, histogram.quantile(0.5));
+      CHECK_EQUAL(9, histogram.quantile(1.0));
+      CHECK_EQUAL(6, histogram.percentile(50.0));
+      CHECK_EQUAL(9, histogram.percentile(99.0));
+
+      IntOffsetminus4Histogram histogram_offset(input2.begin(), input2.end());
+      CHECK_EQUAL(2, histogram_offset.quantile(0.5));
+
+      IntRuntimeOffsetHistogram histogram_runtime(Start, input2.begin(), input2.end());
+      CHECK_EQUAL(2, histogram_runtime.quantile(0.5));
+
+      IntRuntimeOffsetHistogram histogram_empty(Start);
+      CHECK_EQUAL(Start, histogram_empty.quantile(0.5));
+    }
+
+    //*************************************************************************
+    TEST(test_string_histogram_iterators)
+    {
+      StringHistogram histogram(input3.begin(), input3.end());
+
+      CHECK_EQUAL(Size, size_t(std::distance(histogram.begin(), histogram.end())));
+      CHECK_EQUAL(Size, size_t(std::distance(histogram.cbegin(), histogram.cend())));
+    }
+
+    //*************************************************************************
+    TEST(test_string_histogram_merge)
+    {
+      StringHistogram histogram1(input3.begin(), input3.begin() + 20);
+      StringHistogram histogram2(input3.begin() + 20, input3.end());
+
+      histogram1 += histogram2;
+
+      CHECK_EQUAL(Size, histogram1.size());
+      CHECK_EQUAL(55U,  histogram1.count());
+      CHECK(std::equal(output2.begin(), output2.end(), histogram1.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_string_histogram_quantile)
+    {
+      StringHistogram histogram(input3.begin(), input3.end());
+
+      CHECK_EQUAL(std::string("0"), histogram.quantile(0.0));
+      CHECK_EQUAL(std::string("6"), histogram.quantile(0.5));
+      CHECK_EQUAL(std::string("9"), histogram.percentile(100.0));
+
+      StringHistogram histogram_empty;
+      CHECK_EQUAL(std::string(), histogram_empty.quantile(0.5));
+    }
   };
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/mean.h"
 
 #include <array>
+#include <list>
 
 namespace
 {
@@ -112,5 +113,29 @@ namespace
       mean_result = mean1.get_mean();
       CHECK_CLOSE(4.5, mean_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_mean_merge)
+    {
+      std::list<float> tail(input_f.begin() + 4, input_f.end());
+
+      etl::mean<float> expected;
+
+      for (size_t i = 0; i < input_f.size(); ++i)
+      {
+        expected.add(input_f[i]);
+      }
+
+      etl::mean<float> from_array(input_f.begin(), input_f.end());
+      etl::mean<float> part1(input_f.begin(), input_f.begin() + 4);
+      etl::mean<float> part2(tail.begin(), tail.end());
+
+      part1.merge(part2);
+
+      CHECK_EQUAL(input_f.size(), from_array.count());
+      CHECK_EQUAL(input_f.size(), part1.count());
+      CHECK_CLOSE(expected.get_mean(), from_array.get_mean(), 0.0001);
+      CHECK_CLOSE(expected.get_mean(), part1.get_mean(), 0.0001);
+    }
   };
 }
@@ -30,10 +30,15 @@ SOFTWARE.
 
 #include "etl/message_router.h"
 #include "etl/message_bus.h"
+#include "etl/message_broker.h"
 #include "etl/queue.h"
 #include "etl/largest.h"
 #include "etl/packet.h"
 
+#include <deque>
+#include <initializer_list>
+#include <vector>
+
 //***************************************************************************
 // The set of messages.
 //***************************************************************************
@@ -242,22 +247,29 @@ namespace
   public:
 
     RouterC(etl::message_router_id_t id)
-      : message_router(id)
+      : message_router(id),
+        message6_count(0),
+        message_unknown_count(0)
     {
     }
 
     void on_receive(const Message6&)
     {
+      ++message6_count;
     }
 
     void on_receive_unknown(const etl::imessage&)
     {
+      ++message_unknown_count;
     }
+
+    int message6_count;
+    int message_unknown_count;
   };
 
   //***************************************************************************
-  template <size_t Size>
-  class MessageBus : public etl::message_bus<Size>
+  template <size_t Size, size_t Indexed_Ids = 0U>
+  class MessageBus : public etl::message_bus<Size, Indexed_Ids>
   {
   public:
 
@@ -266,18 +278,37 @@ namespace
     {
     }
 
-    using etl::message_bus<Size>::receive;
+    using etl::message_bus<Size, Indexed_Ids>::receive;
 
     // Hook 'receive' to count the incoming messages.
     void receive(etl::message_router_id_t id, const etl::imessage& msg)
     {
       ++message_count;
-      etl::message_bus<Size>::receive(id, msg);
+      etl::message_bus<Size, Indexed_Ids>::receive(id, msg);
     }
 
     int message_count;
   };
 
+  //***************************************************************************
+  class Subscription : public etl::message_broker::subscription
+  {
+  public:
+
+    Subscription(etl::imessage_router& router, std::initializer_list<etl::message_id_t> init)
+      : etl::message_broker::subscription(router)
+      , id_list(init)
+    {
+    }
+
+    virtual etl::message_broker::message_id_span_t message_id_list() const
+    {
+      return etl::message_broker::message_id_span_t(id_list.data(), id_list.data() + id_list.size());
+    }
+
+    std::vector<etl::message_id_t> id_list;
+  };
+
   SUITE(test_message_bus)
   {
     //*************************************************************************
@@ -843,6 +874,175 @@ namespace
       CHECK_EQUAL(1, bus3.message_count);
     }
 
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_order)
+    {
+      MessageBus<4, 8> bus1;
+      MessageBus<2, 8> bus2;
+      MessageBus<2>    bus3;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA router4a(ROUTER4);
+      RouterA router4b(ROUTER4);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus3);
+      bus1.subscribe(bus2);
+      bus1.subscribe(router2);
+
+      // Subscribed after the parent bus built its index.
+      bus2.subscribe(router3);
+      bus3.subscribe(router4b);
+      bus3.subscribe(router4a);
+
+      Message1 message1(callback);
+
+      call_order = 0;
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router2.order);
+      CHECK_EQUAL(2, router4b.order);
+      CHECK_EQUAL(3, router4a.order);
+      CHECK_EQUAL(4, router3.order);
+
+      CHECK_EQUAL(1, bus1.message_count);
+      CHECK_EQUAL(1, bus2.message_count);
+      CHECK_EQUAL(1, bus3.message_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_many_routers)
+    {
+      const size_t Routers = 40U;
+
+      MessageBus<Routers + 1U, 8> bus;
+
+      std::deque<RouterA> routers_a;
+      std::deque<RouterB> routers_b;
+
+      RouterA callback(ROUTER5);
+      RouterC router_c(ROUTER1);
+
+      for (size_t i = 0U; i < (Routers / 2U); ++i)
+      {
+        routers_a.emplace_back(etl::message_router_id_t(i));
+        routers_b.emplace_back(etl::message_router_id_t(i));
+        bus.subscribe(routers_a.back());
+        bus.subscribe(routers_b.back());
+      }
+
+      bus.subscribe(router_c);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+      Message6 message6;
+      Message7 message7;
+
+      bus.receive(message1);
+      bus.receive(message3);
+      bus.receive(message6);
+      bus.receive(message7);
+
+      for (size_t i = 0U; i < (Routers / 2U); ++i)
+      {
+        CHECK_EQUAL(1, routers_a[i].message1_count);
+        CHECK_EQUAL(1, routers_a[i].message3_count);
+        CHECK_EQUAL(0, routers_a[i].message_unknown_count);
+        CHECK_EQUAL(1, routers_b[i].message1_count);
+        CHECK_EQUAL(0, routers_b[i].message_unknown_count);
+      }
+
+      CHECK_EQUAL(1, router_c.message6_count);
+      CHECK_EQUAL(0, router_c.message_unknown_count);
+      CHECK_EQUAL(int(Routers + (Routers / 2U)), callback.message5_count);
+
+      CHECK(bus.accepts(MESSAGE1));
+      CHECK(bus.accepts(MESSAGE6));
+      CHECK(!bus.accepts(MESSAGE7));
+
+      // Unsubscribing rebuilds the index.
+      bus.unsubscribe(router_c);
+      bus.receive(message6);
+      CHECK_EQUAL(1, router_c.message6_count);
+      CHECK(!bus.accepts(MESSAGE6));
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_rebuild_index)
+    {
+      MessageBus<2, 8> bus;
+
+      RouterC router_c(ROUTER1);
+      RouterA router_a(ROUTER2);
+      RouterA callback(ROUTER5);
+
+      bus.subscribe(router_c);
+
+      Message1 message1(callback);
+
+      bus.receive(message1);
+      CHECK_EQUAL(0, router_a.message1_count);
+
+      // The ids accepted by router_c change when it gets a successor.
+      router_c.set_successor(router_a);
+      bus.receive(message1);
+      CHECK_EQUAL(0, router_a.message1_count);
+
+      bus.rebuild_index();
+      bus.receive(message1);
+      CHECK_EQUAL(1, router_a.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_numbered_broker)
+    {
+      MessageBus<3, 8> bus;
+
+      etl::message_broker broker(ROUTER2);
+
+      RouterC router1(ROUTER1);
+      RouterA router3(ROUTER3);
+      RouterA router4(ROUTER4);
+      RouterA callback(ROUTER5);
+
+      bus.subscribe(router1);
+      bus.subscribe(broker);
+
+      CHECK(!bus.accepts(MESSAGE1));
+
+      // Subscribed after the bus built its index.
+      Subscription subscription{ router4, { MESSAGE1 } };
+      broker.subscribe(subscription);
+
+      CHECK(bus.accepts(MESSAGE1));
+      CHECK(!bus.accepts(MESSAGE2));
+
+      bus.subscribe(router3);
+
+      Message1 message1(callback);
+      Message2 message2(callback);
+
+      call_order = 0;
+
+      bus.receive(message1);
+      bus.receive(message2);
+
+      CHECK_EQUAL(1, router4.message1_count);
+      CHECK_EQUAL(0, router4.message2_count);
+      CHECK_EQUAL(1, router3.message1_count);
+      CHECK_EQUAL(1, router3.message2_count);
+
+      // The broker keeps its place in the router id order.
+      CHECK_EQUAL(0, router4.order);
+      CHECK_EQUAL(1, router3.order);
+    }
+
     //*************************************************************************
     TEST(message_bus_broadcast_addressed_successor_bus)
     {
@@ -32,6 +32,8 @@ SOFTWARE.
 #include "etl/queue.h"
 #include "etl/largest.h"
 
+#include <utility>
+
 //***************************************************************************
 // The set of messages.
 //***************************************************************************
@@ -255,6 +257,81 @@ namespace
 
   etl::imessage_router* p_router;
 
+  //***************************************************************************
+  // Messages and router for sparse message ids.
+  //***************************************************************************
+  template <etl::message_id_t Id>
+  struct SparseMessage : public etl::message<Id>
+  {
+  };
+
+  typedef SparseMessage<10>  SparseMessage10;
+  typedef SparseMessage<100> SparseMessage100;
+  typedef SparseMessage<200> SparseMessage200;
+
+  class SparseRouter : public etl::message_router<SparseRouter, SparseMessage10, SparseMessage100, SparseMessage200>
+  {
+  public:
+
+    SparseRouter()
+      : message_router(ROUTER3)
+      , message10_count(0)
+      , message100_count(0)
+      , message200_count(0)
+      , message_unknown_count(0)
+    {
+    }
+
+    void on_receive(const SparseMessage10&)  { ++message10_count; }
+    void on_receive(const SparseMessage100&) { ++message100_count; }
+    void on_receive(const SparseMessage200&) { ++message200_count; }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int message10_count;
+    int message100_count;
+    int message200_count;
+    int message_unknown_count;
+  };
+
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  //***************************************************************************
+  // Router for more message types than the generated routers allow.
+  //***************************************************************************
+  template <typename TIds>
+  class WideRouter;
+
+  template <size_t... Index>
+  class WideRouter<std::index_sequence<Index...>>
+    : public etl::message_router<WideRouter<std::index_sequence<Index...>>, SparseMessage<etl::message_id_t(20U + Index)>...>
+  {
+  public:
+
+    WideRouter()
+      : counts()
+      , message_unknown_count(0)
+    {
+    }
+
+    template <etl::message_id_t Id>
+    void on_receive(const SparseMessage<Id>&)
+    {
+      ++counts[Id - 20U];
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int counts[sizeof...(Index)];
+    int message_unknown_count;
+  };
+#endif
+
   SUITE(test_message_router)
   {
     //*************************************************************************
@@ -505,6 +582,100 @@ namespace
       CHECK(r2.accepts(message5.get_message_id()));
     }
 
+    //*************************************************************************
+    TEST(message_router_sparse_ids)
+    {
+      SparseRouter router;
+
+      SparseMessage10  message10;
+      SparseMessage100 message100;
+      SparseMessage200 message200;
+      SparseMessage<0>   message0;
+      SparseMessage<11>  message11;
+      SparseMessage<150> message150;
+      SparseMessage<255> message255;
+
+      etl::imessage_router& irouter = router;
+
+      irouter.receive(message10);
+      irouter.receive(message100);
+      irouter.receive(message100);
+      irouter.receive(message200);
+      irouter.receive(message0);
+      irouter.receive(message11);
+      irouter.receive(message150);
+      irouter.receive(message255);
+
+      CHECK_EQUAL(1, router.message10_count);
+      CHECK_EQUAL(2, router.message100_count);
+      CHECK_EQUAL(1, router.message200_count);
+      CHECK_EQUAL(4, router.message_unknown_count);
+
+      CHECK(router.accepts(10));
+      CHECK(router.accepts(100));
+      CHECK(router.accepts(200));
+
+      for (int id = 0; id < 256; ++id)
+      {
+        if ((id != 10) && (id != 100) && (id != 200))
+        {
+          CHECK(!router.accepts(etl::message_id_t(id)));
+        }
+      }
+    }
+
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(message_router_dispatch_table_selection)
+    {
+      typedef void (*handler_t)();
+
+      typedef etl::private_message_router::dispatch_table<handler_t, 1, 2, 3, 5, 4> dense_t;
+      typedef etl::private_message_router::dispatch_table<handler_t, 10, 100, 200> sparse_t;
+      typedef etl::private_message_router::dispatch_table<handler_t> empty_t;
+
+      CHECK_TRUE(dense_t::Is_Dense);
+      CHECK_TRUE(dense_t::Is_Valid);
+      CHECK_EQUAL(5U, dense_t::Size);
+
+      CHECK_FALSE(sparse_t::Is_Dense);
+      CHECK_TRUE(sparse_t::Is_Valid);
+
+      CHECK_FALSE(empty_t::Is_Valid);
+    }
+
+    //*************************************************************************
+    TEST(message_router_many_message_types)
+    {
+      WideRouter<std::make_index_sequence<40>> router;
+
+      etl::imessage_router& irouter = router;
+
+      SparseMessage<19> message19;
+      SparseMessage<20> message20;
+      SparseMessage<35> message35;
+      SparseMessage<59> message59;
+      SparseMessage<60> message60;
+
+      irouter.receive(message19);
+      irouter.receive(message20);
+      irouter.receive(message35);
+      irouter.receive(message35);
+      irouter.receive(message59);
+      irouter.receive(message60);
+
+      CHECK_EQUAL(1, router.counts[0]);
+      CHECK_EQUAL(2, router.counts[15]);
+      CHECK_EQUAL(1, router.counts[39]);
+      CHECK_EQUAL(2, router.message_unknown_count);
+
+      for (int id = 0; id < 256; ++id)
+      {
+        CHECK_EQUAL((id >= 20) && (id < 60), router.accepts(etl::message_id_t(id)));
+      }
+    }
+#endif
+
 #if ETL_HAS_VIRTUAL_MESSAGES
     //*************************************************************************
     TEST(message_router_queue)
@@ -0,0 +1,515 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <set>
+#include <string>
+
+#include "etl/pool_atomic.h"
+#include "etl/largest.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC && ETL_USING_64BIT_TYPES
+
+typedef TestDataDC<std::string> Test_Data;
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, const std::string& b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    std::string a;
+    std::string b;
+  };
+
+  SUITE(test_pool_atomic)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = nullptr;
+      Test_Data* p2 = nullptr;
+      Test_Data* p3 = nullptr;
+      Test_Data* p4 = nullptr;
+
+      CHECK_NO_THROW(p1 = pool.allocate());
+      CHECK_NO_THROW(p2 = pool.allocate());
+      CHECK_NO_THROW(p3 = pool.allocate());
+      CHECK_NO_THROW(p4 = pool.allocate());
+
+      CHECK(p1 != p2);
+      CHECK(p1 != p3);
+      CHECK(p1 != p4);
+      CHECK(p2 != p3);
+      CHECK(p2 != p4);
+      CHECK(p3 != p4);
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_try_allocate)
+    {
+      etl::pool_atomic<Test_Data, 2> pool;
+
+      Test_Data* p1 = pool.try_allocate<Test_Data>();
+      Test_Data* p2 = pool.try_allocate<Test_Data>();
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p1 != p2);
+
+      Test_Data* p3 = nullptr;
+      CHECK_NO_THROW(p3 = pool.try_allocate<Test_Data>());
+      CHECK(p3 == nullptr);
+      CHECK_EQUAL(2U, pool.size());
+
+      pool.release(p1);
+      CHECK(pool.try_allocate<Test_Data>() == p1);
+    }
+
+    //*************************************************************************
+    TEST(test_release)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+      Test_Data* p4 = pool.allocate();
+
+      CHECK_NO_THROW(pool.release(p2));
+      CHECK_NO_THROW(pool.release(p3));
+      CHECK_NO_THROW(pool.release(p1));
+      CHECK_NO_THROW(pool.release(p4));
+
+      CHECK_EQUAL(4U, pool.available());
+
+      CHECK_THROW(pool.release(p4), etl::pool_no_allocation);
+      CHECK_EQUAL(4U, pool.available());
+
+      Test_Data not_in_pool;
+
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+      Test_Data* p4 = pool.allocate();
+
+      CHECK_EQUAL(0U, pool.available());
+      CHECK(pool.full());
+
+      pool.release(p2);
+      pool.release(p3);
+
+      CHECK_EQUAL(2U, pool.available());
+
+      // The most recently released is allocated first.
+      Test_Data* p5 = pool.allocate();
+      Test_Data* p6 = pool.allocate();
+
+      CHECK(p5 == p3);
+      CHECK(p6 == p2);
+      CHECK(pool.full());
+
+      pool.release(p1);
+      pool.release(p4);
+      pool.release(p5);
+      pool.release(p6);
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_release_all)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      pool.allocate();
+      pool.allocate();
+      pool.release(pool.allocate());
+
+      pool.release_all();
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(4U, pool.available());
+
+      std::set<Test_Data*> items;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        items.insert(pool.allocate());
+      }
+
+      CHECK_EQUAL(4U, items.size());
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_is_in_pool)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+      Test_Data not_in_pool;
+
+      Test_Data* p1 = pool.allocate();
+
+      CHECK(pool.is_in_pool(p1));
+      CHECK(!pool.is_in_pool(&not_in_pool));
+    }
+
+    //*************************************************************************
+    TEST(test_type_error)
+    {
+      struct Object
+      {
+        uint64_t a;
+        uint64_t b;
+      };
+
+      etl::pool_atomic<uint32_t, 4> pool;
+
+      etl::ipool_atomic& ip = pool;
+
+      CHECK_THROW(ip.allocate<Object>(), etl::pool_element_size);
+    }
+
+    //*************************************************************************
+    TEST(test_generic_allocate)
+    {
+      typedef etl::largest<uint8_t, uint32_t, double, Test_Data> largest;
+
+      etl::generic_pool_atomic<largest::size, largest::alignment, 4> pool;
+
+      uint8_t*   p1 = nullptr;
+      uint32_t*  p2 = nullptr;
+      double*    p3 = nullptr;
+      Test_Data* p4 = nullptr;
+
+      CHECK_NO_THROW(p1 = pool.allocate<uint8_t>());
+      CHECK_NO_THROW(p2 = pool.allocate<uint32_t>());
+      CHECK_NO_THROW(p3 = pool.allocate<double>());
+      CHECK_NO_THROW(p4 = pool.allocate<Test_Data>());
+
+      CHECK(pool.full());
+
+      pool.release(p1);
+      pool.release(p2);
+      pool.release(p3);
+      pool.release(p4);
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::pool_atomic<D2, 4> pool;
+
+      D2* p = pool.create("1", "2");
+
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(std::string("2"), p->b);
+
+      pool.destroy(p);
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_allocate_release)
+    {
+      etl::pool_atomic<Test_Data, 10> pool;
+      etl::pool_atomic_cache<4> cache(pool);
+
+      CHECK(cache.empty());
+      CHECK_EQUAL(4U, cache.capacity());
+
+      // Takes a batch of 2 from the pool.
+      Test_Data* p1 = cache.allocate<Test_Data>();
+
+      CHECK_EQUAL(1U, cache.size());
+      CHECK_EQUAL(2U, pool.size());
+
+      Test_Data* p2 = cache.allocate<Test_Data>();
+
+      CHECK(cache.empty());
+      CHECK_EQUAL(2U, pool.size());
+
+      // Takes another batch.
+      Test_Data* p3 = cache.allocate<Test_Data>();
+
+      CHECK_EQUAL(1U, cache.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      cache.release(p1);
+      cache.release(p2);
+      cache.release(p3);
+
+      CHECK_EQUAL(4U, cache.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      // The cache is full, so a batch of 2 goes back to the pool.
+      Test_Data* p4 = pool.allocate();
+      cache.release(p4);
+
+      CHECK_EQUAL(3U, cache.size());
+      CHECK_EQUAL(3U, pool.size());
+
+      cache.flush();
+
+      CHECK(cache.empty());
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_destructor_returns_items)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      {
+        etl::pool_atomic_cache<4> cache(pool);
+
+        cache.release(cache.allocate<Test_Data>());
+
+        CHECK_EQUAL(2U, pool.size());
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_create_destroy)
+    {
+      etl::pool_atomic<D2, 4> pool;
+      etl::pool_atomic_cache<2> cache(pool);
+
+      D2* p = cache.create<D2>("1", "2");
+
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(std::string("2"), p->b);
+
+      cache.destroy(p);
+      cache.flush();
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_errors)
+    {
+      etl::pool_atomic<uint32_t, 2> pool;
+      etl::pool_atomic_cache<4> cache(pool);
+
+      uint32_t* p1 = cache.allocate<uint32_t>();
+      uint32_t* p2 = cache.allocate<uint32_t>();
+
+      CHECK(p1 != p2);
+      CHECK_THROW(cache.allocate<uint32_t>(), etl::pool_no_allocation);
+      CHECK_THROW(cache.allocate<uint64_t>(), etl::pool_element_size);
+
+      uint32_t not_in_pool;
+
+      CHECK_THROW(cache.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_cache_items_released_to_another_cache)
+    {
+      etl::pool_atomic<Test_Data, 8> pool;
+      etl::pool_atomic_cache<4> cache1(pool);
+      etl::pool_atomic_cache<4> cache2(pool);
+
+      std::vector<Test_Data*> items;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        items.push_back(cache1.allocate<Test_Data>());
+      }
+
+      CHECK(pool.full());
+
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        cache2.release(items[i]);
+      }
+
+      cache1.flush();
+      cache2.flush();
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads)
+    {
+      static const int N_THREADS = 4;
+      static const int N_LOOPS   = 20000;
+      static const int N_HELD    = 8; // Per thread.
+
+      etl::pool_atomic<int, N_THREADS * N_HELD> pool;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  errors(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        threads.push_back(std::thread([&pool, &start, &errors, t]()
+        {
+          while (!start.load());
+
+          int* held[N_HELD];
+
+          for (int i = 0; i < N_LOOPS; ++i)
+          {
+            // Each thread stamps its items, so that an item handed to two threads at once is seen.
+            for (int h = 0; h < N_HELD; ++h)
+            {
+              held[h] = pool.allocate();
+
+              if (held[h] == nullptr)
+              {
+                ++errors;
+                return;
+              }
+
+              *held[h] = (t * N_HELD) + h;
+            }
+
+            for (int h = 0; h < N_HELD; ++h)
+            {
+              if (*held[h] != ((t * N_HELD) + h))
+              {
+                ++errors;
+              }
+
+              pool.release(held[h]);
+            }
+          }
+        }));
+      }
+
+      start.store(true);
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0, errors.load());
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads_with_caches)
+    {
+      static const int N_THREADS = 4;
+      static const int N_LOOPS   = 20000;
+      static const int N_HELD    = 8; // Per thread.
+
+      // Room for the items held, plus a full cache per thread.
+      etl::pool_atomic<int, N_THREADS * (N_HELD + 8)> pool;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  errors(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        threads.push_back(std::thread([&pool, &start, &errors, t]()
+        {
+          etl::pool_atomic_cache<8> cache(pool);
+
+          while (!start.load());
+
+          int* held[N_HELD];
+
+          for (int i = 0; i < N_LOOPS; ++i)
+          {
+            for (int h = 0; h < N_HELD; ++h)
+            {
+              held[h] = cache.allocate<int>();
+
+              if (held[h] == nullptr)
+              {
+                ++errors;
+                return;
+              }
+
+              *held[h] = (t * N_HELD) + h;
+            }
+
+            for (int h = 0; h < N_HELD; ++h)
+            {
+              if (*held[h] != ((t * N_HELD) + h))
+              {
+                ++errors;
+              }
+
+              cache.release(held[h]);
+            }
+          }
+        }));
+      }
+
+      start.store(true);
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0, errors.load());
+      CHECK(pool.empty());
+    }
+  };
+}
+
+#endif
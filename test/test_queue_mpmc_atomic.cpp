@@ -0,0 +1,499 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+        b(b_),
+        c(c_),
+        d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+        b(0),
+        c(0),
+        d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(4U, queue.available());
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 5> queue;
+
+      queue.emplace();
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(5U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(0, 0, 0, 0));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      iqueue.push(2);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      iqueue.push(3);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_void)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop());
+      CHECK(!queue.pop());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_smallest_size_fill_and_empty)
+    {
+      etl::queue_mpmc_atomic<int, 2> queue;
+
+      for (int lap = 0; lap < 4; ++lap)
+      {
+        CHECK(queue.push(1));
+        CHECK(queue.push(2));
+        CHECK(queue.full());
+        CHECK(!queue.push(3));
+        CHECK_EQUAL(2U, queue.size());
+
+        int value;
+
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(1, value);
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(2, value);
+        CHECK(queue.empty());
+        CHECK(!queue.pop(value));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::queue_mpmc_atomic<int, 3, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      // More laps than the small memory model's size_type can count.
+      for (int i = 0; i < 1000; ++i)
+      {
+        CHECK(queue.push(next_push++));
+        CHECK(queue.push(next_push++));
+
+        int value;
+
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(next_pop++, value);
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(next_pop++, value);
+
+        CHECK(queue.empty());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers_and_consumers)
+    {
+      static const int N_PRODUCERS = 4;
+      static const int N_CONSUMERS = 4;
+      static const int N_ITEMS     = 20000; // Per producer.
+
+      etl::queue_mpmc_atomic<int, 16> queue;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  popped(0);
+
+      std::vector<std::vector<int>> results(N_CONSUMERS);
+      std::vector<std::thread> threads;
+
+      for (int p = 0; p < N_PRODUCERS; ++p)
+      {
+        threads.push_back(std::thread([&queue, &start, p]()
+        {
+          while (!start.load());
+
+          for (int i = 0; i < N_ITEMS; ++i)
+          {
+            while (!queue.push((p * N_ITEMS) + i))
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      for (int c = 0; c < N_CONSUMERS; ++c)
+      {
+        threads.push_back(std::thread([&queue, &start, &popped, &results, c]()
+        {
+          while (!start.load());
+
+          while (popped.load() < (N_PRODUCERS * N_ITEMS))
+          {
+            int value;
+
+            if (queue.pop(value))
+            {
+              results[c].push_back(value);
+              ++popped;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      start.store(true);
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(queue.empty());
+
+      // Each consumer sees each producer's items in order.
+      std::vector<int> all;
+
+      for (int c = 0; c < N_CONSUMERS; ++c)
+      {
+        std::vector<int> last(N_PRODUCERS, -1);
+
+        for (size_t i = 0; i < results[c].size(); ++i)
+        {
+          int value    = results[c][i];
+          int producer = value / N_ITEMS;
+
+          CHECK(value > last[producer]);
+          last[producer] = value;
+        }
+
+        all.insert(all.end(), results[c].begin(), results[c].end());
+      }
+
+      // Every item was popped exactly once.
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(N_PRODUCERS * N_ITEMS), all.size());
+
+      for (size_t i = 0; i < all.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), all[i]);
+      }
+    }
+  };
+}
+
+#endif
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <iterator>
 
 #include "etl/queue_spsc_atomic.h"
 
@@ -394,6 +395,126 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_range)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, input + 6));
+      CHECK(queue.full());
+
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, input + 6));
+      CHECK_EQUAL(3U, queue.size());
+
+      std::vector<int> result;
+      CHECK_EQUAL(3U, queue.pop(std::back_inserter(result), 6U));
+      CHECK_EQUAL(3U, result.size());
+      CHECK_EQUAL(4, result[0]);
+      CHECK_EQUAL(5, result[1]);
+      CHECK_EQUAL(6, result[2]);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_acquire_release)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      etl::span<int> write_span = queue.write_reserve(3U);
+      CHECK_EQUAL(3U, write_span.size());
+
+      write_span[0] = 1;
+      write_span[1] = 2;
+      write_span[2] = 3;
+
+      // Nothing is visible until committed.
+      CHECK(queue.empty());
+      queue.write_commit(3U);
+      CHECK_EQUAL(3U, queue.size());
+
+      etl::span<int> read_span = queue.read_acquire();
+      CHECK_EQUAL(3U, read_span.size());
+      CHECK_EQUAL(1, read_span[0]);
+      CHECK_EQUAL(2, read_span[1]);
+      CHECK_EQUAL(3, read_span[2]);
+
+      queue.read_release(2U);
+      CHECK_EQUAL(1U, queue.size());
+
+      // Only the slots before the end of the buffer are contiguous.
+      write_span = queue.write_reserve(4U);
+      CHECK_EQUAL(2U, write_span.size());
+      write_span[0] = 4;
+      write_span[1] = 5;
+      queue.write_commit(2U);
+      CHECK_EQUAL(3U, queue.size());
+
+      read_span = queue.read_acquire();
+      CHECK_EQUAL(3U, read_span.size());
+      CHECK_EQUAL(3, read_span[0]);
+      CHECK_EQUAL(4, read_span[1]);
+      CHECK_EQUAL(5, read_span[2]);
+      queue.read_release(3U);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.read_acquire().size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_wrap_around)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      // Varying fill levels move the indexes around the buffer.
+      for (int i = 0; i < 100; ++i)
+      {
+        int to_push = (i % 5);
+
+        for (int j = 0; j < to_push; ++j)
+        {
+          CHECK(queue.push(next_push++));
+        }
+
+        if (to_push == 4)
+        {
+          CHECK(!queue.push(next_push));
+        }
+
+        int value;
+
+        while (queue.pop(value))
+        {
+          CHECK_EQUAL(next_pop++, value);
+        }
+
+        CHECK(queue.empty());
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+    }
+
+#if ETL_HAS_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION
+    //*************************************************************************
+    TEST(test_cache_line_isolation)
+    {
+      CHECK(sizeof(etl::queue_spsc_atomic<char, 1>) >= (3 * ETL_CACHE_LINE_SIZE));
+    }
+#endif
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <thread>
 #include <mutex>
 #include <vector>
+#include <iterator>
 
 #if defined(ETL_COMPILER_MICROSOFT)
 #include <Windows.h>
@@ -624,6 +625,114 @@ namespace
       CHECK(!Access::called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_range)
+    {
+      Access::clear();
+
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, input + 6));
+      CHECK(queue.full());
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+
+      Access::clear();
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+
+      // Wraps around the end of the buffer.
+      Access::clear();
+      CHECK_EQUAL(2U, queue.push_from_isr(input + 4, input + 6));
+      CHECK_EQUAL(3U, queue.size_from_isr());
+      CHECK(!Access::called_lock);
+      CHECK(!Access::called_unlock);
+
+      std::vector<int> result;
+      CHECK_EQUAL(3U, queue.pop_from_isr(std::back_inserter(result), 6U));
+      CHECK_EQUAL(3U, result.size());
+      CHECK_EQUAL(4, result[0]);
+      CHECK_EQUAL(5, result[1]);
+      CHECK_EQUAL(6, result[2]);
+      CHECK(!Access::called_lock);
+      CHECK(!Access::called_unlock);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_acquire_release)
+    {
+      Access::clear();
+
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      etl::span<int> write_span = queue.write_reserve(3U);
+      CHECK_EQUAL(3U, write_span.size());
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+
+      write_span[0] = 1;
+      write_span[1] = 2;
+      write_span[2] = 3;
+
+      // Nothing is visible until committed.
+      CHECK(queue.empty());
+      queue.write_commit(3U);
+      CHECK_EQUAL(3U, queue.size());
+
+      etl::span<int> read_span = queue.read_acquire();
+      CHECK_EQUAL(3U, read_span.size());
+      CHECK_EQUAL(1, read_span[0]);
+      CHECK_EQUAL(2, read_span[1]);
+      CHECK_EQUAL(3, read_span[2]);
+
+      queue.read_release(2U);
+      CHECK_EQUAL(1U, queue.size());
+
+      // Only the slots before the end of the buffer are contiguous.
+      Access::clear();
+      write_span = queue.write_reserve_from_isr(4U);
+      CHECK_EQUAL(1U, write_span.size());
+      write_span[0] = 4;
+      queue.write_commit_from_isr(1U);
+      CHECK(!Access::called_lock);
+      CHECK(!Access::called_unlock);
+
+      write_span = queue.write_reserve(4U);
+      CHECK_EQUAL(2U, write_span.size());
+      write_span[0] = 5;
+      write_span[1] = 6;
+      queue.write_commit(2U);
+      CHECK(queue.full());
+
+      Access::clear();
+      read_span = queue.read_acquire_from_isr();
+      CHECK_EQUAL(2U, read_span.size());
+      CHECK_EQUAL(3, read_span[0]);
+      CHECK_EQUAL(4, read_span[1]);
+      queue.read_release_from_isr(2U);
+      CHECK(!Access::called_lock);
+      CHECK(!Access::called_unlock);
+
+      read_span = queue.read_acquire();
+      CHECK_EQUAL(2U, read_span.size());
+      CHECK_EQUAL(5, read_span[0]);
+      CHECK_EQUAL(6, read_span[1]);
+      queue.read_release(2U);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.read_acquire().size());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
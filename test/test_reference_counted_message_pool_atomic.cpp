@@ -0,0 +1,242 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/reference_counted_message_pool_atomic.h"
+#include "etl/fixed_sized_memory_block_allocator_atomic.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+#include "etl/optional.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC && ETL_USING_64BIT_TYPES
+
+namespace
+{
+  constexpr etl::message_id_t MessageId1 = 1U;
+  constexpr etl::message_id_t MessageId2 = 2U;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MessageId2>
+  {
+    char data[32];
+  };
+
+  using Pool = etl::reference_counted_message_pool_atomic<4U, Message1, Message2>;
+
+  SUITE(test_reference_counted_message_pool_atomic)
+  {
+    //*************************************************************************
+    TEST(test_memory_block_allocator)
+    {
+      etl::fixed_sized_memory_block_allocator_atomic<16U, alignof(uint32_t), 2U> allocator;
+
+      CHECK_EQUAL(2U, allocator.max_size());
+      CHECK_EQUAL(0U, allocator.size());
+
+      CHECK(allocator.allocate(17U, 1U) == nullptr);
+      CHECK(allocator.allocate(4U, 2U * alignof(uint32_t)) == nullptr);
+
+      void* p1 = allocator.allocate(16U, alignof(uint32_t));
+      void* p2 = allocator.allocate(1U,  1U);
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p1 != p2);
+      CHECK(allocator.is_owner_of(p1));
+      CHECK(allocator.is_owner_of(p2));
+      CHECK_EQUAL(2U, allocator.size());
+      CHECK_EQUAL(0U, allocator.available());
+
+      void* p3 = nullptr;
+      CHECK_NO_THROW(p3 = allocator.allocate(1U, 1U));
+      CHECK(p3 == nullptr);
+
+      uint32_t not_owned;
+      CHECK(!allocator.is_owner_of(&not_owned));
+      CHECK(!allocator.release(&not_owned));
+
+      CHECK(allocator.release(p1));
+      CHECK(allocator.release(p2));
+      CHECK_EQUAL(0U, allocator.size());
+    }
+
+    //*************************************************************************
+    TEST(test_memory_block_allocator_successor)
+    {
+      etl::fixed_sized_memory_block_allocator_atomic<8U,  alignof(uint32_t), 1U> allocator8;
+      etl::fixed_sized_memory_block_allocator_atomic<32U, alignof(uint32_t), 1U> allocator32;
+
+      allocator8.set_successor(allocator32);
+
+      void* p1 = allocator8.allocate(8U, 1U);
+      void* p2 = allocator8.allocate(8U, 1U);
+
+      CHECK_EQUAL(1U, allocator8.size());
+      CHECK_EQUAL(1U, allocator32.size());
+      CHECK(allocator32.is_owner_of(p2));
+
+      CHECK(allocator8.release(p2));
+      CHECK(allocator8.release(p1));
+      CHECK_EQUAL(0U, allocator8.size());
+      CHECK_EQUAL(0U, allocator32.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_allocate_release)
+    {
+      Pool pool;
+
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(0U, pool.size());
+
+      {
+        etl::shared_message sm1(pool, Message1(1));
+        etl::shared_message sm2(pool, Message2());
+        etl::shared_message sm3(sm1);
+
+        CHECK_EQUAL(2U, pool.size());
+        CHECK_EQUAL(2U, pool.available());
+        CHECK_EQUAL(2, sm1.get_reference_count());
+        CHECK_EQUAL(1, sm2.get_reference_count());
+        CHECK_EQUAL(1, static_cast<const Message1&>(sm3.get_message()).i);
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exceptions)
+    {
+      Pool pool;
+
+      etl::reference_counted_message<Message1, etl::atomic_int32_t>* prcm;
+      CHECK_NO_THROW(prcm = pool.allocate<Message1>(1));
+      CHECK_NO_THROW(prcm = pool.allocate<Message1>(2));
+      CHECK_NO_THROW(prcm = pool.allocate<Message1>(3));
+      CHECK_NO_THROW(prcm = pool.allocate<Message1>(4));
+      CHECK_THROW(prcm = pool.allocate<Message1>(5), etl::reference_counted_message_pool_allocation_failure);
+      (void)prcm;
+
+      Message1 message1(6);
+      etl::reference_counted_message<Message1, etl::atomic_int32_t> temp(message1, pool);
+
+      CHECK_THROW(pool.release(temp), etl::reference_counted_message_pool_release_failure);
+    }
+
+    //*************************************************************************
+    TEST(test_pool_multiple_threads)
+    {
+      static const int N_THREADS = 4;
+      static const int N_LOOPS   = 10000;
+
+      // Each thread may hold its own message and one from the previous thread.
+      etl::reference_counted_message_pool_atomic<N_THREADS * 3, Message1> pool;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  errors(0);
+
+      // Messages are created on one thread and released on the next.
+      etl::optional<etl::shared_message> handoff[N_THREADS];
+      std::atomic<bool>   ready[N_THREADS];
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        ready[t].store(false);
+      }
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < N_THREADS; ++t)
+      {
+        threads.push_back(std::thread([&, t]()
+        {
+          while (!start.load());
+
+          const int next = (t + 1) % N_THREADS;
+
+          for (int i = 0; i < N_LOOPS; ++i)
+          {
+            etl::shared_message sm(pool, Message1(t));
+
+            // Wait for the next thread to take the previous message.
+            while (ready[next].load(std::memory_order_acquire))
+            {
+              std::this_thread::yield();
+            }
+
+            handoff[next] = sm;
+            ready[next].store(true, std::memory_order_release);
+
+            // Take the message from the previous thread.
+            while (!ready[t].load(std::memory_order_acquire))
+            {
+              std::this_thread::yield();
+            }
+
+            etl::shared_message received(handoff[t].value());
+            handoff[t].reset();
+            ready[t].store(false, std::memory_order_release);
+
+            if (static_cast<const Message1&>(received.get_message()).i != ((t + N_THREADS - 1) % N_THREADS))
+            {
+              ++errors;
+            }
+          }
+        }));
+      }
+
+      start.store(true);
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0, errors.load());
+      CHECK_EQUAL(0U, pool.size());
+    }
+  }
+}
+
+#endif
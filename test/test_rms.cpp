@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/rms.h"
 
 #include <array>
+#include <list>
 
 namespace
 {
@@ -66,5 +67,29 @@ namespace
 
       CHECK_CLOSE(5.21, result, 0.05);
     }
+
+    //*************************************************************************
+    TEST(test_rms_merge)
+    {
+      std::list<double> tail(input_f.begin() + 4, input_f.end());
+
+      etl::rms<double> expected;
+
+      for (size_t i = 0; i < input_f.size(); ++i)
+      {
+        expected.add(input_f[i]);
+      }
+
+      etl::rms<double> from_array(input_f.begin(), input_f.end());
+      etl::rms<double> part1(input_f.begin(), input_f.begin() + 4);
+      etl::rms<double> part2(tail.begin(), tail.end());
+
+      part1.merge(part2);
+
+      CHECK_EQUAL(input_f.size(), from_array.count());
+      CHECK_EQUAL(input_f.size(), part1.count());
+      CHECK_CLOSE(expected.get_rms(), from_array.get_rms(), 0.0001);
+      CHECK_CLOSE(expected.get_rms(), part1.get_rms(), 0.0001);
+    }
   };
 }
@@ -360,6 +360,39 @@ namespace
       CHECK_EQUAL(0, router2.count_unknown_message);
     }
 
+    //*************************************************************************
+    TEST(test_send_to_routers_indexed_bus)
+    {
+      etl::message_bus<2U, 8U> indexed_bus;
+
+      indexed_bus.subscribe(router1);
+      indexed_bus.subscribe(router2);
+      router1.clear();
+      router2.clear();
+
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              4U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      etl::shared_message sm1(message_pool, Message1(1));
+      etl::shared_message sm2(message_pool, Message2());
+
+      indexed_bus.receive(sm1);
+      indexed_bus.receive(sm2);
+      indexed_bus.receive(sm1);
+      indexed_bus.receive(RouterId2, sm1);
+
+      CHECK_EQUAL(1, sm1.get_reference_count());
+      CHECK_EQUAL(1, sm2.get_reference_count());
+      CHECK_EQUAL(2, router1.count_message1);
+      CHECK_EQUAL(1, router1.count_message2);
+      CHECK_EQUAL(3, router2.count_message1);
+      CHECK_EQUAL(0, router2.count_message2);
+      CHECK_EQUAL(0, router2.count_unknown_message);
+    }
+
     //*************************************************************************
     TEST(test_reference_counted_pool_exceptions)
     {
@@ -0,0 +1,216 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/size_class_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <stdint.h>
+
+namespace
+{
+  using Allocator = etl::size_class_memory_block_allocator<alignof(uint32_t),
+                                                           etl::memory_block_class<8,  4>,
+                                                           etl::memory_block_class<16, 2>,
+                                                           etl::memory_block_class<30, 2>>;
+
+  using Overflow = etl::fixed_sized_memory_block_allocator<64, alignof(uint32_t), 2>;
+
+  SUITE(test_size_class_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_classes)
+    {
+      Allocator allocator;
+
+      CHECK_EQUAL(3U,  allocator.number_of_classes());
+      CHECK_EQUAL(8U,  allocator.block_size(0));
+      CHECK_EQUAL(16U, allocator.block_size(1));
+      CHECK_EQUAL(32U, allocator.block_size(2)); // Rounded up to the alignment.
+      CHECK_EQUAL(4U,  allocator.max_blocks(0));
+      CHECK_EQUAL(2U,  allocator.max_blocks(1));
+      CHECK_EQUAL(2U,  allocator.max_blocks(2));
+      CHECK_EQUAL(32U, Allocator::Max_Block_Size);
+
+      for (size_t i = 0U; i < allocator.number_of_classes(); ++i)
+      {
+        CHECK_EQUAL(0U, allocator.allocated_blocks(i));
+        CHECK_EQUAL(0U, allocator.high_water_mark(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_routes_to_smallest_class)
+    {
+      Allocator allocator;
+
+      const size_t sizes[]   = { 1U, 8U, 9U, 16U, 17U, 32U };
+      const size_t classes[] = { 0U, 0U, 1U, 1U,  2U,  2U };
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        size_t before = allocator.allocated_blocks(classes[i]);
+
+        void* p = allocator.allocate(sizes[i], 1U);
+        CHECK(p != nullptr);
+        CHECK_EQUAL(before + 1U, allocator.allocated_blocks(classes[i]));
+        CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(p) % alignof(uint32_t));
+        CHECK(allocator.release(p));
+        CHECK_EQUAL(before, allocator.allocated_blocks(classes[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_too_large_or_too_aligned)
+    {
+      Allocator allocator;
+
+      CHECK(allocator.allocate(33U, 1U) == nullptr);
+      CHECK(allocator.allocate(4U, 2U * alignof(uint32_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_falls_through_to_larger_class_when_full)
+    {
+      Allocator allocator;
+
+      void* p[8];
+
+      // Fill every class through the smallest one.
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        p[i] = allocator.allocate(4U, 1U);
+        CHECK(p[i] != nullptr);
+      }
+
+      CHECK_EQUAL(4U, allocator.allocated_blocks(0));
+      CHECK_EQUAL(2U, allocator.allocated_blocks(1));
+      CHECK_EQUAL(2U, allocator.allocated_blocks(2));
+      CHECK(allocator.allocate(4U, 1U) == nullptr);
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        CHECK(allocator.release(p[i]));
+      }
+
+      for (size_t i = 0U; i < allocator.number_of_classes(); ++i)
+      {
+        CHECK_EQUAL(0U, allocator.allocated_blocks(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_release_to_owning_class)
+    {
+      Allocator allocator;
+
+      void* p0 = allocator.allocate(8U,  1U);
+      void* p1 = allocator.allocate(16U, 1U);
+      void* p2 = allocator.allocate(32U, 1U);
+
+      CHECK(allocator.release(p1));
+      CHECK_EQUAL(1U, allocator.allocated_blocks(0));
+      CHECK_EQUAL(0U, allocator.allocated_blocks(1));
+      CHECK_EQUAL(1U, allocator.allocated_blocks(2));
+
+      CHECK(allocator.release(p2));
+      CHECK_EQUAL(0U, allocator.allocated_blocks(2));
+
+      CHECK(allocator.release(p0));
+      CHECK_EQUAL(0U, allocator.allocated_blocks(0));
+    }
+
+    //*************************************************************************
+    TEST(test_is_owner_of)
+    {
+      Allocator allocator;
+
+      void* p0 = allocator.allocate(8U,  1U);
+      void* p2 = allocator.allocate(32U, 1U);
+
+      uint32_t not_owned;
+
+      CHECK(allocator.is_owner_of(p0));
+      CHECK(allocator.is_owner_of(p2));
+      CHECK(!allocator.is_owner_of(&not_owned));
+      CHECK(!allocator.release(&not_owned));
+      CHECK(!allocator.is_owner_of(&allocator));
+    }
+
+    //*************************************************************************
+    TEST(test_high_water_marks)
+    {
+      Allocator allocator;
+
+      void* p0 = allocator.allocate(8U, 1U);
+      void* p1 = allocator.allocate(8U, 1U);
+      void* p2 = allocator.allocate(8U, 1U);
+      void* p3 = allocator.allocate(16U, 1U);
+
+      allocator.release(p0);
+      allocator.release(p1);
+      allocator.release(p3);
+
+      CHECK_EQUAL(1U, allocator.allocated_blocks(0));
+      CHECK_EQUAL(3U, allocator.high_water_mark(0));
+      CHECK_EQUAL(1U, allocator.high_water_mark(1));
+      CHECK_EQUAL(0U, allocator.high_water_mark(2));
+
+      allocator.reset_high_water_marks();
+
+      CHECK_EQUAL(1U, allocator.high_water_mark(0));
+      CHECK_EQUAL(0U, allocator.high_water_mark(1));
+      CHECK_EQUAL(0U, allocator.high_water_mark(2));
+
+      allocator.release(p2);
+      CHECK_EQUAL(1U, allocator.high_water_mark(0));
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      Allocator allocator;
+      Overflow  overflow;
+
+      allocator.set_successor(overflow);
+
+      void* p = allocator.allocate(64U, 1U);
+      CHECK(p != nullptr);
+      CHECK(overflow.is_owner_of(p));
+
+      for (size_t i = 0U; i < allocator.number_of_classes(); ++i)
+      {
+        CHECK_EQUAL(0U, allocator.allocated_blocks(i));
+      }
+
+      CHECK(allocator.release(p));
+      CHECK(!overflow.is_owner_of(allocator.allocate(8U, 1U)));
+    }
+  }
+}
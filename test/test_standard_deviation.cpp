@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/standard_deviation.h"
 
 #include <array>
+#include <list>
 
 namespace
 {
@@ -160,5 +161,29 @@ namespace
       variance_result = standard_deviation.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_standard_deviation_merge)
+    {
+      std::list<float> tail(input_f.begin() + 4, input_f.end());
+
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> expected;
+
+      for (size_t i = 0; i < input_f.size(); ++i)
+      {
+        expected.add(input_f[i]);
+      }
+
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> from_array(input_f.begin(), input_f.end());
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> part1(input_f.begin(), input_f.begin() + 4);
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> part2(tail.begin(), tail.end());
+
+      part1.merge(part2);
+
+      CHECK_EQUAL(input_f.size(), from_array.count());
+      CHECK_EQUAL(input_f.size(), part1.count());
+      CHECK_CLOSE(expected.get_standard_deviation(), from_array.get_standard_deviation(), 0.0001);
+      CHECK_CLOSE(expected.get_standard_deviation(), part1.get_standard_deviation(), 0.0001);
+    }
   };
 }
@@ -0,0 +1,292 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/private/statistics_accumulate.h"
+
+#include <array>
+#include <list>
+#include <vector>
+
+namespace
+{
+  // More than one block of samples, with a tail that is not a multiple of the
+  // lane count, so that every part of the blocked accumulation is used.
+  const size_t Block_Input_Size = (2U * etl::private_statistics::accumulate_parameters<>::Block_Size) + 29U;
+
+  //*********************************
+  template <typename T>
+  std::vector<T> make_input1()
+  {
+    std::vector<T> input;
+
+    for (size_t i = 0U; i < Block_Input_Size; ++i)
+    {
+      input.push_back((T(i % 19U) * T(0.1)) - T(0.8));
+    }
+
+    return input;
+  }
+
+  //*********************************
+  template <typename T>
+  std::vector<T> make_input2()
+  {
+    std::vector<T> input;
+
+    for (size_t i = 0U; i < Block_Input_Size; ++i)
+    {
+      input.push_back((T(i % 19U) * T(0.05)) + (T(i % 7U) * T(0.2)));
+    }
+
+    return input;
+  }
+
+  //*********************************
+  // The sums of the double input, one sample at a time.
+  struct Reference
+  {
+    Reference()
+      : sum1(0.0)
+      , sum2(0.0)
+      , sum_of_squares1(0.0)
+      , sum_of_squares2(0.0)
+      , inner_product(0.0)
+    {
+      std::vector<double> input1 = make_input1<double>();
+      std::vector<double> input2 = make_input2<double>();
+
+      for (size_t i = 0U; i < Block_Input_Size; ++i)
+      {
+        sum1            += input1[i];
+        sum2            += input2[i];
+        sum_of_squares1 += input1[i] * input1[i];
+        sum_of_squares2 += input2[i] * input2[i];
+        inner_product   += input1[i] * input2[i];
+      }
+    }
+
+    double sum1;
+    double sum2;
+    double sum_of_squares1;
+    double sum_of_squares2;
+    double inner_product;
+  };
+
+  std::array<char, 10> input_c
+  {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9
+  };
+
+  SUITE(test_statistics_accumulate)
+  {
+    //*************************************************************************
+    TEST(test_blocks_used_for_floating_point_random_access_only)
+    {
+      CHECK((etl::private_statistics::use_blocks<float,  std::vector<float>::iterator>::value));
+      CHECK((etl::private_statistics::use_blocks<double, const double*>::value));
+      CHECK((!etl::private_statistics::use_blocks<float,  std::list<float>::iterator>::value));
+      CHECK((!etl::private_statistics::use_blocks<int32_t, const char*>::value));
+    }
+
+    //*************************************************************************
+    TEST(test_accumulate_single_term)
+    {
+      using etl::private_statistics::accumulate;
+      using etl::private_statistics::value_term;
+      using etl::private_statistics::square_term;
+
+      Reference reference;
+
+      std::vector<float>  input_float  = make_input1<float>();
+      std::vector<double> input_double = make_input1<double>();
+      std::list<float>    input_list(input_float.begin(), input_float.end());
+
+      float  sum_float           = 0.0f;
+      double sum_double          = 0.0;
+      float  sum_list            = 0.0f;
+      float  sum_of_squares      = 0.0f;
+      float  sum_of_squares_list = 0.0f;
+
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float,  value_term>(input_float.begin(),  input_float.end(),  sum_float)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<double, value_term>(input_double.begin(), input_double.end(), sum_double)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float,  value_term>(input_list.begin(),   input_list.end(),   sum_list)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float,  square_term>(input_float.begin(), input_float.end(),  sum_of_squares)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float,  square_term>(input_list.begin(),  input_list.end(),   sum_of_squares_list)));
+
+      CHECK_CLOSE(reference.sum1,            sum_float,           0.001);
+      CHECK_CLOSE(reference.sum1,            sum_double,          0.0000001);
+      CHECK_CLOSE(reference.sum1,            sum_list,            0.001);
+      CHECK_CLOSE(reference.sum_of_squares1, sum_of_squares,      0.001);
+      CHECK_CLOSE(reference.sum_of_squares1, sum_of_squares_list, 0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_accumulate_sum_and_sum_of_squares)
+    {
+      using etl::private_statistics::accumulate;
+
+      Reference reference;
+
+      std::vector<float>  input_float  = make_input1<float>();
+      std::vector<double> input_double = make_input1<double>();
+      std::list<float>    input_list(input_float.begin(), input_float.end());
+
+      float  sum_float = 0.0f;
+      float  sum_of_squares_float = 0.0f;
+      double sum_double = 0.0;
+      double sum_of_squares_double = 0.0;
+      float  sum_list = 0.0f;
+      float  sum_of_squares_list = 0.0f;
+
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float>(input_float.begin(),   input_float.end(),  sum_float,  sum_of_squares_float)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<double>(input_double.begin(), input_double.end(), sum_double, sum_of_squares_double)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float>(input_list.begin(),    input_list.end(),   sum_list,   sum_of_squares_list)));
+
+      CHECK_CLOSE(reference.sum1,            sum_float,             0.001);
+      CHECK_CLOSE(reference.sum_of_squares1, sum_of_squares_float,  0.001);
+      CHECK_CLOSE(reference.sum1,            sum_double,            0.0000001);
+      CHECK_CLOSE(reference.sum_of_squares1, sum_of_squares_double, 0.0000001);
+      CHECK_CLOSE(reference.sum1,            sum_list,              0.001);
+      CHECK_CLOSE(reference.sum_of_squares1, sum_of_squares_list,   0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_accumulate_pair)
+    {
+      using etl::private_statistics::accumulate;
+
+      Reference reference;
+
+      std::vector<float>  input1_float  = make_input1<float>();
+      std::vector<float>  input2_float  = make_input2<float>();
+      std::vector<double> input1_double = make_input1<double>();
+      std::vector<double> input2_double = make_input2<double>();
+      std::list<float>    input1_list(input1_float.begin(), input1_float.end());
+      std::list<float>    input2_list(input2_float.begin(), input2_float.end());
+
+      float  sum1_float = 0.0f;
+      float  sum2_float = 0.0f;
+      float  inner_product_float = 0.0f;
+      double sum1_double = 0.0;
+      double sum2_double = 0.0;
+      double inner_product_double = 0.0;
+      float  sum1_list = 0.0f;
+      float  sum2_list = 0.0f;
+      float  inner_product_list = 0.0f;
+
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float>(input1_float.begin(),   input1_float.end(),  input2_float.begin(),  sum1_float,  sum2_float,  inner_product_float)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<double>(input1_double.begin(), input1_double.end(), input2_double.begin(), sum1_double, sum2_double, inner_product_double)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float>(input1_list.begin(),    input1_list.end(),   input2_list.begin(),   sum1_list,   sum2_list,   inner_product_list)));
+
+      CHECK_CLOSE(reference.sum1,          sum1_float,           0.001);
+      CHECK_CLOSE(reference.sum2,          sum2_float,           0.001);
+      CHECK_CLOSE(reference.inner_product, inner_product_float,  0.001);
+      CHECK_CLOSE(reference.sum1,          sum1_double,          0.0000001);
+      CHECK_CLOSE(reference.sum2,          sum2_double,          0.0000001);
+      CHECK_CLOSE(reference.inner_product, inner_product_double, 0.0000001);
+      CHECK_CLOSE(reference.sum1,          sum1_list,            0.001);
+      CHECK_CLOSE(reference.sum2,          sum2_list,            0.001);
+      CHECK_CLOSE(reference.inner_product, inner_product_list,   0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_accumulate_pair_with_sums_of_squares)
+    {
+      using etl::private_statistics::accumulate;
+
+      Reference reference;
+
+      std::vector<float>  input1_float  = make_input1<float>();
+      std::vector<float>  input2_float  = make_input2<float>();
+      std::vector<double> input1_double = make_input1<double>();
+      std::vector<double> input2_double = make_input2<double>();
+
+      float  sum1_float = 0.0f;
+      float  sum2_float = 0.0f;
+      float  sum_of_squares1_float = 0.0f;
+      float  sum_of_squares2_float = 0.0f;
+      float  inner_product_float = 0.0f;
+      double sum1_double = 0.0;
+      double sum2_double = 0.0;
+      double sum_of_squares1_double = 0.0;
+      double sum_of_squares2_double = 0.0;
+      double inner_product_double = 0.0;
+
+      CHECK_EQUAL(Block_Input_Size, (accumulate<float>(input1_float.begin(), input1_float.end(), input2_float.begin(),
+                                                       sum1_float, sum2_float, sum_of_squares1_float, sum_of_squares2_float, inner_product_float)));
+      CHECK_EQUAL(Block_Input_Size, (accumulate<double>(input1_double.begin(), input1_double.end(), input2_double.begin(),
+                                                        sum1_double, sum2_double, sum_of_squares1_double, sum_of_squares2_double, inner_product_double)));
+
+      CHECK_CLOSE(reference.sum1,            sum1_float,             0.001);
+      CHECK_CLOSE(reference.sum2,            sum2_float,             0.001);
+      CHECK_CLOSE(reference.sum_of_squares1, sum_of_squares1_float,  0.001);
+      CHECK_CLOSE(reference.sum_of_squares2, sum_of_squares2_float,  0.001);
+      CHECK_CLOSE(reference.inner_product,   inner_product_float,    0.001);
+      CHECK_CLOSE(reference.sum1,            sum1_double,            0.0000001);
+      CHECK_CLOSE(reference.sum2,            sum2_double,            0.0000001);
+      CHECK_CLOSE(reference.sum_of_squares1, sum_of_squares1_double, 0.0000001);
+      CHECK_CLOSE(reference.sum_of_squares2, sum_of_squares2_double, 0.0000001);
+      CHECK_CLOSE(reference.inner_product,   inner_product_double,   0.0000001);
+    }
+
+    //*************************************************************************
+    TEST(test_accumulate_adds_to_totals)
+    {
+      using etl::private_statistics::accumulate;
+
+      // Shorter than one set of lanes, so only the tail loop is used.
+      std::array<double, 5> input = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+      double sum            = 10.0;
+      double sum_of_squares = 100.0;
+
+      CHECK_EQUAL(5U, (accumulate<double>(input.begin(), input.end(), sum, sum_of_squares)));
+      CHECK_CLOSE(25.0,  sum,            0.0000001);
+      CHECK_CLOSE(155.0, sum_of_squares, 0.0000001);
+
+      CHECK_EQUAL(0U, (accumulate<double>(input.begin(), input.begin(), sum, sum_of_squares)));
+      CHECK_CLOSE(25.0,  sum,            0.0000001);
+      CHECK_CLOSE(155.0, sum_of_squares, 0.0000001);
+    }
+
+    //*************************************************************************
+    TEST(test_accumulate_integral)
+    {
+      using etl::private_statistics::accumulate;
+
+      int32_t sum            = 0;
+      int32_t sum_of_squares = 0;
+
+      CHECK_EQUAL(input_c.size(), (accumulate<char>(input_c.begin(), input_c.end(), sum, sum_of_squares)));
+      CHECK_EQUAL(45,  sum);
+      CHECK_EQUAL(285, sum_of_squares);
+    }
+  };
+}
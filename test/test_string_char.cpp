@@ -3683,6 +3683,25 @@ namespace
 #include "etl/private/diagnostic_pop.h"
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_of_characters_above_127)
+    {
+      const char set[] = { 'C', char(0x80), char(0xE9), char(0xFF), 0 };
+
+      CompareText compare_text(STR("AB\xFF" "CD\x80" "EF\xE9" "GH"));
+      Text text(STR("AB\xFF" "CD\x80" "EF\xE9" "GH"));
+
+      CHECK_EQUAL(compare_text.find_first_of(set), text.find_first_of(set));
+      CHECK_EQUAL(compare_text.find_first_of(set, 3), text.find_first_of(set, 3));
+      CHECK_EQUAL(compare_text.find_last_of(set), text.find_last_of(set));
+      CHECK_EQUAL(compare_text.find_last_of(set, 7), text.find_last_of(set, 7));
+      CHECK_EQUAL(compare_text.find_first_not_of(set, 2), text.find_first_not_of(set, 2));
+      CHECK_EQUAL(compare_text.find_last_not_of(STR("GH\xE9")), text.find_last_not_of(STR("GH\xE9")));
+      CHECK_EQUAL(compare_text.find(char(0xE9)), text.find(char(0xE9)));
+      CHECK_EQUAL(compare_text.rfind(char(0xFF)), text.rfind(char(0xFF)));
+      CHECK_EQUAL(compare_text.find(STR("\x80" "EF")), text.find(STR("\x80" "EF")));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_find_last_of_string_position)
     {
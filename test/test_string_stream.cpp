@@ -230,6 +230,16 @@ namespace
       CHECK_EQUAL(String(STR("0x1e240")), ss.str());
     }
 
+    //*************************************************************************
+    TEST(test_custom_inline_format_shortest)
+    {
+      String str;
+      Stream ss(str);
+
+      ss << etl::setprecision(3) << 0.1 << STR(" ") << etl::shortest << 0.1 << STR(" ") << 1.0e-7 << STR(" ") << etl::noshortest << 0.1;
+      CHECK_EQUAL(String(STR("0.100 0.1 1e-07 0.100")), ss.str());
+    }
+
     //*************************************************************************
     TEST(test_custom_multi_inline_format)
     {
@@ -3698,6 +3698,25 @@ namespace
 #include "etl/private/diagnostic_pop.h"
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_of_characters_above_255)
+    {
+      // U'\x141' and U'\x10043' share their low bits with 'A' and 'C'.
+      const value_t set[] = { U'\x141', U'\x10043', U'E', 0 };
+
+      CompareText compare_text(STR("ABC\x141" "DEF\x10043" "G"));
+      Text text(STR("ABC\x141" "DEF\x10043" "G"));
+
+      CHECK_EQUAL(compare_text.find_first_of(set), text.find_first_of(set));
+      CHECK_EQUAL(compare_text.find_first_of(set, 4), text.find_first_of(set, 4));
+      CHECK_EQUAL(compare_text.find_last_of(set), text.find_last_of(set));
+      CHECK_EQUAL(compare_text.find_last_of(set, 6), text.find_last_of(set, 6));
+      CHECK_EQUAL(compare_text.find_first_not_of(set), text.find_first_not_of(set));
+      CHECK_EQUAL(compare_text.find_last_not_of(set), text.find_last_not_of(set));
+      CHECK_EQUAL(compare_text.find(STR("\x10043" "G")), text.find(STR("\x10043" "G")));
+      CHECK_EQUAL(compare_text.rfind(STR("C\x141")), text.rfind(STR("C\x141")));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_find_last_of_string_position)
     {
@@ -37,6 +37,7 @@ SOFTWARE.
 #include <vector>
 
 #include "etl/string_utilities.h"
+#include "etl/vector.h"
 
 #undef STR
 #define STR(x) u8##x
@@ -1095,6 +1096,121 @@ namespace
       CHECK_EQUAL(0U, tokens.size());
     }
 
+    //*************************************************************************
+    TEST(test_tokenize_ignore_empty_tokens)
+    {
+      String text(STR(",,,The,cat,sat,,on,the,mat,,,"));
+      StringView textview(text.data(), text.size());
+      etl::vector<StringView, 15> tokens;
+
+      const StringView expected[] = { STR("The"), STR("cat"), STR("sat"), STR("on"), STR("the"), STR("mat") };
+
+      etl::tokenizer<StringView> tokenizer = etl::tokenize(textview, STR(","));
+      etl::get_tokens(tokenizer.begin(), tokenizer.end(), tokens);
+
+      CHECK_EQUAL(6U, tokens.size());
+      CHECK(etl::equal(tokens.begin(), tokens.end(), expected));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenize_keep_empty_tokens)
+    {
+      String text(STR(",,,The,cat,sat,,on,the,mat,,,"));
+      StringView textview(text.data(), text.size());
+      etl::vector<StringView, 15> tokens;
+
+      const StringView expected[] = { STR(""), STR(""), STR(""), STR("The"), STR("cat"), STR("sat"), STR(""), STR("on"), STR("the"), STR("mat"), STR(""), STR(""), STR("") };
+
+      etl::tokenizer<StringView> tokenizer = etl::tokenize(textview, STR(","), false);
+      etl::get_tokens(tokenizer.begin(), tokenizer.end(), tokens);
+
+      CHECK_EQUAL(13U, tokens.size());
+      CHECK(etl::equal(tokens.begin(), tokens.end(), expected));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenize_any_of_delimiters)
+    {
+      String text(STR("The cat\tsat,on  the;mat"));
+      StringView textview(text.data(), text.size());
+      etl::vector<StringView, 15> tokens;
+
+      const StringView expected[] = { STR("The"), STR("cat"), STR("sat"), STR("on"), STR("the"), STR("mat") };
+
+      for (const StringView& token : etl::tokenize(textview, STR(" \t,;")))
+      {
+        tokens.push_back(token);
+      }
+
+      CHECK_EQUAL(6U, tokens.size());
+      CHECK(etl::equal(tokens.begin(), tokens.end(), expected));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenize_sequence_delimiter)
+    {
+      String text(STR("The::cat::sat:on::::mat"));
+      StringView textview(text.data(), text.size());
+      etl::vector<StringView, 15> tokens;
+
+      const StringView expected[] = { STR("The"), STR("cat"), STR("sat:on"), STR(""), STR("mat") };
+
+      etl::tokenizer<StringView> tokenizer = etl::tokenize(textview, STR("::"), false, etl::token_delimiter::SEQUENCE);
+      etl::get_tokens(tokenizer.begin(), tokenizer.end(), tokens);
+
+      CHECK_EQUAL(5U, tokens.size());
+      CHECK(etl::equal(tokens.begin(), tokens.end(), expected));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenize_quoted_tokens)
+    {
+      String text(STR("The,\"cat,sat\",on,\"\",\"the,mat"));
+      StringView textview(text.data(), text.size());
+      etl::vector<StringView, 15> tokens;
+
+      const StringView expected[] = { STR("The"), STR("cat,sat"), STR("on"), STR(""), STR("the,mat") };
+
+      etl::tokenizer<StringView> tokenizer = etl::tokenize(textview, STR(","), false, etl::token_delimiter::ANY_OF, STR('"'));
+      etl::get_tokens(tokenizer.begin(), tokenizer.end(), tokens);
+
+      CHECK_EQUAL(5U, tokens.size());
+      CHECK(etl::equal(tokens.begin(), tokens.end(), expected));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenize_empty_string_view)
+    {
+      StringView textview;
+
+      etl::tokenizer<StringView> tokenizer = etl::tokenize(textview, Whitespace);
+
+      CHECK(tokenizer.begin() == tokenizer.end());
+    }
+
+    //*************************************************************************
+    TEST(test_get_tokens_in_batches)
+    {
+      String text(STR("The cat sat on the mat"));
+      StringView textview(text.data(), text.size());
+      etl::vector<StringView, 4> tokens;
+
+      etl::tokenizer<StringView> tokenizer = etl::tokenize(textview, Whitespace);
+      etl::tokenizer<StringView>::const_iterator itr = etl::get_tokens(tokenizer.begin(), tokenizer.end(), tokens);
+
+      CHECK_EQUAL(4U, tokens.size());
+      CHECK(itr != tokenizer.end());
+      CHECK(StringView(STR("on")) == tokens.back());
+
+      tokens.clear();
+      itr = etl::get_tokens(itr, tokenizer.end(), tokens);
+
+      CHECK_EQUAL(2U, tokens.size());
+      CHECK(itr == tokenizer.end());
+      CHECK(StringView(STR("the")) == tokens.front());
+      CHECK(StringView(STR("mat")) == tokens.back());
+    }
+
     //*************************************************************************
     TEST(test_pad_left)
     {
@@ -813,6 +813,19 @@ namespace
       CHECK(View::npos == view.rfind(s4, 0, 11));
     }
 
+    //*************************************************************************
+    TEST(test_rfind_not_found)
+    {
+      View view("abcdabcdab");
+
+      CHECK(View::npos == view.rfind("xy"));
+      CHECK(View::npos == view.rfind("xy", 5));
+      CHECK(View::npos == view.rfind("da", 2));
+      CHECK(3U == view.rfind("da", 5));
+      CHECK(5U == view.rfind("", 5));
+      CHECK(10U == view.rfind("", 100));
+    }
+
     //*************************************************************************
     TEST(test_find_first_of)
     {
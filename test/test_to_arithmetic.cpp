@@ -32,6 +32,10 @@ SOFTWARE.
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
 
 #include "etl/to_arithmetic.h"
 #include "etl/string.h"
@@ -1005,6 +1009,117 @@ namespace
       CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<long double>(text.c_str(), text.size()).error());
     }
 
+    //*************************************************************************
+    TEST(test_long_decimal_numerics)
+    {
+      // Runs of 8 or more digits take the 8 digits at a time path.
+      Text text;
+
+      text = STR("12345678");
+      CHECK_EQUAL(12345678, etl::to_arithmetic<int32_t>(text.c_str(), text.size()).value());
+
+      text = STR("-2147483648");
+      CHECK_EQUAL(std::numeric_limits<int32_t>::min(), etl::to_arithmetic<int32_t>(text.c_str(), text.size()).value());
+
+      text = STR("18446744073709551615");
+      CHECK_EQUAL(std::numeric_limits<uint64_t>::max(), etl::to_arithmetic<uint64_t>(text.c_str(), text.size()).value());
+
+      text = STR("-9223372036854775808");
+      CHECK_EQUAL(std::numeric_limits<int64_t>::min(), etl::to_arithmetic<int64_t>(text.c_str(), text.size()).value());
+
+      text = STR("0000000000000000000000000000000000000127");
+      CHECK_EQUAL(127, int(etl::to_arithmetic<int8_t>(text.c_str(), text.size()).value()));
+
+      text = STR("00000000128");
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<int8_t>(text.c_str(), text.size()).error());
+
+      text = STR("12345678");
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<int16_t>(text.c_str(), text.size()).error());
+
+      text = STR("1234567890123456789012345678x");
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint64_t>(text.c_str(), text.size()).error());
+
+      text = STR("1234567x");
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint32_t>(text.c_str(), text.size()).error());
+
+      text = STR("12345678x");
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint32_t>(text.c_str(), text.size()).error());
+
+      text = STR("1234567812345678/");
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(text.c_str(), text.size()).error());
+
+      text = STR("12345678:2345678");
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(text.c_str(), text.size()).error());
+
+      // Compare with the standard library for random values.
+      uint64_t value = 0x123456789ABCDEFULL;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        const uint64_t expected = value >> (i % 64);
+
+        text = STR("");
+
+        for (char c : std::to_string(expected))
+        {
+          text += c;
+        }
+
+        CHECK_EQUAL(expected, etl::to_arithmetic<uint64_t>(text.c_str(), text.size()).value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_exact_floating_point)
+    {
+      // Short mantissas with small exponents are correctly rounded.
+      const char* texts[] = { "0.1", "0.3", "1.5", "-1.5", "123.456", "12345.678000", "1234567890123.25", "9007199254740991",
+                              "0.000001", "1e22", "1e-22", "4.35e-7", "-7.7e15", "3.14159265358979", "2.718281828459045", "1,25" };
+
+      for (size_t i = 0U; i < (sizeof(texts) / sizeof(texts[0])); ++i)
+      {
+        Text text;
+
+        for (const char* p = texts[i]; *p != 0; ++p)
+        {
+          text += *p;
+        }
+
+        std::string s(texts[i]);
+        std::replace(s.begin(), s.end(), ',', '.');
+
+        CHECK_EQUAL(strtod(s.c_str(),  nullptr), etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+        CHECK_EQUAL(strtof(s.c_str(),  nullptr), etl::to_arithmetic<float>(text.c_str(), text.size()).value());
+        CHECK_EQUAL(strtold(s.c_str(), nullptr), etl::to_arithmetic<long double>(text.c_str(), text.size()).value());
+      }
+
+      // Close to a float midpoint, where rounding a double result to float would be wrong.
+      Text text;
+
+      text = STR("8.000000476837159");
+      CHECK_EQUAL(strtof("8.000000476837159", nullptr), etl::to_arithmetic<float>(text.c_str(), text.size()).value());
+
+      // Zero keeps its sign, whatever the exponent.
+
+      text = STR("-0.0");
+      CHECK(std::signbit(etl::to_arithmetic<double>(text.c_str(), text.size()).value()));
+
+      text = STR("0e40");
+      CHECK_EQUAL(0.0f, etl::to_arithmetic<float>(text.c_str(), text.size()).value());
+
+      // Text that is not well formed is still rejected.
+      text = STR("1.5x");
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<double>(text.c_str(), text.size()).error());
+
+      text = STR("1.5.");
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<double>(text.c_str(), text.size()).error());
+
+      text = STR("1.5e+-2");
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<double>(text.c_str(), text.size()).error());
+    }
+
     //*************************************************************************
     TEST(test_all_api_variants)
     {
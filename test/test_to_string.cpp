@@ -253,6 +253,36 @@ namespace
       CHECK(etl::string<17>(STR("1e240")) ==              etl::to_string(123456, str, Format().hex()));
     }
 
+    //*************************************************************************
+    TEST(test_integral_digits_match_stream)
+    {
+      etl::string<32> str;
+
+      for (uint32_t i = 0U; i < 100000U; i += 97U)
+      {
+        uint64_t value = (uint64_t(i) << 32U) | i;
+
+        std::ostringstream dec;
+        dec << value;
+        CHECK_EQUAL(dec.str(), std::string(etl::to_string(value, str).c_str()));
+
+        std::ostringstream hex;
+        hex << std::hex << std::uppercase << std::showbase << value;
+        CHECK_EQUAL(hex.str(), std::string(etl::to_string(value, str, Format().hex().upper_case(true).show_base(true)).c_str()));
+
+        std::ostringstream oct;
+        oct << std::oct << i;
+        CHECK_EQUAL(oct.str(), std::string(etl::to_string(i, str, Format().octal()).c_str()));
+
+        std::ostringstream neg;
+        neg << -int32_t(i);
+        CHECK_EQUAL(neg.str(), std::string(etl::to_string(-int32_t(i), str).c_str()));
+      }
+
+      CHECK_EQUAL(std::string("zz"), std::string(etl::to_string(1295, str, Format().base(36)).c_str()));
+      CHECK_EQUAL(std::string("0B101"), std::string(etl::to_string(5, str, Format().binary().upper_case(true).show_base(true)).c_str()));
+    }
+
     //*************************************************************************
     TEST(test_floating_point_no_append)
     {
@@ -288,6 +318,62 @@ namespace
       CHECK(etl::string<20>(STR("-2.000000 ")) == etl::to_string(-1.9999996, str, Format().precision(6).width(10).left()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<32> str;
+
+      const Format format = Format().shortest(true);
+
+      CHECK_EQUAL(std::string("0"),                       std::string(etl::to_string(0.0, str, format).c_str()));
+      CHECK_EQUAL(std::string("-0"),                      std::string(etl::to_string(-0.0, str, format).c_str()));
+      CHECK_EQUAL(std::string("0.1"),                     std::string(etl::to_string(0.1, str, format).c_str()));
+      CHECK_EQUAL(std::string("0.1"),                     std::string(etl::to_string(0.1f, str, format).c_str()));
+      CHECK_EQUAL(std::string("0.30000000000000004"),     std::string(etl::to_string(0.1 + 0.2, str, format).c_str()));
+      CHECK_EQUAL(std::string("-123.456"),                std::string(etl::to_string(-123.456, str, format).c_str()));
+      CHECK_EQUAL(std::string("100"),                     std::string(etl::to_string(100.0, str, format).c_str()));
+      CHECK_EQUAL(std::string("1e+20"),                   std::string(etl::to_string(1e20, str, format).c_str()));
+      CHECK_EQUAL(std::string("1e-04"),                   std::string(etl::to_string(0.0001, str, format).c_str()));
+      CHECK_EQUAL(std::string("0.00012"),                 std::string(etl::to_string(0.00012, str, format).c_str()));
+      CHECK_EQUAL(std::string("1.7976931348623157e+308"), std::string(etl::to_string(1.7976931348623157e308, str, format).c_str()));
+      CHECK_EQUAL(std::string("5e-324"),                  std::string(etl::to_string(4.9406564584124654e-324, str, format).c_str()));
+      CHECK_EQUAL(std::string("3.4028235e+38"),           std::string(etl::to_string(3.40282347e+38f, str, format).c_str()));
+      CHECK_EQUAL(std::string("1.5"),                     std::string(etl::to_string(1.5L, str, format).c_str()));
+      CHECK_EQUAL(std::string("1.2E+100"),                std::string(etl::to_string(1.2e100, str, Format().shortest(true).upper_case(true)).c_str()));
+      CHECK_EQUAL(std::string("inf"),                     std::string(etl::to_string(HUGE_VAL, str, format).c_str()));
+
+      // The precision is ignored and the width is applied.
+      CHECK_EQUAL(std::string("   2.5"),                  std::string(etl::to_string(2.5, str, Format().shortest(true).precision(3).width(6)).c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      etl::string<32> str;
+
+      const Format format = Format().shortest(true);
+
+      uint64_t bits = 0x123456789ABCDEFULL;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        bits = (bits * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+
+        if (isnan(value) || isinf(value))
+        {
+          continue;
+        }
+
+        etl::to_string(value, str, format);
+
+        CHECK_EQUAL(value, strtod(str.c_str(), nullptr));
+        CHECK(str.size() <= 24U);
+      }
+    }
+
     //*************************************************************************
     TEST(test_floating_point_append)
     {
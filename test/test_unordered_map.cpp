@@ -1207,5 +1207,41 @@ namespace
       CHECK_TRUE(map1 == map2a);
       CHECK_FALSE(map1 == map2b);
     }
+
+    //*************************************************************************
+    TEST(test_power_of_2_bucket_policy)
+    {
+      typedef etl::unordered_map<uint32_t, uint32_t, 20, 20, etl::hash<uint32_t>, etl::equal_to<uint32_t>, etl::unordered_bucket_power_of_2> Map;
+
+      CHECK_EQUAL(32U, Map::MAX_BUCKETS);
+
+      Map map;
+
+      CHECK_EQUAL(32U, map.bucket_count());
+
+      // These keys are all multiples of the bucket count, so masking them without
+      // mix_hash would put every one in bucket 0.
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        map[i * 32U] = i;
+      }
+
+      size_t max_bucket_size = 0U;
+
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        CHECK_EQUAL(i, map.at(i * 32U));
+        max_bucket_size = std::max(max_bucket_size, map.bucket_size(i * 32U));
+      }
+
+      CHECK(max_bucket_size <= 4U);
+
+      CHECK_EQUAL(1U, map.erase(5U * 32U));
+      CHECK(map.find(5U * 32U) == map.end());
+      CHECK_EQUAL(19U, map.size());
+
+      Map other(map);
+      CHECK(other == map);
+    }
   };
 }
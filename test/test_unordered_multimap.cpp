@@ -1068,5 +1068,42 @@ namespace
       CHECK_TRUE(map1 == map2a);
       CHECK_FALSE(map1 == map2b);
     }
+
+    //*************************************************************************
+    TEST(test_power_of_2_bucket_policy)
+    {
+      typedef etl::unordered_multimap<uint32_t, uint32_t, 20, 10, etl::hash<uint32_t>, etl::equal_to<uint32_t>, etl::unordered_bucket_power_of_2> Map;
+
+      CHECK_EQUAL(16U, Map::MAX_BUCKETS);
+
+      Map map;
+
+      CHECK_EQUAL(16U, map.bucket_count());
+
+      // These keys are all multiples of the bucket count, so masking them without
+      // mix_hash would put every one in bucket 0.
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        map.insert(Map::value_type(i * 16U, i));
+        map.insert(Map::value_type(i * 16U, i + 100U));
+      }
+
+      size_t max_bucket_size = 0U;
+
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        CHECK_EQUAL(2U, map.count(i * 16U));
+        max_bucket_size = std::max(max_bucket_size, map.bucket_size(i * 16U));
+      }
+
+      CHECK(max_bucket_size <= 8U);
+
+      CHECK_EQUAL(2U, map.erase(5U * 16U));
+      CHECK(map.find(5U * 16U) == map.end());
+      CHECK_EQUAL(18U, map.size());
+
+      Map other(map);
+      CHECK(other == map);
+    }
   };
 }
@@ -943,5 +943,42 @@ namespace
       CHECK_TRUE(set1 == set2a);
       CHECK_FALSE(set1 == set2b);
     }
+
+    //*************************************************************************
+    TEST(test_power_of_2_bucket_policy)
+    {
+      typedef etl::unordered_multiset<uint32_t, 20, 10, etl::hash<uint32_t>, etl::equal_to<uint32_t>, etl::unordered_bucket_power_of_2> Set;
+
+      CHECK_EQUAL(16U, Set::MAX_BUCKETS);
+
+      Set set;
+
+      CHECK_EQUAL(16U, set.bucket_count());
+
+      // These keys are all multiples of the bucket count, so masking them without
+      // mix_hash would put every one in bucket 0.
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        set.insert(i * 16U);
+        set.insert(i * 16U);
+      }
+
+      size_t max_bucket_size = 0U;
+
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        CHECK_EQUAL(2U, set.count(i * 16U));
+        max_bucket_size = std::max(max_bucket_size, set.bucket_size(i * 16U));
+      }
+
+      CHECK(max_bucket_size <= 8U);
+
+      CHECK_EQUAL(2U, set.erase(5U * 16U));
+      CHECK(set.find(5U * 16U) == set.end());
+      CHECK_EQUAL(18U, set.size());
+
+      Set other(set);
+      CHECK(other == set);
+    }
   };
 }
@@ -909,5 +909,41 @@ namespace
       CHECK_TRUE(set1 == set2a);
       CHECK_FALSE(set1 == set2b);
     }
+
+    //*************************************************************************
+    TEST(test_power_of_2_bucket_policy)
+    {
+      typedef etl::unordered_set<uint32_t, 20, 20, etl::hash<uint32_t>, etl::equal_to<uint32_t>, etl::unordered_bucket_power_of_2> Set;
+
+      CHECK_EQUAL(32U, Set::MAX_BUCKETS);
+
+      Set set;
+
+      CHECK_EQUAL(32U, set.bucket_count());
+
+      // These keys are all multiples of the bucket count, so masking them without
+      // mix_hash would put every one in bucket 0.
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        set.insert(i * 32U);
+      }
+
+      size_t max_bucket_size = 0U;
+
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        CHECK(set.find(i * 32U) != set.end());
+        max_bucket_size = std::max(max_bucket_size, set.bucket_size(i * 32U));
+      }
+
+      CHECK(max_bucket_size <= 4U);
+
+      CHECK_EQUAL(1U, set.erase(5U * 32U));
+      CHECK(set.find(5U * 32U) == set.end());
+      CHECK_EQUAL(19U, set.size());
+
+      Set other(set);
+      CHECK(other == set);
+    }
   };
 }
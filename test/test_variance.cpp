@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/variance.h"
 
 #include <array>
+#include <list>
+#include <vector>
 
 namespace
 {
@@ -142,5 +144,45 @@ namespace
       variance_result = variance1.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_variance_merge)
+    {
+      std::list<float> tail(input_f.begin() + 4, input_f.end());
+
+      etl::variance<etl::variance_type::Sample, float> expected;
+
+      for (size_t i = 0; i < input_f.size(); ++i)
+      {
+        expected.add(input_f[i]);
+      }
+
+      etl::variance<etl::variance_type::Sample, float> from_array(input_f.begin(), input_f.end());
+      etl::variance<etl::variance_type::Sample, float> part1(input_f.begin(), input_f.begin() + 4);
+      etl::variance<etl::variance_type::Sample, float> part2(tail.begin(), tail.end());
+
+      part1.merge(part2);
+
+      CHECK_EQUAL(input_f.size(), from_array.count());
+      CHECK_EQUAL(input_f.size(), part1.count());
+      CHECK_CLOSE(expected.get_variance(), from_array.get_variance(), 0.0001);
+      CHECK_CLOSE(expected.get_variance(), part1.get_variance(), 0.0001);
+    }
+
+    //*************************************************************************
+    TEST(test_float_variance_range_accuracy)
+    {
+      std::vector<float> input;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        input.push_back(float((i * 37) % 1024) / 1024.0f);
+      }
+
+      etl::variance<etl::variance_type::Population, double> expected(input.begin(), input.end());
+      etl::variance<etl::variance_type::Population, float>  variance(input.begin(), input.end());
+
+      CHECK_CLOSE(expected.get_variance(), variance.get_variance(), expected.get_variance() * 0.001);
+    }
   };
 }